@@ -0,0 +1,218 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef AML_ARENA_H_
+#define AML_ARENA_H_
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+namespace AML
+{
+
+/**
+ * @class AMLArena
+ * @brief This class is a monotonic memory region for AMLObject and AMLData, and their keys.
+ *        Memory is taken from large blocks one after another and is freed all at once by reset() or destructor.
+ * @note  AMLArena is not thread-safe, and it should be alive while the AMLObject and AMLData placed in it are used.
+ * @see AMLObject
+ */
+class AMLArena
+{
+public:
+    /**
+     * @brief       Constructor.
+     * @param       blockSize   [in] Size of the first memory block. Next blocks get larger as they are needed.
+     */
+    explicit AMLArena(size_t blockSize = 4096);
+
+    virtual ~AMLArena(void);
+
+    /**
+     * @fn void* allocate(size_t size, size_t alignment)
+     * @brief       This function returns memory from the arena. The memory is not freed until reset().
+     * @param       size        [in] Size of memory.
+     * @param       alignment   [in] Alignment of memory. It should be a power of 2.
+     * @return      Pointer of allocated memory.
+     * @exception   AMLException If memory cannot be allocated.
+     */
+    void*                           allocate(size_t size, size_t alignment);
+
+    /**
+     * @fn T* create(Args&&... args)
+     * @brief       This function constructs an object in the arena, which is destroyed by reset() or destructor
+     *              unless it is trivially destructible.
+     * @param       args        [in] Arguments of the constructor of T.
+     * @return      Pointer of the object.
+     * @exception   AMLException If memory cannot be allocated.
+     */
+    template <typename T, typename... Args>
+    T*                              create(Args&&... args)
+    {
+        if (std::is_trivially_destructible<T>::value)
+        {
+            return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        // the cleanup is allocated first, so that nothing is left undestroyed if allocation fails
+        Cleanup* cleanup = static_cast<Cleanup*>(allocate(sizeof(Cleanup), alignof(Cleanup)));
+        T* object = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+
+        cleanup->next = m_cleanups;
+        cleanup->object = object;
+        cleanup->destroy = &destroyObject<T>;
+        m_cleanups = cleanup;
+        return object;
+    }
+
+    /**
+     * @fn void reset()
+     * @brief       This function frees all the memory of the arena at once. The largest block is kept for reuse.
+     * @note        All the AMLObject and AMLData placed in the arena should be destroyed before it is called.
+     */
+    void                            reset(void);
+
+    /**
+     * @fn size_t getUsedSize() const
+     * @brief       This function returns the size of memory which is allocated from the arena since the last reset().
+     * @return      Size of used memory.
+     */
+    size_t                          getUsedSize(void) const;
+
+private:
+    AMLArena(const AMLArena&);
+    AMLArena& operator=(const AMLArena&);
+
+    struct Block;
+    static const size_t             BLOCK_HEADER_SIZE;
+
+    // Objects of create() to be destroyed, which are listed from the last one
+    struct Cleanup
+    {
+        Cleanup*    next;
+        void*       object;
+        void        (*destroy)(void* object);
+    };
+
+    template <typename T>
+    static void                     destroyObject(void* object)
+    {
+        static_cast<T*>(object)->~T();
+    }
+
+    void                            destroyObjects(void);
+
+    Block*                          m_blocks;
+    Cleanup*                        m_cleanups;
+    char*                           m_cursor;
+    char*                           m_end;
+    size_t                          m_blockSize;
+    size_t                          m_usedSize;
+};
+
+/**
+ * @class AMLAllocator
+ * @brief This class is an allocator of standard containers which takes memory from AMLArena.
+ *        Without AMLArena, it uses the default heap.
+ */
+template <typename T>
+class AMLAllocator
+{
+public:
+    typedef T               value_type;
+    typedef T*              pointer;
+    typedef const T*        const_pointer;
+    typedef T&              reference;
+    typedef const T&        const_reference;
+    typedef size_t          size_type;
+    typedef ptrdiff_t       difference_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef AMLAllocator<U> other;
+    };
+
+    AMLAllocator(AMLArena* arena = nullptr) : m_arena(arena)
+    {
+    }
+
+    template <typename U>
+    AMLAllocator(const AMLAllocator<U>& other) : m_arena(other.getArena())
+    {
+    }
+
+    T* allocate(size_t n, const void* = nullptr)
+    {
+        if (nullptr != m_arena)
+        {
+            return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t)
+    {
+        if (nullptr == m_arena)
+        {
+            ::operator delete(p);
+        }
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args)
+    {
+        ::new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+
+    template <typename U>
+    void destroy(U* p)
+    {
+        p->~U();
+    }
+
+    size_t max_size() const
+    {
+        return static_cast<size_t>(-1) / sizeof(T);
+    }
+
+    AMLArena* getArena() const
+    {
+        return m_arena;
+    }
+
+private:
+    AMLArena* m_arena;
+};
+
+template <typename T, typename U>
+inline bool operator==(const AMLAllocator<T>& a, const AMLAllocator<U>& b)
+{
+    return a.getArena() == b.getArena();
+}
+
+template <typename T, typename U>
+inline bool operator!=(const AMLAllocator<T>& a, const AMLAllocator<U>& b)
+{
+    return a.getArena() != b.getArena();
+}
+
+} // namespace AML
+
+#endif // AML_ARENA_H_
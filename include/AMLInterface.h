@@ -21,6 +21,10 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <cstdint>
+
+#include "AMLArena.h"
+#include "AMLSymbol.h"
 
 namespace AML
 {
@@ -35,7 +39,13 @@ enum class AMLValueType
 {
     String = 0,
     StringArray,
-    AMLData
+    AMLData,
+    Integer,
+    Double,
+    Boolean,
+    Binary,
+    IntegerArray,
+    DoubleArray
 };
 
 /**
@@ -83,16 +93,43 @@ public:
      */
     AMLObject(const std::string& deviceId, const std::string& timeStamp, const std::string& id);
 
+    /**
+     * @brief       Constructor.
+     * @param       deviceId    [in] Device id that source device of AMLObject.
+     * @param       timestamp   [in] timestamp value of AMLObject delibered by device.
+     * @param       id          [in] id of AMLObject.
+     * @param       arena       [in] AMLArena which AMLData of AMLObject are placed in, or nullptr to use heap.
+     * @note        The arena should be alive until AMLObject is destroyed.
+     *              Names and keys are copied into the arena, and so are the values with the entries of AMLData.
+     *              Only the characters of string values longer than the inline buffer of std::string are on the heap,
+     *              as the values are returned as std::string.
+     */
+    AMLObject(const std::string& deviceId, const std::string& timeStamp, const std::string& id, AMLArena* arena);
+
     /**
      * @brief       Copy Constructor Overloading.
+     * @note        The copy does not share the arena of t. It is placed on the heap.
      */
     AMLObject(const AMLObject& t);
 
+    /**
+     * @brief       Move Constructor Overloading.
+     * @note        AMLData of t are taken over without copy, with the arena of t.
+     */
+    AMLObject(AMLObject&& t) noexcept;
+
     /**
      * @brief       Assignment Operator Overloading.
      */
     AMLObject& operator=(const AMLObject& t);
 
+    /**
+     * @brief       Move Assignment Operator Overloading.
+     * @note        AMLData of t are taken over without copy if both are placed in the same arena (or both on the heap),
+     *              otherwise they are copied, and std::terminate is called if the allocation fails.
+     */
+    AMLObject& operator=(AMLObject&& t) noexcept;
+
     virtual ~AMLObject(void);
 
     /**
@@ -104,6 +141,34 @@ public:
      */
     void                            addData(const std::string& name, const AMLData& data);
 
+    /**
+     * @fn void addData(const std::string& name, AMLData&& data)
+     * @brief       This function moves AMLData into AMLObject using AMLData key that to match AMLData value.
+     * @param       name    [in] AMLData key.
+     * @param       data    [in] AMLData value. Its values are taken over without copy if it is placed in the same arena as AMLObject.
+     * @exception   AMLException If AMLData key is duplicated on AMLObject or if name is a invalid key.
+     */
+    void                            addData(const std::string& name, AMLData&& data);
+
+    /**
+     * @fn void addData(const AMLSymbol& name, AMLData&& data)
+     * @brief       This function moves AMLData into AMLObject using interned AMLData key.
+     * @param       name    [in] AMLData key.
+     * @param       data    [in] AMLData value.
+     * @exception   AMLException If AMLData key is duplicated on AMLObject or if name is empty.
+     */
+    void                            addData(const AMLSymbol& name, AMLData&& data);
+
+    /**
+     * @fn AMLData& emplaceData(const std::string& name)
+     * @brief       This function adds an empty AMLData to AMLObject and returns it to be filled in place.
+     * @param       name    [in] AMLData key.
+     * @return      Reference of the added AMLData. It is valid while AMLObject is alive.
+     * @exception   AMLException If AMLData key is duplicated on AMLObject or if name is a invalid key.
+     */
+    AMLData&                        emplaceData(const std::string& name);
+    AMLData&                        emplaceData(const AMLSymbol& name);
+
     /**
      * @fn AMLData getData(const std::string& name) const
      * @brief       This function return AMLData which matched input name string with AMLObject's amlDatas key.
@@ -113,6 +178,15 @@ public:
      */
     const AMLData&                  getData(const std::string& name) const;
 
+    /**
+     * @fn const AMLData& getData(const AMLSymbol& name) const
+     * @brief       This function return AMLData of interned name. Names are compared by identity, not by characters.
+     * @param       name    [in] Interned AMLData key.
+     * @return      AMLData that have sub key value fair.
+     * @exception   AMLException If the input name does not exist in amlDatas.
+     */
+    const AMLData&                  getData(const AMLSymbol& name) const;
+
     /**
      * @fn std::vector<std::string> getDataNames() const
      * @brief       This function return string list about AMLObject's amlDatas keys string array.
@@ -149,31 +223,74 @@ private:
      */
     void                            copyObject(AMLObject* target) const;
 
-    const std::string m_deviceId;
-    const std::string m_timeStamp;
-    const std::string m_id;
-    mutable std::map<std::string, AMLData*> m_amlDatas;
+    /**
+     * @fn void clearObject()
+     * @brief       This function deletes all AMLData of AMLObject.
+     */
+    void                            clearObject();
+
+    typedef std::pair<AMLSymbol, AMLData*> DataEntry;
+    typedef std::vector<DataEntry, AMLAllocator<DataEntry>> DataVector;
+
+    /**
+     * @fn DataVector::iterator findInsertPosition(const AMLSymbol& name)
+     * @brief       This function returns the position where name is inserted to keep AMLData sorted by name.
+     * @param       name    [in] AMLData key.
+     * @return      Iterator of the position.
+     * @exception   AMLException If name already exists.
+     */
+    DataVector::iterator            findInsertPosition(const AMLSymbol& name);
+
+    std::string m_deviceId;
+    std::string m_timeStamp;
+    std::string m_id;
+    AMLArena* m_arena;
+    DataVector m_amlDatas;          // sorted by name
 };
 
 /**
  * @class AMLData
  * @brief This class have RawData map which have key value pair.
+ * @note  Keys can also be given as AMLSymbol. They are matched by identity, which is faster than by characters.
+ *        Keys given as std::string are resolved by AMLSymbol::lookup(), so that the names in a loaded model are
+ *        matched by identity also when they are set as std::string. They are never interned.
  */
 class AMLData
 {
 public:
     AMLData(void);
 
+    /**
+     * @brief       Constructor.
+     * @param       arena   [in] AMLArena which values of AMLData are placed in, or nullptr to use heap.
+     * @note        The arena should be alive until AMLData is destroyed.
+     */
+    explicit AMLData(AMLArena* arena);
+
     /**
      * @brief       Copy Constructor Overloading.
+     * @note        The copy does not share the arena of t. It is placed on the heap.
      */
     AMLData(const AMLData& t);
 
+    /**
+     * @brief       Move Constructor Overloading.
+     * @note        Values of t are taken over without copy, with the arena of t.
+     */
+    AMLData(AMLData&& t) noexcept;
+
     /**
      * @brief       Copy Constructor Overloading.
      */
     AMLData& operator=(const AMLData& t);
 
+    /**
+     * @brief       Move Assignment Operator Overloading.
+     * @note        Values of t are taken over without copy if both are placed in the same arena (or both on the heap),
+     *              otherwise they are copied, and std::terminate is called if the allocation fails.
+     */
+    AMLData& operator=(AMLData&& t) noexcept;
+
     virtual ~AMLData(void);
 
     /**
@@ -183,6 +300,9 @@ public:
      * @param       value   [in] AMLData value.
      */
     void                            setValue(const std::string& key, const std::string& value);
+    void                            setValue(const std::string& key, std::string&& value);
+    void                            setValue(const AMLSymbol& key, const std::string& value);
+    void                            setValue(const AMLSymbol& key, std::string&& value);
 
     /**
      * @fn void setValue(const std::string& key, const std::vector<std::string>& value)
@@ -191,6 +311,9 @@ public:
      * @param       value   [in] AMLData value.
      */
     void                            setValue(const std::string& key, const std::vector<std::string>& value); 
+    void                            setValue(const std::string& key, std::vector<std::string>&& value);
+    void                            setValue(const AMLSymbol& key, const std::vector<std::string>& value);
+    void                            setValue(const AMLSymbol& key, std::vector<std::string>&& value);
     
     /**
      * @fn void setValue(const std::string& key, const AMLData& value)
@@ -199,6 +322,91 @@ public:
      * @param       value   [in] AMLData value
      */
     void                            setValue(const std::string& key, const AMLData& value);
+    void                            setValue(const std::string& key, AMLData&& value);
+    void                            setValue(const AMLSymbol& key, const AMLData& value);
+    void                            setValue(const AMLSymbol& key, AMLData&& value);
+
+    /**
+     * @fn AMLData& emplaceData(const std::string& key)
+     * @brief       This function sets key and an empty AMLData value pair on AMLData, and returns the value to be filled in place.
+     * @param       key     [in] AMLData key
+     * @return      Reference of the added AMLData value. It is valid while this AMLData is alive.
+     */
+    AMLData&                        emplaceData(const std::string& key);
+    AMLData&                        emplaceData(const AMLSymbol& key);
+
+    /**
+     * @fn void setIntValue(const std::string& key, int64_t value)
+     * @brief       This function set key and integer type value pair on AMLData.
+     *              The value is kept as a number, and is formatted only when AMLData is converted to AML(XML).
+     * @param       key     [in] AMLData key.
+     * @param       value   [in] AMLData value.
+     * @note        The attribute of key should have an integer or a floating point AttributeDataType (e.g. xs:long, xs:double),
+     *              otherwise the conversion to AML or protobuf throws AMLException(NOT_MATCH_TO_AML_MODEL).
+     *              The typed setters are named by type, as a literal string would be taken as bool by an overloaded setValue.
+     */
+    void                            setIntValue(const std::string& key, int64_t value);
+    void                            setIntValue(const AMLSymbol& key, int64_t value);
+
+    /**
+     * @fn void setDoubleValue(const std::string& key, double value)
+     * @brief       This function set key and floating point type value pair on AMLData.
+     * @param       key     [in] AMLData key.
+     * @param       value   [in] AMLData value.
+     * @note        The attribute of key should have a floating point AttributeDataType (xs:double, xs:float or xs:decimal).
+     */
+    void                            setDoubleValue(const std::string& key, double value);
+    void                            setDoubleValue(const AMLSymbol& key, double value);
+
+    /**
+     * @fn void setBoolValue(const std::string& key, bool value)
+     * @brief       This function set key and boolean type value pair on AMLData.
+     * @param       key     [in] AMLData key.
+     * @param       value   [in] AMLData value.
+     * @note        The attribute of key should have xs:boolean AttributeDataType.
+     */
+    void                            setBoolValue(const std::string& key, bool value);
+    void                            setBoolValue(const AMLSymbol& key, bool value);
+
+    /**
+     * @fn void setBinaryValue(const std::string& key, const std::vector<uint8_t>& value)
+     * @brief       This function set key and binary type value pair on AMLData.
+     * @param       key     [in] AMLData key.
+     * @param       value   [in] AMLData value. It should not be empty.
+     * @note        The attribute of key should have xs:base64Binary or xs:hexBinary AttributeDataType,
+     *              which the value is encoded in when AMLData is converted to AML(XML).
+     */
+    void                            setBinaryValue(const std::string& key, const std::vector<uint8_t>& value);
+    void                            setBinaryValue(const std::string& key, std::vector<uint8_t>&& value);
+    void                            setBinaryValue(const AMLSymbol& key, const std::vector<uint8_t>& value);
+    void                            setBinaryValue(const AMLSymbol& key, std::vector<uint8_t>&& value);
+
+    /**
+     * @fn void setIntArrayValue(const std::string& key, const std::vector<int64_t>& value)
+     * @brief       This function set key and integer array type value pair on AMLData.
+     *              The elements are kept in a contiguous buffer, instead of a string for each element.
+     * @param       key     [in] AMLData key.
+     * @param       value   [in] AMLData value. It should not be empty.
+     * @note        The attribute of key should be an ordered list (RefSemantic "OrderedListType") which has an integer or
+     *              a floating point AttributeDataType, otherwise the conversion to AML or protobuf throws AMLException(NOT_MATCH_TO_AML_MODEL).
+     *              The array is written as a single <Value> of the elements separated by spaces, instead of <Attribute Name="1".."N">.
+     */
+    void                            setIntArrayValue(const std::string& key, const std::vector<int64_t>& value);
+    void                            setIntArrayValue(const std::string& key, std::vector<int64_t>&& value);
+    void                            setIntArrayValue(const AMLSymbol& key, const std::vector<int64_t>& value);
+    void                            setIntArrayValue(const AMLSymbol& key, std::vector<int64_t>&& value);
+
+    /**
+     * @fn void setDoubleArrayValue(const std::string& key, const std::vector<double>& value)
+     * @brief       This function set key and floating point array type value pair on AMLData.
+     * @param       key     [in] AMLData key.
+     * @param       value   [in] AMLData value. It should not be empty.
+     * @note        The attribute of key should be an ordered list which has a floating point AttributeDataType.
+     */
+    void                            setDoubleArrayValue(const std::string& key, const std::vector<double>& value);
+    void                            setDoubleArrayValue(const std::string& key, std::vector<double>&& value);
+    void                            setDoubleArrayValue(const AMLSymbol& key, const std::vector<double>& value);
+    void                            setDoubleArrayValue(const AMLSymbol& key, std::vector<double>&& value);
 
     /**
      * @fn std::string getValueToStr(const std::string& key) const
@@ -206,8 +414,10 @@ public:
      * @param       key     [in] pair's which has string value, key.
      * @return      String value which matched using key on AMLMap.
      * @exception   AMLException If input key is not matching on AMLMap.
+     * @note        The reference is valid until a value is set to AMLData or AMLData is destroyed.
      */
     const std::string&              getValueToStr(const std::string& key) const;
+    const std::string&              getValueToStr(const AMLSymbol& key) const;
     
     /**
      * @fn std::string getValueToStrArr(const std::string& key) const
@@ -215,8 +425,10 @@ public:
      * @param       key     [in] pair's which has string Array value, key.
      * @return      String array value which matched using key on AMLMap.
      * @exception   AMLException If input key is not matching on AMLMap.
+     * @note        The reference is valid until a value is set to AMLData or AMLData is destroyed.
      */
     const std::vector<std::string>& getValueToStrArr(const std::string& key) const;
+    const std::vector<std::string>& getValueToStrArr(const AMLSymbol& key) const;
     
     /**
      * @fn std::string getValueToAMLData(const std::string& key) const
@@ -226,6 +438,74 @@ public:
      * @exception   AMLException If input key is not matching on AMLMap.
      */
     const AMLData&                  getValueToAMLData(const std::string& key) const;
+    const AMLData&                  getValueToAMLData(const AMLSymbol& key) const;
+
+    /**
+     * @fn int64_t getValueToInt(const std::string& key) const
+     * @brief       This function return integer which matched key in a AMLData's AMLMap.
+     * @param       key     [in] pair's which has integer value, key.
+     * @return      Integer value which matched using key on AMLMap.
+     * @exception   AMLException If input key is not matching on AMLMap (KEY_NOT_EXIST),
+     *              or if the value is neither an integer nor a string of a decimal integer (WRONG_GETTER_TYPE).
+     * @note        Values converted from AML(XML) are strings, which are parsed by this function.
+     */
+    int64_t                         getValueToInt(const std::string& key) const;
+    int64_t                         getValueToInt(const AMLSymbol& key) const;
+
+    /**
+     * @fn double getValueToDouble(const std::string& key) const
+     * @brief       This function return floating point number which matched key in a AMLData's AMLMap.
+     * @param       key     [in] pair's which has floating point value, key.
+     * @return      Floating point value which matched using key on AMLMap.
+     * @exception   AMLException If input key is not matching on AMLMap (KEY_NOT_EXIST),
+     *              or if the value is neither a number nor a string of a number (WRONG_GETTER_TYPE).
+     */
+    double                          getValueToDouble(const std::string& key) const;
+    double                          getValueToDouble(const AMLSymbol& key) const;
+
+    /**
+     * @fn bool getValueToBool(const std::string& key) const
+     * @brief       This function return boolean which matched key in a AMLData's AMLMap.
+     * @param       key     [in] pair's which has boolean value, key.
+     * @return      Boolean value which matched using key on AMLMap.
+     * @exception   AMLException If input key is not matching on AMLMap (KEY_NOT_EXIST),
+     *              or if the value is neither a boolean nor one of "true", "false", "1" and "0" (WRONG_GETTER_TYPE).
+     */
+    bool                            getValueToBool(const std::string& key) const;
+    bool                            getValueToBool(const AMLSymbol& key) const;
+
+    /**
+     * @fn const std::vector<uint8_t>& getValueToBinary(const std::string& key) const
+     * @brief       This function return binary which matched key in a AMLData's AMLMap.
+     * @param       key     [in] pair's which has binary value, key.
+     * @return      Binary value which matched using key on AMLMap.
+     * @exception   AMLException If input key is not matching on AMLMap (KEY_NOT_EXIST) or the value is not binary (WRONG_GETTER_TYPE).
+     * @note        The reference is valid until a value is set to AMLData or AMLData is destroyed.
+     */
+    const std::vector<uint8_t>&     getValueToBinary(const std::string& key) const;
+    const std::vector<uint8_t>&     getValueToBinary(const AMLSymbol& key) const;
+
+    /**
+     * @fn const std::vector<int64_t>& getValueToIntArr(const std::string& key) const
+     * @brief       This function return integer array which matched key in a AMLData's AMLMap.
+     * @param       key     [in] pair's which has integer array value, key.
+     * @return      Integer array value which matched using key on AMLMap.
+     * @exception   AMLException If input key is not matching on AMLMap (KEY_NOT_EXIST) or the value is not an integer array (WRONG_GETTER_TYPE).
+     * @note        The reference is valid until a value is set to AMLData or AMLData is destroyed.
+     */
+    const std::vector<int64_t>&     getValueToIntArr(const std::string& key) const;
+    const std::vector<int64_t>&     getValueToIntArr(const AMLSymbol& key) const;
+
+    /**
+     * @fn const std::vector<double>& getValueToDoubleArr(const std::string& key) const
+     * @brief       This function return floating point array which matched key in a AMLData's AMLMap.
+     * @param       key     [in] pair's which has floating point array value, key.
+     * @return      Floating point array value which matched using key on AMLMap.
+     * @exception   AMLException If input key is not matching on AMLMap (KEY_NOT_EXIST) or the value is not a floating point array (WRONG_GETTER_TYPE).
+     * @note        The reference is valid until a value is set to AMLData or AMLData is destroyed.
+     */
+    const std::vector<double>&      getValueToDoubleArr(const std::string& key) const;
+    const std::vector<double>&      getValueToDoubleArr(const AMLSymbol& key) const;
 
     /**
      * @fn std::vector<std::string> getKeys() const
@@ -241,6 +521,7 @@ public:
      * @return      value's AMLValueType of pre defined data type.
      */
     AMLValueType                    getValueType(const std::string& key) const;
+    AMLValueType                    getValueType(const AMLSymbol& key) const;
 
 private:
     /**
@@ -250,7 +531,105 @@ private:
      */
     void                            copyData(AMLData* target) const;
 
-    std::map<std::string, AMLValue*> m_values;
+    /**
+     * @fn void clearValues()
+     * @brief       This function deletes all values of AMLData.
+     */
+    void                            clearValues();
+
+    /**
+     * @class Entry
+     * @brief This class is a key and value pair of AMLData.
+     *        The value is a tagged union, so that string and string array values are held in the entry itself.
+     */
+    class Entry
+    {
+    public:
+        Entry(const AMLSymbol& key, std::string&& value);
+        Entry(const AMLSymbol& key, std::vector<std::string>&& value);
+        Entry(const AMLSymbol& key, AMLData* value);
+        Entry(const AMLSymbol& key, int64_t value);
+        Entry(const AMLSymbol& key, double value);
+        Entry(const AMLSymbol& key, bool value);
+        Entry(const AMLSymbol& key, std::vector<uint8_t>&& value);
+        Entry(const AMLSymbol& key, std::vector<int64_t>&& value);
+        Entry(const AMLSymbol& key, std::vector<double>&& value);
+        Entry(Entry&& t) noexcept;
+        Entry& operator=(Entry&& t) noexcept;
+        ~Entry();
+
+        AMLSymbol                       m_key;
+        AMLValueType                    m_type;
+        union
+        {
+            std::string                 m_str;
+            std::vector<std::string>    m_strArr;
+            AMLData*                    m_data;     // owned by AMLData which has the entry, as it knows the arena
+            int64_t                     m_int;
+            double                      m_double;
+            bool                        m_bool;
+            std::vector<uint8_t>        m_binary;
+            std::vector<int64_t>        m_intArr;
+            std::vector<double>         m_doubleArr;
+        };
+
+    private:
+        Entry(const Entry&);
+        Entry& operator=(const Entry&);
+
+        void                            moveValue(Entry&& t);
+        void                            destroyValue();
+    };
+
+    typedef std::vector<Entry, AMLAllocator<Entry>> EntryVector;
+
+    /**
+     * @fn const Entry& findEntry(const std::string& key, AMLValueType type) const
+     * @brief       This function returns the entry of key which has a value of the given type.
+     * @param       key     [in] AMLData key.
+     * @param       type    [in] Expected type of the value.
+     * @return      Entry of key.
+     * @exception   AMLException If key does not exist or the value is not of the given type.
+     */
+    const Entry&                    findEntry(const std::string& key, AMLValueType type) const;
+    const Entry&                    findEntry(const AMLSymbol& key, AMLValueType type) const;
+
+    /**
+     * @fn const Entry& findEntry(const std::string& key) const
+     * @brief       This function returns the entry of key which has a value of any type.
+     * @exception   AMLException If key does not exist.
+     */
+    const Entry&                    findEntry(const std::string& key) const;
+    const Entry&                    findEntry(const AMLSymbol& key) const;
+
+    /**
+     * @fn void addEntry(const AMLSymbol& key, T&& value)
+     * @brief       This function adds the entry of key and a value which is held in the entry itself.
+     * @exception   AMLException If key is empty (INVALID_PARAM) or already exists (KEY_ALREADY_EXIST).
+     */
+    template <typename T>
+    void                            addEntry(const AMLSymbol& key, T&& value);
+
+    /**
+     * @fn int64_t toInt(const Entry& entry)
+     * @brief       These functions return the value of entry as the type of the getter, parsing a string value.
+     * @exception   AMLException If the value cannot be converted (WRONG_GETTER_TYPE).
+     */
+    static int64_t                  toInt(const Entry& entry);
+    static double                   toDouble(const Entry& entry);
+    static bool                     toBool(const Entry& entry);
+
+    /**
+     * @fn EntryVector::iterator findInsertPosition(const AMLSymbol& key)
+     * @brief       This function returns the position where key is inserted to keep the entries sorted.
+     * @param       key     [in] AMLData key.
+     * @return      Iterator of the position.
+     * @exception   AMLException If key already exists.
+     */
+    EntryVector::iterator           findInsertPosition(const AMLSymbol& key);
+
+    AMLArena* m_arena;
+    EntryVector m_entries;          // sorted by key
 };
 
 } // namespace AML
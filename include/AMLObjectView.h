@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef AML_OBJECT_VIEW_H_
+#define AML_OBJECT_VIEW_H_
+
+#include <string>
+#include <vector>
+
+#include "AMLInterface.h"
+#include "AMLSymbol.h"
+
+namespace AML
+{
+
+class Representation;
+
+/**
+ * @class AMLObjectView
+ * @brief This class is a read-only AMLObject over a received AML(XML) string or Protobuf byte data.
+ *        It keeps the payload and finds the data in it when it is created, but the value of each data is decoded
+ *        at the first getData() of its name. The decoded AMLData is kept, so that the next calls return the same one.
+ * @note  It has the same getters as AMLObject, so the code which reads AMLObject can read AMLObjectView as well.
+ *        All the getters can be called from many threads at once.
+ * @see Representation::AmlToDataView, Representation::ByteToDataView
+ */
+class AMLObjectView
+{
+public:
+    class Source;
+
+    virtual ~AMLObjectView(void);
+
+    /**
+     * @fn const AMLData& getData(const std::string& name) const
+     * @brief       This function returns AMLData which matched input name, decoding it at the first call.
+     * @param       name    [in] Name of the data.
+     * @return      Reference of AMLData. It is valid until AMLObjectView is deleted.
+     * @exception   AMLException If the name does not exist (KEY_NOT_EXIST) or its value is not valid AML data.
+     */
+    const AMLData&                  getData(const std::string& name) const;
+    const AMLData&                  getData(const AMLSymbol& name) const;
+
+    /**
+     * @fn std::vector<std::string> getDataNames() const
+     * @brief       This function returns the names of all data, which does not decode any of them.
+     * @return      Vector of names in the same order as AMLObject::getDataNames().
+     */
+    std::vector<std::string>        getDataNames() const;
+
+    /**
+     * @fn std::string getDeviceId() const;
+     * @brief       This function returns the device id.
+     * @return      string value of the device id.
+     */
+    const std::string&              getDeviceId() const;
+
+    /**
+     * @fn std::string getTimeStamp() const;
+     * @brief       This function returns the timestamp.
+     * @return      string value of the timestamp.
+     */
+    const std::string&              getTimeStamp() const;
+
+    /**
+     * @fn std::string getId() const;
+     * @brief       This function returns the id.
+     * @return      string value of the id.
+     */
+    const std::string&              getId() const;
+
+    /**
+     * @fn size_t getDecodedCount() const
+     * @brief       This function returns how many data have been decoded so far.
+     * @return      Number of data which getData() has been called for.
+     */
+    size_t                          getDecodedCount() const;
+
+private:
+    friend class Representation;
+
+    explicit AMLObjectView(Source* source);
+
+    AMLObjectView(const AMLObjectView&);
+    AMLObjectView& operator=(const AMLObjectView&);
+
+    class Impl;
+    Impl*                           m_impl;
+};
+
+} // namespace AML
+
+#endif // AML_OBJECT_VIEW_H_
@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef AML_PROJECTION_H_
+#define AML_PROJECTION_H_
+
+#include <string>
+#include <vector>
+
+namespace AML
+{
+
+/**
+ * @class AMLProjection
+ * @brief This class is a set of the data which Representation decodes, while the others are skipped without being built.
+ *        Each path is a data name of AMLObject, optionally followed by keys of nested AMLData, separated by '/'.
+ *        e.g. "Model" selects the whole "Model" data, and "Sample/info/axis" selects only the key "axis" of the key "info"
+ *        of the "Sample" data.
+ * @note  The keys after a key whose value is not AMLData are ignored, so the whole value is selected.
+ *        A path which does not exist in the payload selects nothing.
+ * @see Representation
+ */
+class AMLProjection
+{
+public:
+    /**
+     * @brief       Constructor of the projection which selects nothing.
+     */
+    AMLProjection(void);
+
+    /**
+     * @brief       Constructor.
+     * @param       paths   [in] Paths to be selected.
+     * @exception   AMLException If any of paths is empty or has an empty name (INVALID_PARAM).
+     */
+    explicit AMLProjection(const std::vector<std::string>& paths);
+
+    virtual ~AMLProjection(void);
+
+    /**
+     * @fn void add(const std::string& path)
+     * @brief       This function adds a path to be selected.
+     * @param       path    [in] Data name, optionally followed by keys separated by '/'.
+     * @exception   AMLException If path is empty or has an empty name (INVALID_PARAM).
+     */
+    void                            add(const std::string& path);
+
+    /**
+     * @fn bool select(const std::string& name, const AMLProjection** children) const
+     * @brief       This function returns whether the name is selected, and the projection of its children.
+     * @param       name        [in] Data name, or key of AMLData at the level of this projection.
+     * @param       children    [out] Projection of the keys under the name, or nullptr if all of them are selected.
+     * @return      true if the name is selected.
+     */
+    bool                            select(const std::string& name, const AMLProjection** children) const;
+
+private:
+    AMLProjection(const AMLProjection&);
+    AMLProjection& operator=(const AMLProjection&);
+
+    class Impl;
+    Impl*                           m_impl;
+};
+
+} // namespace AML
+
+#endif // AML_PROJECTION_H_
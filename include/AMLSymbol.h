@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef AML_SYMBOL_H_
+#define AML_SYMBOL_H_
+
+#include <memory>
+#include <string>
+
+namespace AML
+{
+
+class AMLArena;
+
+/**
+ * @class AMLSymbol
+ * @brief This class is an interned name of AMLData key or AMLObject data name.
+ *        Each name is stored once in the process, so that symbols of the same name are compared by identity.
+ *        Only names of SystemUnitClassLib are interned, when Representation is loaded.
+ *        Keys given as std::string are resolved to the interned symbols by lookup(), if they are in a loaded model.
+ *        Other names, such as the ones read from input data, are held by uninterned symbols
+ *        which have a copy of the name, on the heap or in AMLArena of AMLData, and are compared by characters.
+ * @note  Interned names are never freed, so input data cannot intern a name not to grow the symbol table.
+ *        Interning and lookup() are thread-safe.
+ * @see AMLData
+ */
+class AMLSymbol
+{
+public:
+    /**
+     * @brief       Constructor of the symbol of empty name.
+     */
+    AMLSymbol(void);
+
+    /**
+     * @fn static AMLSymbol lookup(const std::string& name, AMLArena* arena)
+     * @brief       This function returns the interned symbol of name, or an uninterned symbol if name is not interned.
+     * @param       name    [in] Name of the symbol.
+     * @param       arena   [in] AMLArena which the copy of name is placed in if it is not interned, or nullptr to use heap.
+     * @return      Symbol of name, which is compared by identity with the symbols in the model if it is found.
+     * @note        It never interns name. AMLData and AMLObject use it for keys given as std::string.
+     */
+    static AMLSymbol lookup(const std::string& name, AMLArena* arena = nullptr);
+
+    /**
+     * @fn static AMLSymbol uninterned(const std::string& name)
+     * @brief       This function returns a symbol which owns a copy of name, without interning it.
+     * @param       name    [in] Name of the symbol.
+     * @return      Symbol of name, which is equal to the interned symbol of the same name.
+     * @note        It takes no lock and leaves nothing behind, so it is used for names of an unbounded set.
+     */
+    static AMLSymbol uninterned(const std::string& name);
+
+    /**
+     * @fn static AMLSymbol uninterned(const std::string& name, AMLArena* arena)
+     * @brief       This function returns a symbol whose copy of name is placed in the arena, without interning it.
+     * @param       name    [in] Name of the symbol.
+     * @param       arena   [in] AMLArena which the copy is placed in, or nullptr to use heap.
+     * @return      Symbol of name, which is equal to the interned symbol of the same name.
+     * @note        The symbol should not be used after the arena is reset. AMLData and AMLObject copy it again
+     *              when it is added to another arena or to the heap.
+     */
+    static AMLSymbol uninterned(const std::string& name, AMLArena* arena);
+
+    /**
+     * @fn AMLSymbol placeIn(AMLArena* arena) const
+     * @brief       This function returns the symbol to be kept in the arena (or on the heap if it is nullptr).
+     *              It is the same symbol, unless its copy of name is placed in another arena.
+     * @param       arena   [in] AMLArena where the symbol is kept.
+     * @return      Symbol which is valid while the arena is alive.
+     */
+    AMLSymbol placeIn(AMLArena* arena) const
+    {
+        return (nullptr == m_arena || arena == m_arena) ? *this : uninterned(*m_name, arena);
+    }
+
+    // Symbols are copied even on move, so that a moved-from symbol keeps its name.
+    AMLSymbol(const AMLSymbol& t) = default;
+    AMLSymbol& operator=(const AMLSymbol& t) = default;
+
+    /**
+     * @fn static size_t internedCount()
+     * @brief       This function returns the number of names interned in the process.
+     * @return      Number of interned names.
+     */
+    static size_t internedCount();
+
+    /**
+     * @fn const std::string& str() const
+     * @brief       This function returns the name of the symbol.
+     * @return      Interned name. It is valid until the process exits.
+     */
+    const std::string& str() const
+    {
+        return *m_name;
+    }
+
+    /**
+     * @fn bool empty() const
+     * @brief       This function returns whether the name of the symbol is empty.
+     * @return      true if the name is empty.
+     */
+    bool empty() const
+    {
+        return m_name->empty();
+    }
+
+    // Interned symbols are equal only if they are identical, and the others are compared by name.
+    bool operator==(const AMLSymbol& t) const
+    {
+        return m_name == t.m_name || ((isCopy() || t.isCopy()) && *m_name == *t.m_name);
+    }
+
+    bool operator!=(const AMLSymbol& t) const
+    {
+        return false == (*this == t);
+    }
+
+    // Symbols are ordered by name, like the keys of AMLData.
+    bool operator<(const AMLSymbol& t) const
+    {
+        return m_name != t.m_name && *m_name < *t.m_name;
+    }
+
+private:
+    friend class AMLSymbolTable;
+
+    /**
+     * @brief       Constructor of the interned symbol, which only AMLSymbolTable of the model calls.
+     * @param       name    [in] Name to be interned.
+     */
+    explicit AMLSymbol(const std::string& name);
+
+    bool isCopy() const
+    {
+        return m_copy || nullptr != m_arena;
+    }
+
+    const std::string*                  m_name;
+    std::shared_ptr<const std::string>  m_copy;     // name of uninterned symbol on the heap
+    AMLArena*                           m_arena;    // arena of m_name, if it is uninterned and placed in an arena
+};
+
+} // namespace AML
+
+#endif // AML_SYMBOL_H_
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef AML_THREAD_POOL_H_
+#define AML_THREAD_POOL_H_
+
+#include <cstddef>
+#include <functional>
+
+namespace AML
+{
+
+/**
+ * @class AMLThreadPool
+ * @brief This class is a pool of threads which run the batch conversions of Representation.
+ *        Each thread has its own queue of tasks, and a thread whose queue is empty steals tasks from the others.
+ *        The thread which calls parallelFor() works on the items as well, instead of just waiting.
+ * @note  The threads are started in the constructor and joined in the destructor.
+ *        parallelFor() can be called from many threads at once, and from the items of another parallelFor().
+ * @see Representation
+ */
+class AMLThreadPool
+{
+public:
+    /**
+     * @brief       Constructor.
+     * @param       concurrency [in] Number of threads which work on the items, including the thread calling parallelFor().
+     *                               0 means the number of cores.
+     * @note        If some threads cannot be started, the pool works with the threads which could be.
+     */
+    explicit AMLThreadPool(size_t concurrency = 0);
+
+    virtual ~AMLThreadPool(void);
+
+    /**
+     * @fn size_t getConcurrency() const
+     * @brief       This function returns the number of threads which work on the items, including the calling thread.
+     * @return      Number of threads.
+     */
+    size_t                          getConcurrency(void) const;
+
+    /**
+     * @fn void parallelFor(size_t count, const std::function<void(size_t)>& fn, size_t concurrency)
+     * @brief       This function calls fn(0) .. fn(count - 1) on the threads of the pool, and returns when all the calls return.
+     *              Items are handed out one by one, so that a slow item does not hold back the others.
+     * @param       count       [in] Number of items.
+     * @param       fn          [in] Function which is called with the index of each item.
+     * @param       concurrency [in] Maximum number of threads which work on the items, including the calling thread.
+     *                               0 means getConcurrency().
+     * @exception   If fn throws, the items after it are skipped and the exception of the first failed item is rethrown
+     *              after all the running calls return.
+     */
+    void                            parallelFor(size_t count, const std::function<void(size_t)>& fn, size_t concurrency = 0);
+
+    /**
+     * @fn AMLThreadPool& getDefault()
+     * @brief       This function returns the pool which is shared in the process. It is sized to the number of cores.
+     * @return      Reference of the default pool. It is created at the first call and is never destroyed.
+     */
+    static AMLThreadPool&           getDefault(void);
+
+private:
+    AMLThreadPool(const AMLThreadPool&);
+    AMLThreadPool& operator=(const AMLThreadPool&);
+
+    class Impl;
+    Impl*                           m_impl;
+};
+
+} // namespace AML
+
+#endif // AML_THREAD_POOL_H_
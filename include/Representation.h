@@ -19,15 +19,58 @@
 #define REPRESENTAITON_H_
 
 #include <string>
+#include <vector>
+#include <memory>
 
 #include "AMLInterface.h"
+#include "AMLException.h"
+#include "AMLThreadPool.h"
+#include "AMLObjectView.h"
+#include "AMLProjection.h"
 
 namespace AML
 {
 
+class AMLMappedFile;
+
+/**
+ *  @class  AMLOutputSink
+ *  @brief  This class is an interface which receives the output of Representation, e.g. a socket or a file of the caller.
+ */
+class AMLOutputSink
+{
+public:
+    virtual ~AMLOutputSink(void) {}
+
+    /**
+     * @fn void write(const char* data, size_t size)
+     * @brief       This function is called with each chunk of the converted data in order, which is valid only during the call.
+     * @param       data [in] Chunk of converted data.
+     * @param       size [in] Size of data.
+     */
+    virtual void write(const char* data, size_t size) = 0;
+};
+
+/**
+ *  @class  ByteLayout
+ *  @brief  This class represents how an ordered list of strings is written in Protobuf byte data.
+ *          Both of them are read by ByteToData().
+ *  @note   Compact layout removes the name and AttributeDataType of each element, so that the size of
+ *          an ordered list is about the size of its strings. It should be used only if all readers are of this version or later.
+ */
+enum class ByteLayout
+{
+    Standard = 0,   // a child 'Attribute' message for each element, which is the same as AML(XML)
+    Compact         // elements in the 'StringArrayValue' field of the parent 'Attribute', which older readers do not understand
+};
+
 /**
  *  @class  Representation
  *  @brief  This class converts between AMLObject, AML(XML) string, AML(Protobuf) byte.
+ *  @note   AML model is not changed after construction and each call keeps its own scratch state,
+ *          so all the const methods can be called from many threads at once on one instance without locking.
+ *          The AMLObject given to a call should not be changed while the call runs,
+ *          and an AMLArena should be used by one thread at a time, as it is not thread-safe.
  *  @see AMLObject
  */
 class Representation
@@ -36,8 +79,23 @@ public:
     /**
      * @brief       Constructor.
      * @param       amlFilePath [in] File path of AML that contains a data model information.
+     * @exception   AMLException If the file cannot be loaded (INVALID_FILE_PATH) or does not have AML model (INVALID_AML_SCHEMA).
+     * @note        The file can be either AML or the compiled model which getCompiledModel() returns.
+     *              The file is memory-mapped and parsed in place. The compiled model is shared by the Representations of
+     *              the same file, so constructing another one while the first is alive does not load the file again.
+     *              The file is loaded again once it has been modified.
      */
     Representation(const std::string amlFilePath);
+
+    /**
+     * @brief       Constructor with AML model in memory.
+     * @param       amlModel    [in] Buffer of AML that contains a data model information, or of the compiled model which
+     *                               getCompiledModel() returns. It is not used after construction.
+     * @param       size        [in] Size of amlModel.
+     * @exception   AMLException If amlModel is not well-formed (INVALID_XML_STR) or does not have AML model (INVALID_AML_SCHEMA),
+     *                           or is a compiled model which is corrupted or written by another version (INVALID_BYTE_STR).
+     */
+    Representation(const char* amlModel, size_t size);
     virtual ~Representation(void);
 
     /**
@@ -49,6 +107,81 @@ public:
      */
     std::string DataToAml(const AMLObject& amlObject) const;
 
+    /**
+     * @fn std::string DataToAml(const AMLObject& amlObject, bool includeModel) const
+     * @brief       This function converts AMLObject to AML(XML) string to match the AML model information which is set by constructor.
+     * @param       amlObject       [in] AMLObject to be converted.
+     * @param       includeModel    [in] If false, <RoleClassLib> and <SystemUnitClassLib> are omitted from the string ("data-only" AML).
+     * @return      AML(XML) string converted from amlObject.
+     * @exception   AMLException If the schema of amlObject does not match to AML model information
+     * @note        "Data-only" AML is for the peer which already has the same AML model, and can be converted back by AmlToData().
+     */
+    std::string DataToAml(const AMLObject& amlObject, bool includeModel) const;
+
+    /**
+     * @fn size_t DataToAml(const AMLObject& amlObject, bool includeModel, std::string& out) const
+     * @brief       This function converts AMLObject to AML(XML) string and appends it to the given buffer.
+     * @param       amlObject       [in] AMLObject to be converted.
+     * @param       includeModel    [in] If false, <RoleClassLib> and <SystemUnitClassLib> are omitted from the string ("data-only" AML).
+     * @param       out             [out] Buffer which AML(XML) string is appended to. Its contents are kept as they were on exception.
+     * @return      Number of bytes appended.
+     * @exception   AMLException If the schema of amlObject does not match to AML model information
+     * @note        The buffer can be reused for every call without allocation once it has grown enough.
+     */
+    size_t DataToAml(const AMLObject& amlObject, bool includeModel, std::string& out) const;
+    size_t DataToAml(const AMLObject& amlObject, bool includeModel, std::vector<char>& out) const;
+
+    /**
+     * @fn size_t DataToAml(const AMLObject& amlObject, bool includeModel, AMLOutputSink& sink) const
+     * @brief       This function converts AMLObject to AML(XML) string and writes it to the given sink in chunks of a few kilobytes,
+     *              without holding the whole string.
+     * @param       amlObject       [in] AMLObject to be converted.
+     * @param       includeModel    [in] If false, <RoleClassLib> and <SystemUnitClassLib> are omitted from the string ("data-only" AML).
+     * @param       sink            [in] Sink which AML(XML) string is written to. Nothing is written on exception.
+     * @return      Number of bytes written.
+     * @exception   AMLException If the schema of amlObject does not match to AML model information
+     */
+    size_t DataToAml(const AMLObject& amlObject, bool includeModel, AMLOutputSink& sink) const;
+
+    /**
+     * @fn size_t estimateAmlSize(const AMLObject& amlObject, bool includeModel) const
+     * @brief       This function returns the size of AML(XML) string of amlObject, to reserve the buffer in advance.
+     * @param       amlObject       [in] AMLObject to be converted.
+     * @param       includeModel    [in] If false, <RoleClassLib> and <SystemUnitClassLib> are omitted from the string ("data-only" AML).
+     * @return      Estimated size. It is exact unless values have characters to be escaped (e.g. '&', '<').
+     * @exception   AMLException If the schema of amlObject does not match to AML model information
+     */
+    size_t estimateAmlSize(const AMLObject& amlObject, bool includeModel) const;
+
+    /**
+     * @fn size_t DataToAml(const std::vector<const AMLObject*>& amlObjects, bool includeModel, std::string& out, size_t concurrency) const
+     * @brief       This function converts AMLObjects to one AML(XML) document which has an <InstanceHierarchy> for each AMLObject,
+     *              and appends it to the given buffer.
+     * @param       amlObjects      [in] AMLObjects to be converted, in the order of <InstanceHierarchy>.
+     * @param       includeModel    [in] If false, <RoleClassLib> and <SystemUnitClassLib> are omitted from the string ("data-only" AML).
+     * @param       out             [out] Buffer which AML(XML) string is appended to. Its contents are kept as they were on exception.
+     * @param       concurrency     [in] Number of threads of the default AMLThreadPool which convert AMLObjects, including the calling thread.
+     *                                   0 means all of them, which is the number of cores.
+     * @return      Number of bytes appended.
+     * @exception   AMLException If any of amlObjects is null or does not match to AML model information.
+     *                           The exception of the first failed AMLObject is thrown.
+     * @note        The header and the model are written once for all AMLObjects.
+     */
+    size_t DataToAml(const std::vector<const AMLObject*>& amlObjects, bool includeModel, std::string& out, size_t concurrency) const;
+
+    /**
+     * @fn void DataToAml(const std::vector<const AMLObject*>& amlObjects, bool includeModel, std::vector<std::string>& amls, size_t concurrency) const
+     * @brief       This function converts each of AMLObjects to AML(XML) string.
+     * @param       amlObjects      [in] AMLObjects to be converted.
+     * @param       includeModel    [in] If false, <RoleClassLib> and <SystemUnitClassLib> are omitted from the string ("data-only" AML).
+     * @param       amls            [out] AML(XML) strings at the same index as amlObjects. It is not changed on exception.
+     * @param       concurrency     [in] Number of threads of the default AMLThreadPool which convert AMLObjects, including the calling thread.
+     *                                   0 means all of them, which is the number of cores.
+     * @exception   AMLException If any of amlObjects is null or does not match to AML model information.
+     *                           The exception of the first failed AMLObject is thrown.
+     */
+    void DataToAml(const std::vector<const AMLObject*>& amlObjects, bool includeModel, std::vector<std::string>& amls, size_t concurrency) const;
+
     /**
      * @fn AMLObject* AmlToData(const std::string& xmlStr) const
      * @brief       This function converts AML(XML) string to AMLObject to match the AML model information which is set by constructor.
@@ -60,14 +193,140 @@ public:
     AMLObject* AmlToData(const std::string& xmlStr) const;
 
     /**
-     * @fn std::string DataToByte(const AMLObject& amlObject) const
+     * @fn AMLObject* AmlToData(const std::string& xmlStr, AMLArena* arena) const
+     * @brief       This function converts AML(XML) string to AMLObject whose AMLData are placed in the given arena.
+     * @param       xmlStr  [in] AML(XML) string to be converted.
+     * @param       arena   [in] AMLArena which AMLData of the result are placed in, or nullptr to use heap.
+     * @return      AMLObject instance converted from AML(XML) string.
+     * @exception   AMLException If the schema of xmlStr does not match to AML model information
+     * @note        AMLObject instance will be allocated and returned, so it should be deleted after use and before the arena is reset.
+     */
+    AMLObject* AmlToData(const std::string& xmlStr, AMLArena* arena) const;
+
+    /**
+     * @fn AMLObject* AmlToData(const char* xmlStr, size_t size) const
+     * @brief       This function converts AML(XML) string in the caller's buffer to AMLObject without copying it.
+     * @param       xmlStr  [in] Buffer of AML(XML) string to be converted. The string ends at size or at the first '\0'.
+     * @param       size    [in] Size of xmlStr.
+     * @return      AMLObject instance converted from AML(XML) string.
+     * @exception   AMLException If the schema of xmlStr does not match to AML model information
+     * @note        The buffer is read in one pass and is not modified, so it can be read-only (e.g. a string literal or a mapped file).
+     *              AMLObject does not refer to the buffer after return.
+     * @note        AMLObject instance will be allocated and returned, so it should be deleted after use.
+     */
+    AMLObject* AmlToData(const char* xmlStr, size_t size) const;
+    AMLObject* AmlToData(const char* xmlStr, size_t size, AMLArena* arena) const;
+
+    /**
+     * @fn AMLObject* AmlToData(const std::string& xmlStr, const AMLProjection& projection) const
+     * @brief       This function converts only the data and keys of AML(XML) string which are selected by the projection.
+     *              The others are skipped without being built, so they are not in the result.
+     * @param       xmlStr      [in] AML(XML) string to be converted.
+     * @param       projection  [in] Data names and key paths to be converted.
+     * @return      AMLObject instance which has the selected data.
+     * @exception   AMLException If the schema of xmlStr does not match to AML model information.
+     *                           The values which are skipped are not checked, but xmlStr is still checked to be well-formed.
+     * @note        AMLObject instance will be allocated and returned, so it should be deleted after use.
+     */
+    AMLObject* AmlToData(const std::string& xmlStr, const AMLProjection& projection) const;
+    AMLObject* AmlToData(const std::string& xmlStr, const AMLProjection& projection, AMLArena* arena) const;
+
+    /**
+     * @fn void AmlToData(const std::vector<std::string>& xmlStrs, std::vector<AMLObject*>& amlObjects, std::vector<ResultCode>& results, AMLThreadPool& pool) const
+     * @brief       This function converts each of AML(XML) strings to AMLObject on the threads of the given pool.
+     * @param       xmlStrs     [in] AML(XML) strings to be converted.
+     * @param       amlObjects  [out] AMLObjects at the same index as xmlStrs. It is nullptr for the string which fails to be converted.
+     * @param       results     [out] Result of each conversion at the same index as xmlStrs. It is NO_ERROR or the code of AMLException
+     *                                which AmlToData(xmlStr) would throw.
+     * @param       pool        [in] AMLThreadPool which runs the conversions.
+     * @note        A failed string does not stop the others. The previous contents of amlObjects and results are replaced, not deleted.
+     * @note        AMLObject instances will be allocated and returned, so they should be deleted after use.
+     */
+    void AmlToData(const std::vector<std::string>& xmlStrs, std::vector<AMLObject*>& amlObjects, std::vector<ResultCode>& results, AMLThreadPool& pool) const;
+
+    /**
+     * @fn void AmlToData(const std::vector<std::string>& xmlStrs, std::vector<AMLObject*>& amlObjects, std::vector<ResultCode>& results) const
+     * @brief       This function converts each of AML(XML) strings to AMLObject on the threads of AMLThreadPool::getDefault().
+     * @see         AmlToData(const std::vector<std::string>&, std::vector<AMLObject*>&, std::vector<ResultCode>&, AMLThreadPool&) const
+     */
+    void AmlToData(const std::vector<std::string>& xmlStrs, std::vector<AMLObject*>& amlObjects, std::vector<ResultCode>& results) const;
+
+    /**
+     * @fn AMLObjectView* AmlToDataView(const std::string& xmlStr) const
+     * @brief       This function converts AML(XML) string to AMLObjectView, which decodes each data at the first access.
+     *              The string is checked to be well-formed and the names of data are read, but no value is decoded.
+     * @param       xmlStr [in] AML(XML) string to be converted. It is copied into AMLObjectView, or moved if it is an rvalue.
+     * @return      AMLObjectView instance over xmlStr.
+     * @exception   AMLException If xmlStr is not well-formed or does not have the event of AML data.
+     *                           The value of a data which does not match to AML model information throws at getData() of its name.
+     * @note        AMLObjectView instance will be allocated and returned, so it should be deleted after use and before Representation.
+     */
+    AMLObjectView* AmlToDataView(const std::string& xmlStr) const;
+    AMLObjectView* AmlToDataView(std::string&& xmlStr) const;
+
+    /**
+     * @fn std::string DataToByte(const AMLObject& amlObject, ByteLayout layout) const
      * @brief       This function converts AMLObject to Protobuf byte data to match the AML model information which is set by constructor.
-     * @param       amlObject [in] AMLObject to be converted.
+     * @param       amlObject   [in] AMLObject to be converted.
+     * @param       layout      [in] Layout of ordered lists in Protobuf byte data.
      * @return      Protobuf byte data(string) converted from amlObject.
      * @exception   AMLException If the schema of amlObject does not match to AML model information
      * @node        If 'disable_protobuf' build option is enabled, this API will be DISABLED and throw AMLException with code 'API_NOT_ENABLED'.
      */
-    std::string DataToByte(const AMLObject& amlObject) const;
+    std::string DataToByte(const AMLObject& amlObject, ByteLayout layout = ByteLayout::Standard) const;
+
+    /**
+     * @fn size_t DataToByte(const AMLObject& amlObject, std::string& out, ByteLayout layout) const
+     * @brief       This function converts AMLObject to Protobuf byte data and appends it to the given buffer.
+     * @param       amlObject   [in] AMLObject to be converted.
+     * @param       out         [out] Buffer which Protobuf byte data is appended to. Its contents are kept as they were on exception.
+     * @param       layout      [in] Layout of ordered lists in Protobuf byte data.
+     * @return      Number of bytes appended.
+     * @exception   AMLException If the schema of amlObject does not match to AML model information
+     * @node        If 'disable_protobuf' build option is enabled, this API will be DISABLED and throw AMLException with code 'API_NOT_ENABLED'.
+     * @note        The buffer can be reused for every call without allocation once it has grown enough.
+     */
+    size_t DataToByte(const AMLObject& amlObject, std::string& out, ByteLayout layout = ByteLayout::Standard) const;
+    size_t DataToByte(const AMLObject& amlObject, std::vector<char>& out, ByteLayout layout = ByteLayout::Standard) const;
+
+    /**
+     * @fn size_t DataToByte(const AMLObject& amlObject, AMLOutputSink& sink, ByteLayout layout) const
+     * @brief       This function converts AMLObject to Protobuf byte data and writes it to the given sink in chunks of a few kilobytes,
+     *              without holding the whole data.
+     * @param       amlObject   [in] AMLObject to be converted.
+     * @param       sink        [in] Sink which Protobuf byte data is written to. Nothing is written on exception.
+     * @param       layout      [in] Layout of ordered lists in Protobuf byte data.
+     * @return      Number of bytes written.
+     * @exception   AMLException If the schema of amlObject does not match to AML model information
+     * @node        If 'disable_protobuf' build option is enabled, this API will be DISABLED and throw AMLException with code 'API_NOT_ENABLED'.
+     */
+    size_t DataToByte(const AMLObject& amlObject, AMLOutputSink& sink, ByteLayout layout = ByteLayout::Standard) const;
+
+    /**
+     * @fn size_t estimateByteSize(const AMLObject& amlObject, ByteLayout layout) const
+     * @brief       This function returns the size of Protobuf byte data of amlObject, to reserve the buffer in advance.
+     * @param       amlObject   [in] AMLObject to be converted.
+     * @param       layout      [in] Layout of ordered lists in Protobuf byte data.
+     * @return      Exact size of Protobuf byte data.
+     * @exception   AMLException If the schema of amlObject does not match to AML model information
+     * @node        If 'disable_protobuf' build option is enabled, this API will be DISABLED and throw AMLException with code 'API_NOT_ENABLED'.
+     */
+    size_t estimateByteSize(const AMLObject& amlObject, ByteLayout layout = ByteLayout::Standard) const;
+
+    /**
+     * @fn void DataToByte(const std::vector<const AMLObject*>& amlObjects, std::vector<std::string>& bytes, size_t concurrency, ByteLayout layout) const
+     * @brief       This function converts each of AMLObjects to Protobuf byte data.
+     * @param       amlObjects      [in] AMLObjects to be converted.
+     * @param       bytes           [out] Protobuf byte data at the same index as amlObjects. It is not changed on exception.
+     * @param       concurrency     [in] Number of threads of the default AMLThreadPool which convert AMLObjects, including the calling thread.
+     *                                   0 means all of them, which is the number of cores.
+     * @param       layout          [in] Layout of ordered lists in Protobuf byte data.
+     * @exception   AMLException If any of amlObjects is null or does not match to AML model information.
+     *                           The exception of the first failed AMLObject is thrown.
+     * @node        If 'disable_protobuf' build option is enabled, this API will be DISABLED and throw AMLException with code 'API_NOT_ENABLED'.
+     */
+    void DataToByte(const std::vector<const AMLObject*>& amlObjects, std::vector<std::string>& bytes, size_t concurrency,
+                    ByteLayout layout = ByteLayout::Standard) const;
 
     /**
      * @fn AMLObject* ByteToData(const std::string& byte) const
@@ -80,6 +339,126 @@ public:
      */
     AMLObject* ByteToData(const std::string& byte) const;
 
+    /**
+     * @fn AMLObject* ByteToData(const std::string& byte, AMLArena* arena) const
+     * @brief       This function converts Protobuf byte data to AMLObject whose AMLData are placed in the given arena.
+     * @param       byte    [in] Protobuf byte data(string) to be converted.
+     * @param       arena   [in] AMLArena which AMLData of the result are placed in, or nullptr to use heap.
+     * @return      AMLObject instance converted from byte.
+     * @exception   AMLException If the schema of byte does not match to AML model information
+     * @node        If 'disable_protobuf' build option is enabled, this API will be DISABLED and throw AMLException with code 'API_NOT_ENABLED'.
+     * @note        AMLObject instance will be allocated and returned, so it should be deleted after use and before the arena is reset.
+     */
+    AMLObject* ByteToData(const std::string& byte, AMLArena* arena) const;
+
+    /**
+     * @fn AMLObject* ByteToData(const char* byte, size_t size) const
+     * @brief       This function converts Protobuf byte data in the caller's buffer to AMLObject without copying it.
+     * @param       byte    [in] Protobuf byte data to be converted.
+     * @param       size    [in] Size of byte.
+     * @return      AMLObject instance converted from byte.
+     * @exception   AMLException If the schema of byte does not match to AML model information
+     * @node        If 'disable_protobuf' build option is enabled, this API will be DISABLED and throw AMLException with code 'API_NOT_ENABLED'.
+     * @note        AMLObject instance will be allocated and returned, so it should be deleted after use.
+     */
+    AMLObject* ByteToData(const char* byte, size_t size) const;
+    AMLObject* ByteToData(const char* byte, size_t size, AMLArena* arena) const;
+
+    /**
+     * @fn AMLObject* ByteToData(const std::string& byte, const AMLProjection& projection) const
+     * @brief       This function converts only the data and keys of Protobuf byte data which are selected by the projection.
+     *              The others are skipped without being decoded, so they are not in the result.
+     * @param       byte        [in] Protobuf byte data(string) to be converted.
+     * @param       projection  [in] Data names and key paths to be converted.
+     * @return      AMLObject instance which has the selected data.
+     * @exception   AMLException If the schema of byte does not match to AML model information.
+     *                           The values which are skipped are not checked, but byte is still validated as a whole.
+     * @node        If 'disable_protobuf' build option is enabled, this API will be DISABLED and throw AMLException with code 'API_NOT_ENABLED'.
+     * @note        AMLObject instance will be allocated and returned, so it should be deleted after use.
+     */
+    AMLObject* ByteToData(const std::string& byte, const AMLProjection& projection) const;
+    AMLObject* ByteToData(const std::string& byte, const AMLProjection& projection, AMLArena* arena) const;
+
+    /**
+     * @fn void ByteToData(const std::vector<std::string>& bytes, std::vector<AMLObject*>& amlObjects, std::vector<ResultCode>& results, AMLThreadPool& pool) const
+     * @brief       This function converts each of Protobuf byte data to AMLObject on the threads of the given pool.
+     * @param       bytes       [in] Protobuf byte data to be converted.
+     * @param       amlObjects  [out] AMLObjects at the same index as bytes. It is nullptr for the byte data which fails to be converted.
+     * @param       results     [out] Result of each conversion at the same index as bytes. It is NO_ERROR or the code of AMLException
+     *                                which ByteToData(byte) would throw.
+     * @param       pool        [in] AMLThreadPool which runs the conversions.
+     * @node        If 'disable_protobuf' build option is enabled, this API will be DISABLED and throw AMLException with code 'API_NOT_ENABLED'.
+     * @note        A failed byte data does not stop the others. The previous contents of amlObjects and results are replaced, not deleted.
+     * @note        AMLObject instances will be allocated and returned, so they should be deleted after use.
+     */
+    void ByteToData(const std::vector<std::string>& bytes, std::vector<AMLObject*>& amlObjects, std::vector<ResultCode>& results, AMLThreadPool& pool) const;
+
+    /**
+     * @fn void ByteToData(const std::vector<std::string>& bytes, std::vector<AMLObject*>& amlObjects, std::vector<ResultCode>& results) const
+     * @brief       This function converts each of Protobuf byte data to AMLObject on the threads of AMLThreadPool::getDefault().
+     * @see         ByteToData(const std::vector<std::string>&, std::vector<AMLObject*>&, std::vector<ResultCode>&, AMLThreadPool&) const
+     */
+    void ByteToData(const std::vector<std::string>& bytes, std::vector<AMLObject*>& amlObjects, std::vector<ResultCode>& results) const;
+
+    /**
+     * @fn AMLObjectView* ByteToDataView(const std::string& byte) const
+     * @brief       This function converts Protobuf byte data to AMLObjectView, which decodes each data at the first access.
+     *              The byte data is validated and the names of data are read, but no value is decoded.
+     * @param       byte [in] Protobuf byte data to be converted. It is copied into AMLObjectView, or moved if it is an rvalue.
+     * @return      AMLObjectView instance over byte.
+     * @exception   AMLException If byte is not valid or does not have the event of AML data.
+     *                           The value of a data which does not match to AML model information throws at getData() of its name.
+     * @node        If 'disable_protobuf' build option is enabled, this API will be DISABLED and throw AMLException with code 'API_NOT_ENABLED'.
+     * @note        AMLObjectView instance will be allocated and returned, so it should be deleted after use and before Representation.
+     */
+    AMLObjectView* ByteToDataView(const std::string& byte) const;
+    AMLObjectView* ByteToDataView(std::string&& byte) const;
+
+    /**
+     * @fn std::string DataToCompactByte(const AMLObject& amlObject) const
+     * @brief       This function converts AMLObject to compact byte data, which has only the hash of the AML model and the values.
+     *              Data and attributes are written as their ordinals in the model instead of the structure of CAEX,
+     *              so the receiver should read it with a Representation of the same model.
+     * @param       amlObject [in] AMLObject to be converted.
+     * @return      Compact byte data converted from amlObject.
+     * @exception   AMLException If the schema of amlObject does not match to AML model information
+     * @note        This API does not depend on Protobuf, so it is enabled with 'disable_protobuf' build option as well.
+     */
+    std::string DataToCompactByte(const AMLObject& amlObject) const;
+
+    /**
+     * @fn size_t DataToCompactByte(const AMLObject& amlObject, std::string& out) const
+     * @brief       This function converts AMLObject to compact byte data and appends it to the given buffer.
+     * @param       amlObject   [in] AMLObject to be converted.
+     * @param       out         [out] Buffer which compact byte data is appended to. Its contents are kept as they were on exception.
+     * @return      Number of bytes appended.
+     * @exception   AMLException If the schema of amlObject does not match to AML model information
+     */
+    size_t DataToCompactByte(const AMLObject& amlObject, std::string& out) const;
+
+    /**
+     * @fn AMLObject* CompactByteToData(const std::string& byte) const
+     * @brief       This function converts compact byte data which DataToCompactByte() has written to AMLObject.
+     * @param       byte    [in] Compact byte data.
+     * @return      AMLObject instance converted from byte.
+     * @exception   AMLException If byte is not valid (INVALID_BYTE_STR) or is written with another AML model (NOT_MATCH_TO_AML_MODEL).
+     * @note        AMLObject instance will be allocated and returned, so it should be deleted after use.
+     */
+    AMLObject* CompactByteToData(const std::string& byte) const;
+
+    /**
+     * @fn AMLObject* CompactByteToData(const char* byte, size_t size) const
+     * @brief       This function converts compact byte data in the caller's buffer to AMLObject without copying it.
+     * @param       byte    [in] Compact byte data.
+     * @param       size    [in] Size of byte.
+     * @return      AMLObject instance converted from byte.
+     * @exception   AMLException If byte is null (INVALID_PARAM), is not valid (INVALID_BYTE_STR)
+     *                           or is written with another AML model (NOT_MATCH_TO_AML_MODEL).
+     * @note        AMLObject instance will be allocated and returned, so it should be deleted after use.
+     */
+    AMLObject* CompactByteToData(const char* byte, size_t size) const;
+    AMLObject* CompactByteToData(const char* byte, size_t size, AMLArena* arena) const;
+
     /**
      * @fn std::string getRepresentationId() const
      * @brief       This function returns AutomationML SystemUnitClassLib's unique ID
@@ -95,9 +474,24 @@ public:
      */
     AMLObject* getConfigInfo() const;
 
+    /**
+     * @fn std::string getCompiledModel() const
+     * @brief       This function returns the compiled AML model as a binary image, which can be saved to a file and
+     *              loaded by the constructors instead of AML, without parsing XML.
+     * @return      Binary image of the compiled model.
+     * @note        The image can be loaded only by the same version of this library which has written it.
+     *              Representation loaded from the image converts in the same way as the one loaded from AML.
+     */
+    std::string getCompiledModel() const;
+
 private:
+    friend class RepresentationRegistry;
+
+    // Loads the file which RepresentationRegistry has mapped, with the model cache of Representation(amlFilePath).
+    Representation(AMLMappedFile& file, const std::string& amlFilePath);
+
     class AMLModel;
-    AMLModel* m_amlModel;
+    std::shared_ptr<const AMLModel> m_amlModel;
 };
 
 } // namespace AML
@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef REPRESENTATION_REGISTRY_H_
+#define REPRESENTATION_REGISTRY_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "Representation.h"
+
+namespace AML
+{
+
+/**
+ * @class RepresentationRegistry
+ * @brief This class keeps one Representation for each AML model file, and hands it out to all the consumers of the model,
+ *        so that the memory and the loading time grow with the number of distinct models, not with the number of consumers.
+ *        A Representation is registered by the path, the stamp (device, inode, size and modification time) and
+ *        the hash of the contents of its file, and stays registered until it is evicted, even if no consumer holds it.
+ *        The contents are hashed only when the stamp has changed.
+ * @note  A Representation can be used from many threads at once, as it is not changed after construction.
+ *        All the methods can be called from many threads at once.
+ * @see Representation
+ */
+class RepresentationRegistry
+{
+public:
+    RepresentationRegistry(void);
+
+    virtual ~RepresentationRegistry(void);
+
+    /**
+     * @fn std::shared_ptr<const Representation> acquire(const std::string& amlFilePath)
+     * @brief       This function returns the registered Representation of the file, or loads and registers it.
+     *              If the contents of the file have changed since it was registered, the file is loaded again and
+     *              the new Representation replaces the old one, which is still valid for the consumers which hold it.
+     *              A file which is touched without change keeps its Representation.
+     * @param       amlFilePath [in] File path of AML that contains a data model information.
+     * @return      Shared Representation of the file.
+     * @exception   AMLException If the file cannot be loaded (INVALID_FILE_PATH) or does not have AML model (INVALID_AML_SCHEMA).
+     * @note        Paths are compared as they are given, so the same file given by different paths is registered for each path.
+     */
+    std::shared_ptr<const Representation>   acquire(const std::string& amlFilePath);
+
+    /**
+     * @fn std::shared_ptr<const Representation> find(const std::string& representationId) const
+     * @brief       This function returns the registered Representation of the given id, without loading any file.
+     * @param       representationId    [in] Id of AML model, which is returned by Representation::getRepresentationId().
+     * @return      Shared Representation, or nullptr if none is registered.
+     *              If the files of more than one path have the same id, the one which was registered last is returned.
+     */
+    std::shared_ptr<const Representation>   find(const std::string& representationId) const;
+
+    /**
+     * @fn size_t getUseCount(const std::string& representationId) const
+     * @brief       This function returns the number of consumers which hold the registered Representations of the given id.
+     * @param       representationId    [in] Id of AML model.
+     * @return      Number of the shared pointers held outside of the registry, or 0 if none is registered.
+     * @note        The count may be changed by other threads right after it is returned.
+     */
+    size_t                                  getUseCount(const std::string& representationId) const;
+
+    /**
+     * @fn bool evict(const std::string& representationId)
+     * @brief       This function removes the Representations of the given id from the registry.
+     *              They are released when the last consumer releases them, and the next acquire() loads the file again.
+     * @param       representationId    [in] Id of AML model.
+     * @return      false if none is registered.
+     */
+    bool                                    evict(const std::string& representationId);
+
+    /**
+     * @fn size_t evictUnused()
+     * @brief       This function removes the Representations which no consumer holds, and releases them.
+     * @return      Number of the removed Representations.
+     */
+    size_t                                  evictUnused(void);
+
+    /**
+     * @fn std::vector<std::string> getRepresentationIds() const
+     * @brief       This function returns the ids of the registered Representations.
+     * @return      Sorted ids without duplicates.
+     */
+    std::vector<std::string>                getRepresentationIds(void) const;
+
+    /**
+     * @fn RepresentationRegistry& getDefault()
+     * @brief       This function returns the registry which is shared in the process.
+     * @return      Reference of the default registry. It is created at the first call and is never destroyed.
+     */
+    static RepresentationRegistry&          getDefault(void);
+
+private:
+    RepresentationRegistry(const RepresentationRegistry&);
+    RepresentationRegistry& operator=(const RepresentationRegistry&);
+
+    class Impl;
+    Impl*                                   m_impl;
+};
+
+} // namespace AML
+
+#endif // REPRESENTATION_REGISTRY_H_
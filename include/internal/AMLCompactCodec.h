@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef AML_COMPACT_CODEC_H_
+#define AML_COMPACT_CODEC_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "AMLInterface.h"
+#include "AMLSchema.h"
+
+namespace AML
+{
+
+/**
+ * @fn uint64_t hashCompactModel(const AMLSchema& schema)
+ * @brief       This function returns the hash of the structure of the model which the compact byte data depends on,
+ *              i.e. the names of SystemUnitClass and the names, kinds and types of their attributes in order.
+ * @param       schema  [in] Compiled SystemUnitClassLib of AML model.
+ * @return      Hash of the model, which is written on every compact byte data to check that the reader has the same model.
+ */
+uint64_t hashCompactModel(const AMLSchema& schema);
+
+/**
+ * @fn size_t serializeToCompact(const AMLSchema& schema, uint64_t modelHash, const AMLObject& amlObject, std::string& binary)
+ * @brief       This function appends the compact byte data of AMLObject, which has the values only.
+ *              The names of data and attributes are written as their ordinals in the model, and nothing of the model is written.
+ * @param       schema      [in] Compiled SystemUnitClassLib of AML model.
+ * @param       modelHash   [in] Hash of schema, which hashCompactModel() returns.
+ * @param       amlObject   [in] AMLObject to be converted.
+ * @param       binary      [out] Buffer which compact byte data is appended to. Its contents are kept as they were on exception.
+ * @return      Number of bytes appended.
+ * @exception   AMLException If the schema of amlObject does not match to AML model information
+ */
+size_t serializeToCompact(const AMLSchema& schema, uint64_t modelHash, const AMLObject& amlObject, std::string& binary);
+
+/**
+ * @fn AMLObject* parseFromCompact(const AMLSchema& schema, uint64_t modelHash, const char* data, size_t size, AMLArena* arena)
+ * @brief       This function reads the compact byte data which serializeToCompact() has written with the same model.
+ * @param       schema      [in] Compiled SystemUnitClassLib of AML model, whose names are used as keys of AMLData.
+ * @param       modelHash   [in] Hash of schema, which hashCompactModel() returns.
+ * @param       data        [in] Compact byte data.
+ * @param       size        [in] Size of data.
+ * @param       arena       [in] AMLArena which AMLData of the result are placed in, or nullptr to use heap.
+ * @return      AMLObject instance converted from data.
+ * @exception   AMLException If data is not valid (INVALID_BYTE_STR) or is written with another model (NOT_MATCH_TO_AML_MODEL).
+ * @note        AMLObject instance will be allocated and returned, so it should be deleted after use.
+ */
+AMLObject* parseFromCompact(const AMLSchema& schema, uint64_t modelHash, const char* data, size_t size, AMLArena* arena);
+
+} // namespace AML
+
+#endif // AML_COMPACT_CODEC_H_
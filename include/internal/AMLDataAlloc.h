@@ -0,0 +1,62 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef AML_DATA_ALLOC_H_
+#define AML_DATA_ALLOC_H_
+
+#include <new>
+
+#include "AMLInterface.h"
+#include "AMLArena.h"
+
+namespace AML
+{
+
+/**
+ * @fn AMLData* newData(AMLArena* arena)
+ * @brief       This function returns an empty AMLData, which is placed in the arena of its owner (AMLObject or AMLData),
+ *              or on the heap if the owner does not have one.
+ * @param       arena   [in] AMLArena of the owner, or nullptr.
+ * @return      AMLData which is deleted by deleteData() with the same arena.
+ * @exception   AMLException If memory cannot be allocated from the arena.
+ */
+inline AMLData* newData(AMLArena* arena)
+{
+    if (nullptr == arena)
+    {
+        return new AMLData();
+    }
+
+    void* memory = arena->allocate(sizeof(AMLData), alignof(AMLData));
+    return new (memory) AMLData(arena);
+}
+
+inline void deleteData(AMLArena* arena, AMLData* data)
+{
+    if (nullptr == arena)
+    {
+        delete data;
+    }
+    else
+    {
+        data->~AMLData(); // memory is freed with the arena
+    }
+}
+
+} // namespace AML
+
+#endif // AML_DATA_ALLOC_H_
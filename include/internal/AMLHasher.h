@@ -15,38 +15,50 @@
  *
  *******************************************************************************/
 
-#ifndef AML_VALUE_H_
-#define AML_VALUE_H_
+#ifndef AML_HASHER_H_
+#define AML_HASHER_H_
 
-#include "AMLInterface.h"
+#include <cstddef>
+#include <cstdint>
 
 namespace AML
 {
 
 /**
- * @class AMLValue_
- * @brief This class have all types of AMLValue data.
- * @see AMLValue
+ * @class AMLHasher
+ * @brief This class computes FNV-1a hash of the bytes which are added.
+ *        The hash only tells whether the bytes have changed, as it is not cryptographic.
  */
-template <typename T>
-class AMLValue_ : public AMLValue
+class AMLHasher
 {
 public:
-    AMLValue_ (AMLValueType t, T val) : AMLValue(t), m_value(val)
+    AMLHasher(void) : m_hash(14695981039346656037ULL)
     {
     }
-    virtual ~AMLValue_ ()
+
+    void                            addByte(unsigned char c)
     {
+        m_hash ^= c;
+        m_hash *= 1099511628211ULL;
     }
 
-    T& getValue()
+    void                            addBytes(const char* data, size_t size)
     {
-        return m_value;
+        for (size_t i = 0; i < size; ++i)
+        {
+            addByte(static_cast<unsigned char>(data[i]));
+        }
     }
+
+    uint64_t                        hash(void) const
+    {
+        return m_hash;
+    }
+
 private:
-    T m_value;
+    uint64_t                        m_hash;
 };
 
 } // namespace AML
 
-#endif // AML_VALUE_H_
\ No newline at end of file
+#endif // AML_HASHER_H_
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef AML_MAPPED_FILE_H_
+#define AML_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <string>
+
+namespace AML
+{
+
+/**
+ * @class AMLMappedFile
+ * @brief This class maps a file into memory as a private copy-on-write region, so that it can be parsed in place.
+ *        Writes into the region are not written back to the file.
+ * @note  The file is read into a heap buffer on the platforms which do not have mmap().
+ */
+class AMLMappedFile
+{
+public:
+    /**
+     * @brief       Constructor.
+     * @param       path    [in] Path of the file to be mapped.
+     * @exception   AMLException If the file cannot be opened or mapped (INVALID_FILE_PATH).
+     */
+    explicit AMLMappedFile(const std::string& path);
+
+    virtual ~AMLMappedFile(void);
+
+    /**
+     * @fn char* data()
+     * @brief       This function returns the contents of the file, which can be changed without changing the file.
+     * @return      Pointer of the contents, or nullptr if the file is empty.
+     */
+    char*                           data(void)
+    {
+        return m_data;
+    }
+
+    /**
+     * @fn size_t size() const
+     * @brief       This function returns the size of the file.
+     * @return      Size of the contents.
+     */
+    size_t                          size(void) const
+    {
+        return m_size;
+    }
+
+    /**
+     * @fn const std::string& stamp() const
+     * @brief       This function returns a string which identifies the file and its version, i.e. its device, inode, size and
+     *              modification time. It is the same for the paths of the same file, and changes when the file is modified.
+     * @return      Stamp of the file, or empty string if the platform cannot identify it.
+     * @note        It is taken from the descriptor which is mapped, so it is the stamp of the mapped contents
+     *              even if the path is replaced meanwhile.
+     */
+    const std::string&              stamp(void) const
+    {
+        return m_stamp;
+    }
+
+private:
+    AMLMappedFile(const AMLMappedFile&);
+    AMLMappedFile& operator=(const AMLMappedFile&);
+
+    char*                           m_data;
+    size_t                          m_size;
+    bool                            m_isMapped;     // m_data is mapped, or allocated with new[]
+    std::string                     m_stamp;
+};
+
+} // namespace AML
+
+#endif // AML_MAPPED_FILE_H_
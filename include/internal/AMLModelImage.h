@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef AML_MODEL_IMAGE_H_
+#define AML_MODEL_IMAGE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace AML
+{
+
+/**
+ * @class AMLImageWriter
+ * @brief This class writes the compiled model, i.e. AMLSchema and the templates of AMLXmlWriter, as a binary image
+ *        which is loaded without parsing XML.
+ *        The image is a header ("AMLMODEL", format version and size of the body) followed by the body, which is
+ *        a sequence of sizes in base-128 varint and of strings prefixed by their size.
+ */
+class AMLImageWriter
+{
+public:
+    AMLImageWriter(void);
+
+    void                            writeSize(size_t value);
+    void                            writeBool(bool value);
+    void                            writeString(const std::string& value);
+
+    /**
+     * @fn std::string finish()
+     * @brief       This function returns the image of the written body with its header.
+     * @return      Binary image.
+     */
+    std::string                     finish(void) const;
+
+private:
+    std::string                     m_body;
+};
+
+/**
+ * @class AMLImageReader
+ * @brief This class reads the binary image which AMLImageWriter has written, in the same order.
+ * @note  Every read is checked against the end of the image, so a truncated or corrupted image throws
+ *        AMLException(INVALID_BYTE_STR) instead of being read out of bounds.
+ */
+class AMLImageReader
+{
+public:
+    /**
+     * @brief       Constructor.
+     * @param       data    [in] Binary image. It should be alive while the reader is used.
+     * @param       size    [in] Size of data.
+     * @exception   AMLException If data is not an image or is written by another format version (INVALID_BYTE_STR).
+     */
+    AMLImageReader(const char* data, size_t size);
+
+    size_t                          readSize(void);
+    bool                            readBool(void);
+    std::string                     readString(void);
+
+    /**
+     * @fn size_t readSize(size_t limit)
+     * @brief       This function reads a size which should be less than limit, e.g. an index or a value of enum.
+     * @exception   AMLException If the size is not less than limit (INVALID_BYTE_STR).
+     */
+    size_t                          readSize(size_t limit);
+
+    /**
+     * @fn size_t readCount()
+     * @brief       This function reads the number of the elements which follow, to resize a container before reading them.
+     * @exception   AMLException If the image is too short for the elements, each of which is at least one byte (INVALID_BYTE_STR).
+     */
+    size_t                          readCount(void);
+
+    /**
+     * @fn void finish() const
+     * @brief       This function checks that the whole image has been read.
+     * @exception   AMLException If the image has trailing bytes (INVALID_BYTE_STR).
+     */
+    void                            finish(void) const;
+
+    /**
+     * @fn bool isImage(const char* data, size_t size)
+     * @brief       This function returns whether data starts with the header of an image, rather than AML(XML).
+     * @param       data    [in] Contents of a model file or buffer.
+     * @param       size    [in] Size of data.
+     * @return      true if data is an image.
+     */
+    static bool                     isImage(const char* data, size_t size);
+
+private:
+    const char*                     m_data;
+    const char*                     m_end;
+};
+
+} // namespace AML
+
+#endif // AML_MODEL_IMAGE_H_
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef AML_OBJECT_VIEW_SOURCE_H_
+#define AML_OBJECT_VIEW_SOURCE_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "AMLObjectView.h"
+#include "AMLArena.h"
+
+namespace AML
+{
+
+/**
+ * @class AMLObjectView::Source
+ * @brief This class is the payload of AMLObjectView, which decodes the data one by one.
+ *        It is implemented for each format by the reader of the format.
+ */
+class AMLObjectView::Source
+{
+public:
+    virtual ~Source(void) {}
+
+    /**
+     * @fn void index(std::string& deviceId, std::string& timeStamp, std::string& id, std::vector<AMLSymbol>& names)
+     * @brief       This function reads the attributes of the event and the names of its data, without decoding their values.
+     * @param       deviceId    [out] Device id of the event.
+     * @param       timeStamp   [out] Timestamp of the event.
+     * @param       id          [out] Id of the event.
+     * @param       names       [out] Names of the data in the order of the payload.
+     * @exception   AMLException If the payload does not have an event.
+     * @note        It is called once, before decodeData().
+     */
+    virtual void index(std::string& deviceId, std::string& timeStamp, std::string& id, std::vector<AMLSymbol>& names) = 0;
+
+    /**
+     * @fn void decodeData(size_t position, AMLArena* arena, AMLData* amlData) const
+     * @brief       This function decodes the value of a data.
+     * @param       position    [in] Position of the data in the names of index().
+     * @param       arena       [in] AMLArena which the value is placed in.
+     * @param       amlData     [out] AMLData which the keys are set to.
+     * @exception   AMLException If the value is not valid AML data.
+     */
+    virtual void decodeData(size_t position, AMLArena* arena, AMLData* amlData) const = 0;
+};
+
+} // namespace AML
+
+#endif // AML_OBJECT_VIEW_SOURCE_H_
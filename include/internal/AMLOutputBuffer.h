@@ -0,0 +1,195 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef AML_OUTPUT_BUFFER_H_
+#define AML_OUTPUT_BUFFER_H_
+
+#include <string.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Representation.h"
+
+namespace AML
+{
+
+/**
+ * @class AMLVectorBuffer
+ * @brief This class appends to std::vector<char> with the members of std::string which the writers use,
+ *        so that the writers which are generic over the output write into the vector directly.
+ */
+class AMLVectorBuffer
+{
+public:
+    explicit AMLVectorBuffer(std::vector<char>& out) : m_out(out) {}
+
+    void                            append(const char* data, size_t size)
+    {
+        m_out.insert(m_out.end(), data, data + size);
+    }
+
+    void                            append(const char* str)
+    {
+        append(str, strlen(str));
+    }
+
+    void                            append(const std::string& str)
+    {
+        append(str.data(), str.size());
+    }
+
+    void                            append(size_t count, char c)
+    {
+        m_out.insert(m_out.end(), count, c);
+    }
+
+    void                            push_back(char c)
+    {
+        m_out.push_back(c);
+    }
+
+private:
+    AMLVectorBuffer(const AMLVectorBuffer&);
+    AMLVectorBuffer& operator=(const AMLVectorBuffer&);
+
+    std::vector<char>&              m_out;
+};
+
+/**
+ * @class AMLSinkBuffer
+ * @brief This class writes to AMLOutputSink in chunks of CHUNK_SIZE bytes, from the buffer which it owns.
+ *        It has the members of std::string which the writers use, and reserve()/commit() for the ones which write in place.
+ * @note  The last chunk, which can be shorter, is kept until flush() is called.
+ */
+class AMLSinkBuffer
+{
+public:
+    static const size_t             CHUNK_SIZE = 4096;
+    static const size_t             MAX_RESERVE = 16;
+
+    explicit AMLSinkBuffer(AMLOutputSink& sink) : m_sink(sink), m_used(0), m_written(0) {}
+
+    void                            append(const char* data, size_t size)
+    {
+        while (size > CHUNK_SIZE - m_used)
+        {
+            size_t part = CHUNK_SIZE - m_used;
+            memcpy(m_chunk + m_used, data, part);
+            m_used = CHUNK_SIZE;
+            flush();
+
+            data += part;
+            size -= part;
+        }
+        memcpy(m_chunk + m_used, data, size);
+        m_used += size;
+    }
+
+    void                            append(const char* str)
+    {
+        append(str, strlen(str));
+    }
+
+    void                            append(const std::string& str)
+    {
+        append(str.data(), str.size());
+    }
+
+    void                            append(size_t count, char c)
+    {
+        for (; 0 != count; --count)
+        {
+            push_back(c);
+        }
+    }
+
+    void                            push_back(char c)
+    {
+        if (CHUNK_SIZE == m_used)
+        {
+            flush();
+        }
+        m_chunk[m_used++] = c;
+    }
+
+    /**
+     * @fn char* reserve()
+     * @brief       This function returns the room of MAX_RESERVE bytes at least, which can run over the end of the chunk.
+     * @return      Start of the room, which is written until commit().
+     */
+    char*                           reserve(void)
+    {
+        return m_chunk + m_used;
+    }
+
+    /**
+     * @fn void commit(const char* end)
+     * @brief       This function ends the bytes which are written from reserve(), and sends the chunk if it is full.
+     * @param       end     [in] End of the written bytes.
+     */
+    void                            commit(const char* end)
+    {
+        m_used = static_cast<size_t>(end - m_chunk);
+        if (m_used > CHUNK_SIZE)
+        {
+            // the bytes over the end are moved to the next chunk
+            size_t rest = m_used - CHUNK_SIZE;
+            m_used = CHUNK_SIZE;
+            flush();
+
+            memcpy(m_chunk, m_chunk + CHUNK_SIZE, rest);
+            m_used = rest;
+        }
+    }
+
+    /**
+     * @fn void flush()
+     * @brief       This function sends the bytes in the chunk to the sink.
+     */
+    void                            flush(void)
+    {
+        if (0 != m_used)
+        {
+            m_sink.write(m_chunk, m_used);
+            m_written += m_used;
+            m_used = 0;
+        }
+    }
+
+    /**
+     * @fn size_t size() const
+     * @brief       This function returns the number of bytes which are appended, including the ones in the chunk.
+     */
+    size_t                          size(void) const
+    {
+        return m_written + m_used;
+    }
+
+private:
+    AMLSinkBuffer(const AMLSinkBuffer&);
+    AMLSinkBuffer& operator=(const AMLSinkBuffer&);
+
+    AMLOutputSink&                  m_sink;
+    size_t                          m_used;         // bytes in m_chunk, which are CHUNK_SIZE or less except in reserve()
+    size_t                          m_written;      // bytes which are sent to m_sink
+    char                            m_chunk[CHUNK_SIZE + MAX_RESERVE];
+};
+
+} // namespace AML
+
+#endif // AML_OUTPUT_BUFFER_H_
@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef AML_PROTO_CODEC_H_
+#define AML_PROTO_CODEC_H_
+
+#ifndef _DISABLE_PROTOBUF_
+
+#include <string>
+#include <vector>
+
+#include "AMLInterface.h"
+#include "Representation.h"
+#include "AMLSchema.h"
+#include "AMLObjectView.h"
+#include "AMLProjection.h"
+
+namespace AML
+{
+
+/**
+ * @fn size_t measureProto(const AMLSchema& schema, const AMLObject& amlObject, ByteLayout layout)
+ * @brief       This function returns the size of 'datamodel::CAEXFile' wire bytes of AMLObject.
+ * @param       schema      [in] Compiled SystemUnitClassLib of AML model.
+ * @param       amlObject   [in] AMLObject to be converted.
+ * @param       layout      [in] Layout of ordered lists.
+ * @return      Size of the bytes which serializeToProto() writes.
+ * @exception   AMLException If the schema of amlObject does not match to AML model information
+ */
+size_t measureProto(const AMLSchema& schema, const AMLObject& amlObject, ByteLayout layout);
+
+/**
+ * @fn size_t serializeToProto(const AMLSchema& schema, const AMLObject& amlObject, ByteLayout layout, std::string& binary)
+ * @brief       This function appends 'datamodel::CAEXFile' wire bytes of AMLObject directly, without building XML document.
+ *              In the standard layout, the bytes are the same as serializing the message which is converted from AML(XML) of amlObject.
+ * @param       schema      [in] Compiled SystemUnitClassLib of AML model.
+ * @param       amlObject   [in] AMLObject to be converted.
+ * @param       layout      [in] Layout of ordered lists.
+ * @param       binary      [out] Buffer which protobuf byte data is appended to.
+ * @return      Number of bytes appended.
+ * @exception   AMLException If the schema of amlObject does not match to AML model information
+ */
+size_t serializeToProto(const AMLSchema& schema, const AMLObject& amlObject, ByteLayout layout, std::string& binary);
+size_t serializeToProto(const AMLSchema& schema, const AMLObject& amlObject, ByteLayout layout, std::vector<char>& binary);
+
+/**
+ * @fn size_t serializeToProto(const AMLSchema& schema, const AMLObject& amlObject, ByteLayout layout, AMLOutputSink& sink)
+ * @brief       This function writes the same bytes to the sink in chunks of AMLSinkBuffer::CHUNK_SIZE bytes.
+ *              AMLObject is measured first, so nothing is written on exception, except the one of the sink.
+ */
+size_t serializeToProto(const AMLSchema& schema, const AMLObject& amlObject, ByteLayout layout, AMLOutputSink& sink);
+
+/**
+ * @fn AMLObject* parseFromProto(const AMLSchema& schema, const char* data, size_t size, const AMLProjection* projection, AMLArena* arena)
+ * @brief       This function reads 'datamodel::CAEXFile' wire bytes into AMLObject directly, without building XML document.
+ *              The result and the exceptions are the same as converting the parsed message through AML(XML).
+ * @param       schema      [in] Compiled SystemUnitClassLib of AML model, whose names are used as keys of AMLData.
+ * @param       data        [in] Protobuf byte data.
+ * @param       size        [in] Size of data.
+ * @param       projection  [in] Data and keys to be decoded, or nullptr for all. The others are skipped without being checked.
+ * @param       arena       [in] AMLArena which AMLData of the result are placed in, or nullptr to use heap.
+ * @return      AMLObject instance converted from data.
+ * @exception   AMLException If data is not a valid 'datamodel::CAEXFile' or does not have valid AML data.
+ * @note        AMLObject instance will be allocated and returned, so it should be deleted after use.
+ */
+AMLObject* parseFromProto(const AMLSchema& schema, const char* data, size_t size, const AMLProjection* projection, AMLArena* arena);
+
+/**
+ * @fn AMLObjectView::Source* newProtoViewSource(const AMLSchema& schema, std::string&& data)
+ * @brief       This function returns the source of AMLObjectView, which decodes each data from 'datamodel::CAEXFile' wire bytes on demand.
+ *              The bytes are validated when AMLObjectView indexes the source.
+ * @param       schema  [in] Compiled SystemUnitClassLib of AML model. It should be valid while the source is used.
+ * @param       data    [in] Protobuf byte data, which is moved into the source.
+ * @return      Source of AMLObjectView.
+ * @note        The source will be allocated and returned, so it should be deleted after use.
+ */
+AMLObjectView::Source* newProtoViewSource(const AMLSchema& schema, std::string&& data);
+
+} // namespace AML
+
+#endif // _DISABLE_PROTOBUF_
+
+#endif // AML_PROTO_CODEC_H_
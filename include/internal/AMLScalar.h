@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef AML_SCALAR_H_
+#define AML_SCALAR_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "AMLInterface.h"
+
+namespace AML
+{
+
+/**
+ * @class ScalarType
+ * @brief This class represent the kind of value which AttributeDataType of an <Attribute> declares.
+ */
+enum class ScalarType
+{
+    String = 0,     // xs:string and any other type, which is not checked
+    Integer,        // xs:long, xs:int, xs:integer, xs:unsignedInt, ...
+    Double,         // xs:double, xs:float, xs:decimal
+    Boolean,        // xs:boolean
+    Base64Binary,   // xs:base64Binary
+    HexBinary       // xs:hexBinary
+};
+
+/**
+ * @fn ScalarType toScalarType(const std::string& attributeDataType)
+ * @brief       This function returns the kind of value of AttributeDataType, whatever the prefix of its namespace is.
+ * @param       attributeDataType   [in] AttributeDataType of <Attribute> (e.g. "xs:long").
+ * @return      Kind of value.
+ */
+ScalarType toScalarType(const std::string& attributeDataType);
+
+/**
+ * @fn AMLValueType getScalarValueType(const AMLData& data, const AMLSymbol& key, ScalarType scalarType)
+ * @brief       This function returns the type of the value of a single value attribute, after checking it against AttributeDataType.
+ *              An integer can be set to an integer or a floating point attribute. String values are not checked.
+ * @param       data        [in] AMLData which has the value.
+ * @param       key         [in] Key of the value, which is the name of the attribute.
+ * @param       scalarType  [in] Kind of value of the attribute.
+ * @return      Type of the typed value, or AMLValueType::String for the other values, which are to be read as strings
+ *              (so that getValueToStr() throws AMLException(WRONG_GETTER_TYPE) for a string array or AMLData).
+ * @exception   AMLException If key does not exist (KEY_NOT_EXIST) or the value does not match AttributeDataType (NOT_MATCH_TO_AML_MODEL).
+ */
+AMLValueType getScalarValueType(const AMLData& data, const AMLSymbol& key, ScalarType scalarType);
+
+/**
+ * @fn AMLValueType getArrayValueType(const AMLData& data, const AMLSymbol& key, ScalarType scalarType)
+ * @brief       This function returns the type of the value of an ordered list attribute, after checking it against AttributeDataType.
+ *              An integer array can be set to an integer or a floating point attribute.
+ * @param       data        [in] AMLData which has the value.
+ * @param       key         [in] Key of the value, which is the name of the attribute.
+ * @param       scalarType  [in] Kind of value of the elements of the attribute.
+ * @return      Type of the numeric array, or AMLValueType::StringArray for the other values, which are to be read as string arrays.
+ * @exception   AMLException If key does not exist (KEY_NOT_EXIST) or the value does not match AttributeDataType (NOT_MATCH_TO_AML_MODEL).
+ */
+AMLValueType getArrayValueType(const AMLData& data, const AMLSymbol& key, ScalarType scalarType);
+
+/**
+ * @fn void appendScalar(const AMLData& data, const AMLSymbol& key, AMLValueType valueType, ScalarType scalarType, Output& out)
+ * @brief       This function appends the lexical form of a typed value of AMLData, which is the text of <Value> in AML.
+ *              The elements of a numeric array are separated by a space.
+ * @param       data        [in] AMLData which has the value.
+ * @param       key         [in] Key of the value.
+ * @param       valueType   [in] Type of the value, which is not String, StringArray or AMLData.
+ * @param       scalarType  [in] Kind of value of the attribute, which selects the encoding of binary.
+ * @param       out         [out] Output which the text is appended to. It does not need to be escaped.
+ * @note        The appenders are instantiated for std::string, AMLVectorBuffer and AMLSinkBuffer.
+ */
+template <typename Output>
+void appendScalar(const AMLData& data, const AMLSymbol& key, AMLValueType valueType, ScalarType scalarType, Output& out);
+
+template <typename Output>
+void appendInt(int64_t value, Output& out);
+
+/**
+ * @fn void appendDouble(double value, Output& out)
+ * @brief       This function appends the shortest text which is parsed back to the same value.
+ *              NaN and infinities are written as in XML schema ("NaN", "INF" and "-INF").
+ */
+template <typename Output>
+void appendDouble(double value, Output& out);
+
+/**
+ * @fn void appendIntList(const std::vector<int64_t>& values, Output& out)
+ * @brief       These functions append the elements separated by a space, which is a list type of XML schema.
+ *              Integers are formatted without snprintf().
+ */
+template <typename Output>
+void appendIntList(const std::vector<int64_t>& values, Output& out);
+template <typename Output>
+void appendDoubleList(const std::vector<double>& values, Output& out);
+
+template <typename Output>
+void appendBool(bool value, Output& out);
+template <typename Output>
+void appendBase64(const std::vector<uint8_t>& value, Output& out);
+template <typename Output>
+void appendHex(const std::vector<uint8_t>& value, Output& out);
+
+/**
+ * @fn bool parseInt(const std::string& text, int64_t& value)
+ * @brief       These functions parse the lexical form of a value in XML schema.
+ *              The whole text should be parsed, without leading or trailing spaces.
+ * @param       text    [in] Text to parse.
+ * @param       value   [out] Parsed value, which is set only on success.
+ * @return      false if the text is not of the type or is out of range.
+ */
+bool parseInt(const std::string& text, int64_t& value);
+bool parseDouble(const std::string& text, double& value);
+bool parseBool(const std::string& text, bool& value);
+
+/**
+ * @fn bool parseIntList(const std::string& text, std::vector<int64_t>& values)
+ * @brief       These functions parse a list type of XML schema, whose elements are separated by white spaces.
+ *              The elements are counted first, so that values is allocated once.
+ * @param       text    [in] Text to parse.
+ * @param       values  [out] Parsed elements, which are set only on success.
+ * @return      false if the text does not have any element or an element is not of the type.
+ */
+bool parseIntList(const std::string& text, std::vector<int64_t>& values);
+bool parseDoubleList(const std::string& text, std::vector<double>& values);
+
+} // namespace AML
+
+#endif // AML_SCALAR_H_
@@ -0,0 +1,238 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef AML_SCHEMA_H_
+#define AML_SCHEMA_H_
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+
+#include "pugixml.hpp"
+
+#include "AMLSymbol.h"
+#include "AMLScalar.h"
+
+namespace AML
+{
+
+class AMLImageWriter;
+class AMLImageReader;
+
+/**
+ * @class AMLSymbolTable
+ * @brief This class interns the names of a model, and finds their symbols without lock.
+ * @note  Interning is restricted to this class, so that names of input data are never interned.
+ */
+class AMLSymbolTable
+{
+public:
+    /**
+     * @fn AMLSymbol intern(const std::string& name)
+     * @brief       This function interns a name of the model.
+     * @param       name    [in] Name of <Attribute> or <SystemUnitClass>.
+     * @return      Interned symbol of name.
+     */
+    AMLSymbol                       intern(const std::string& name);
+
+    /**
+     * @fn AMLSymbol find(const std::string& name, AMLArena* arena) const
+     * @brief       This function returns the symbol of a name.
+     * @param       name    [in] Name to be found.
+     * @param       arena   [in] AMLArena which the copy of name is placed in if it is not in the model, or nullptr to use heap.
+     * @return      Interned symbol if name is in the model, or uninterned symbol otherwise.
+     */
+    AMLSymbol                       find(const std::string& name, AMLArena* arena) const;
+
+private:
+    std::unordered_map<std::string, AMLSymbol> m_symbols;
+};
+
+/**
+ * @class AttributeKind
+ * @brief This class represent how an <Attribute> of SystemUnitClass gets its value from AMLData.
+ */
+enum class AttributeKind
+{
+    String = 0,     // <Value> is filled with AMLData string value
+    StringArray,    // child <Attribute Name="1".."N"> are filled with AMLData string array value (or <Value> with numeric array value)
+    AMLData,        // child <Attribute> are filled with nested AMLData
+    Static,         // copied as it is in the model (e.g. <Description> followed by other nodes)
+    Invalid         // not convertible, AMLException(INVALID_AML_SCHEMA) when it is used
+};
+
+/**
+ * @class AttributeSchema
+ * @brief This class have precompiled information of an <Attribute> in SystemUnitClass.
+ */
+struct AttributeSchema
+{
+    AttributeSchema() : scalarType(ScalarType::String), kind(AttributeKind::Invalid), hasValue(false), hasRefSemantic(false) {}
+
+    std::string                     name;
+    AMLSymbol                       symbol;             // interned name, which is the key of AMLData
+    std::string                     dataType;
+    ScalarType                      scalarType;         // kind of value of dataType, which typed values are checked against
+    AttributeKind                   kind;
+
+    bool                            hasValue;           // <Value> which is already present in the model
+    std::string                     value;
+    bool                            hasRefSemantic;
+    std::string                     correspondingAttributePath;
+
+    std::vector<AttributeSchema>    attributes;
+};
+
+/**
+ * @class InternalElementSchema
+ * @brief This class have precompiled information of a SystemUnitClass to be instantiated as <InternalElement>.
+ */
+struct InternalElementSchema
+{
+    InternalElementSchema() : hasSupportedRoleClass(false) {}
+
+    std::string                         name;
+    AMLSymbol                           symbol;             // interned name, which is the name of AMLData in AMLObject
+    std::string                         refBaseSystemUnitPath;
+    bool                                hasSupportedRoleClass;
+    std::string                         refRoleClassPath;
+
+    std::vector<AttributeSchema>        attributes;
+    std::vector<InternalElementSchema>  internalElements;   // <InternalElement> which is already present in the model
+
+    pugi::xml_node                      node;               // node of the model from which AMLXmlWriter compiles the instance,
+                                                            // which is null after releaseNodes() or if loaded from an image
+};
+
+/**
+ * @class RoleClassSchema
+ * @brief This class have precompiled information of a <RoleClass> in RoleClassLib.
+ */
+struct RoleClassSchema
+{
+    std::string                                         name;
+    std::vector<std::pair<std::string, std::string>>    attributes;     // Name and <Value> of each <Attribute>
+};
+
+/**
+ * @class AMLSchema
+ * @brief This class have SystemUnitClassLib and RoleClassLib of AML model which are compiled once on load.
+ */
+class AMLSchema
+{
+public:
+    /**
+     * @brief       Constructor.
+     * @param       systemUnitClassLib  [in] <SystemUnitClassLib> node of AML model.
+     * @param       roleClassLib        [in] <RoleClassLib> node of AML model.
+     * @note        The nodes are referred to by InternalElementSchema::node, so they should be alive until releaseNodes() is called.
+     */
+    AMLSchema(pugi::xml_node systemUnitClassLib, pugi::xml_node roleClassLib);
+
+    /**
+     * @fn void releaseNodes()
+     * @brief       This function clears InternalElementSchema::node of all the compiled SystemUnitClass,
+     *              so that the document of the model can be destroyed once AMLXmlWriter is compiled.
+     */
+    void                            releaseNodes();
+
+    /**
+     * @brief       Constructor with the image which save() has written.
+     * @param       image   [in] Reader of the image.
+     * @exception   AMLException If the image is corrupted (INVALID_BYTE_STR).
+     * @note        InternalElementSchema::node is null, as the model is not parsed.
+     */
+    explicit AMLSchema(AMLImageReader& image);
+
+    /**
+     * @fn void save(AMLImageWriter& image) const
+     * @brief       This function writes the compiled model to the image, which is loaded by AMLSchema(AMLImageReader&).
+     * @param       image   [in] Writer of the image.
+     */
+    void                            save(AMLImageWriter& image) const;
+
+    /**
+     * @fn std::vector<const AttributeSchema*> getAttributes() const
+     * @brief       This function returns all the compiled attributes, nested ones included, in the order of the image.
+     *              An attribute is referred to by its index in the image, as the loaded schema has the same order.
+     * @return      Compiled attributes.
+     */
+    std::vector<const AttributeSchema*> getAttributes() const;
+
+    /**
+     * @fn const InternalElementSchema* findSystemUnitClass(const std::string& name) const
+     * @brief       This function returns the compiled SystemUnitClass which has the given name.
+     * @param       name    [in] Name of SystemUnitClass.
+     * @return      Compiled SystemUnitClass, or nullptr if it is not present in the model.
+     */
+    const InternalElementSchema*    findSystemUnitClass(const std::string& name) const;
+
+    /**
+     * @fn const std::string& getName() const
+     * @brief       This function returns the name of SystemUnitClassLib.
+     * @return      Name of SystemUnitClassLib.
+     */
+    const std::string&              getName() const;
+
+    /**
+     * @fn const std::vector<std::string>& getSystemUnitClassNames() const
+     * @brief       This function returns the names of all <SystemUnitClass> in the order of the model.
+     * @return      Names of SystemUnitClass.
+     */
+    const std::vector<std::string>& getSystemUnitClassNames() const;
+
+    /**
+     * @fn const RoleClassSchema* findRoleClass(const std::string& name) const
+     * @brief       This function returns the compiled RoleClass which has the given name.
+     * @param       name    [in] Name of RoleClass.
+     * @return      Compiled RoleClass, or nullptr if it is not present in the model.
+     */
+    const RoleClassSchema*          findRoleClass(const std::string& name) const;
+
+    /**
+     * @fn const std::string& getRoleClassLibName() const
+     * @brief       This function returns the name of RoleClassLib.
+     * @return      Name of RoleClassLib.
+     */
+    const std::string&              getRoleClassLibName() const;
+
+    /**
+     * @fn AMLSymbol findSymbol(const std::string& name, AMLArena* arena) const
+     * @brief       This function returns the symbol of a name.
+     * @param       name    [in] Name of <Attribute> or <SystemUnitClass>.
+     * @param       arena   [in] AMLArena which the copy of name is placed in if it is not in the model, or nullptr to use heap.
+     * @return      Interned symbol if name is in the model, or uninterned symbol otherwise.
+     * @note        Names in the model are interned on load and found without lock.
+     *              Other names come from input data, so they are never interned not to grow the symbol table.
+     */
+    AMLSymbol                       findSymbol(const std::string& name, AMLArena* arena = nullptr) const;
+
+private:
+    std::string m_name;
+    std::unordered_map<std::string, InternalElementSchema> m_systemUnitClasses;
+    std::vector<std::string> m_systemUnitClassNames;
+
+    std::string m_roleClassLibName;
+    std::unordered_map<std::string, RoleClassSchema> m_roleClasses;
+
+    AMLSymbolTable m_symbols;
+};
+
+} // namespace AML
+
+#endif // AML_SCHEMA_H_
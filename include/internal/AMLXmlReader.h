@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef AML_XML_READER_H_
+#define AML_XML_READER_H_
+
+#include <cstddef>
+#include <string>
+
+#include "AMLInterface.h"
+#include "AMLSchema.h"
+#include "AMLObjectView.h"
+#include "AMLProjection.h"
+
+namespace AML
+{
+
+/**
+ * @fn AMLObject* parseFromXml(const AMLSchema& schema, const char* xml, size_t size, const AMLProjection* projection, AMLArena* arena)
+ * @brief       This function reads AML(XML) string into AMLObject in one pass, without building XML document.
+ *              Only the elements of <InternalElement Name="Event"> are kept while the others, e.g. the model sections, are skipped.
+ *              The result and the exceptions are the same as converting the XML document which pugixml parses.
+ * @param       schema      [in] Compiled SystemUnitClassLib of AML model, whose names are used as keys of AMLData.
+ * @param       xml         [in] AML(XML) string. It ends at size or at the first '\0'.
+ * @param       size        [in] Size of xml.
+ * @param       projection  [in] Data and keys to be constructed, or nullptr for all. The others are skipped without being checked.
+ * @param       arena       [in] AMLArena which AMLData of the result are placed in, or nullptr to use heap.
+ * @return      AMLObject instance converted from xml.
+ * @exception   AMLException If xml is not well-formed (INVALID_XML_STR) or does not have valid AML data.
+ * @note        AMLObject instance will be allocated and returned, so it should be deleted after use.
+ */
+AMLObject* parseFromXml(const AMLSchema& schema, const char* xml, size_t size, const AMLProjection* projection, AMLArena* arena);
+
+/**
+ * @fn AMLObjectView::Source* newXmlViewSource(const AMLSchema& schema, std::string&& xml)
+ * @brief       This function scans AML(XML) string for AMLObjectView, which decodes each data from the kept elements on demand.
+ * @param       schema  [in] Compiled SystemUnitClassLib of AML model. It should be valid while the source is used.
+ * @param       xml     [in] AML(XML) string, which is moved into the source. It ends at the first '\0'.
+ * @return      Source of AMLObjectView.
+ * @exception   AMLException If xml is not well-formed (INVALID_XML_STR).
+ * @note        The source will be allocated and returned, so it should be deleted after use.
+ */
+AMLObjectView::Source* newXmlViewSource(const AMLSchema& schema, std::string&& xml);
+
+} // namespace AML
+
+#endif // AML_XML_READER_H_
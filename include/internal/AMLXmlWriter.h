@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef AML_XML_WRITER_H_
+#define AML_XML_WRITER_H_
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "pugixml.hpp"
+
+#include "AMLInterface.h"
+#include "AMLSchema.h"
+
+namespace AML
+{
+
+/**
+ * @class XmlTemplateNode
+ * @brief This class is a node of AML(XML) output of a SystemUnitClass instance.
+ *        Static parts of the instance are serialized in advance, and the others are filled from AMLObject on write.
+ */
+struct XmlTemplateNode
+{
+    enum class Type
+    {
+        Static = 0,     // element which is serialized already
+        Text,           // pcdata or cdata which is serialized already
+        Element,        // element which has dynamic children
+        Value,          // <Value> of string value
+        StringArray,    // <Attribute Name="1".."N"> of string array value, or <Value> of numeric array value
+        Invalid,        // AMLException(INVALID_AML_SCHEMA) on write
+        Data            // <InternalElement> of each AMLData in AMLObject (only in "Event")
+    };
+
+    enum class Source
+    {
+        AMLData = 0,
+        DeviceId,
+        TimeStamp,
+        Id
+    };
+
+    XmlTemplateNode() : type(Type::Static), source(Source::AMLData), depth(0), attr(nullptr), hasName(false), hasStaticChild(false) {}
+
+    Type                            type;
+    Source                          source;             // where the value of <Value> comes from
+    unsigned int                    depth;
+
+    std::string                     text;               // Static/Text : serialized text, Element : start tag, StringArray : start tag until Name
+    std::string                     endText;            // Element : end tag, StringArray : start tag after Name until <Value>
+    std::string                     closeText;          // StringArray : from </Value> to end tag
+
+    const AttributeSchema*          attr;               // Element : nested AMLData (if it is not null), Value/StringArray/Invalid : key
+    bool                            hasName;            // StringArray : whether the elements have Name
+    bool                            hasStaticChild;     // Element : whether it has children regardless of AMLObject
+
+    std::vector<XmlTemplateNode>    children;
+};
+
+/**
+ * @class AMLXmlWriter
+ * @brief This class writes AML(XML) string of AMLObject from the templates which are compiled once on load,
+ *        without building XML document. The string is the same as the one saved by pugixml from the document.
+ */
+class AMLXmlWriter
+{
+public:
+    /**
+     * @brief       Constructor.
+     * @param       schema          [in] Compiled SystemUnitClassLib and RoleClassLib of AML model.
+     * @param       roleClassLib    [in] <RoleClassLib> node of AML model.
+     * @param       systemUnitClassLib [in] <SystemUnitClassLib> node of AML model.
+     * @note        The schema should be alive while AMLXmlWriter is used.
+     */
+    AMLXmlWriter(const AMLSchema& schema, pugi::xml_node roleClassLib, pugi::xml_node systemUnitClassLib);
+
+    /**
+     * @brief       Constructor with the image which save() has written.
+     * @param       schema          [in] Compiled SystemUnitClassLib and RoleClassLib which are loaded from the same image.
+     * @param       image           [in] Reader of the image.
+     * @exception   AMLException If the image is corrupted (INVALID_BYTE_STR).
+     * @note        The schema should be alive while AMLXmlWriter is used.
+     */
+    AMLXmlWriter(const AMLSchema& schema, AMLImageReader& image);
+
+    /**
+     * @fn void save(const AMLSchema& schema, AMLImageWriter& image) const
+     * @brief       This function writes the templates to the image, which is loaded by AMLXmlWriter(const AMLSchema&, AMLImageReader&).
+     * @param       schema          [in] Compiled SystemUnitClassLib and RoleClassLib which the templates refer to.
+     * @param       image           [in] Writer of the image.
+     */
+    void save(const AMLSchema& schema, AMLImageWriter& image) const;
+
+    /**
+     * @fn void write(const AMLObject& amlObject, bool includeModel, Output& xml) const
+     * @brief       This function appends AML(XML) string of AMLObject to the given string.
+     * @param       amlObject       [in] AMLObject to be converted.
+     * @param       includeModel    [in] Whether <RoleClassLib> and <SystemUnitClassLib> are written after <InstanceHierarchy>.
+     * @param       xml             [out] String which AML(XML) is appended to, which is std::string, AMLVectorBuffer or AMLSinkBuffer.
+     * @exception   AMLException If the schema of amlObject does not match to AML model information
+     */
+    template <typename Output>
+    void write(const AMLObject& amlObject, bool includeModel, Output& xml) const;
+
+    /**
+     * @fn void writeHeader(Output& xml) const
+     * @brief       This function appends the XML declaration and <CAEXFile> start tag, which write() starts with.
+     * @param       xml             [out] String which AML(XML) is appended to.
+     */
+    template <typename Output>
+    void writeHeader(Output& xml) const;
+
+    /**
+     * @fn void writeInstanceHierarchy(const AMLObject& amlObject, Output& xml) const
+     * @brief       This function appends <InstanceHierarchy> of AMLObject. A document can have one for each AMLObject.
+     * @param       amlObject       [in] AMLObject to be converted.
+     * @param       xml             [out] String which AML(XML) is appended to.
+     * @exception   AMLException If the schema of amlObject does not match to AML model information
+     */
+    template <typename Output>
+    void writeInstanceHierarchy(const AMLObject& amlObject, Output& xml) const;
+
+    /**
+     * @fn void writeFooter(bool includeModel, Output& xml) const
+     * @brief       This function appends the model and <CAEXFile> end tag, which write() ends with.
+     * @param       includeModel    [in] Whether <RoleClassLib> and <SystemUnitClassLib> are written.
+     * @param       xml             [out] String which AML(XML) is appended to.
+     */
+    template <typename Output>
+    void writeFooter(bool includeModel, Output& xml) const;
+
+    /**
+     * @fn size_t estimate(const AMLObject& amlObject, bool includeModel) const
+     * @brief       This function returns the size of AML(XML) string of AMLObject, to reserve the buffer before write().
+     * @param       amlObject       [in] AMLObject to be converted.
+     * @param       includeModel    [in] Whether <RoleClassLib> and <SystemUnitClassLib> are written after <InstanceHierarchy>.
+     * @return      Estimated size. It is exact unless values have characters to be escaped or the model has mixed content.
+     * @exception   AMLException If the schema of amlObject does not match to AML model information, which write() throws as well.
+     *              So it checks amlObject before the output is written in chunks.
+     */
+    size_t estimate(const AMLObject& amlObject, bool includeModel) const;
+
+private:
+    std::string         m_header;           // from XML declaration to <CAEXFile>
+    std::string         m_ihHeader;         // <InstanceHierarchy> start tag
+    std::string         m_model;            // serialized <RoleClassLib> and <SystemUnitClassLib>
+    XmlTemplateNode     m_event;
+    std::unordered_map<std::string, XmlTemplateNode> m_internalElements;
+
+    size_t estimateNode(const XmlTemplateNode& node, const AMLObject& amlObject, const AMLData* amlData) const;
+    template <typename Output>
+    void writeNode(const XmlTemplateNode& node, const AMLObject& amlObject, const AMLData* amlData, unsigned int* flags, Output& xml) const;
+};
+
+} // namespace AML
+
+#endif // AML_XML_WRITER_H_
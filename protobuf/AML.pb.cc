@@ -219,11 +219,25 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_ATTRIBUTE_SECTION
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Attribute, value_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Attribute, refsemantic_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Attribute, attribute_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Attribute, intvalue_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Attribute, doublevalue_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Attribute, boolvalue_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Attribute, binaryvalue_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Attribute, intarrayvalue_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Attribute, doublearrayvalue_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Attribute, stringarrayvalue_),
   0,
   1,
   2,
+  4,
+  ~0u,
+  5,
+  6,
+  7,
   3,
   ~0u,
+  ~0u,
+  ~0u,
 };
 static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
   { 0, 10, sizeof(CAEXFile)},
@@ -235,7 +249,7 @@ static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_ATTR
   { 78, 88, sizeof(InternalElement)},
   { 93, 99, sizeof(SupportedRoleClass)},
   { 100, 106, sizeof(RefSemantic)},
-  { 107, 117, sizeof(Attribute)},
+  { 107, 124, sizeof(Attribute)},
 };
 
 static ::google::protobuf::Message const * const file_default_instances[] = {
@@ -341,15 +355,19 @@ void AddDescriptorsImpl() {
       "\005 \003(\0132\024.datamodel.Attribute\".\n\022Supported"
       "RoleClass\022\030\n\020RefRoleClassPath\030\001 \002(\t\"1\n\013R"
       "efSemantic\022\"\n\032CorrespondingAttributePath"
-      "\030\001 \002(\t\"\231\001\n\tAttribute\022\014\n\004Name\030\001 \002(\t\022\031\n\021At"
+      "\030\001 \002(\t\"\273\002\n\tAttribute\022\014\n\004Name\030\001 \002(\t\022\031\n\021At"
       "tributeDataType\030\002 \002(\t\022\r\n\005Value\030\003 \001(\t\022+\n\013"
       "RefSemantic\030\004 \001(\0132\026.datamodel.RefSemanti"
       "c\022\'\n\tAttribute\030\005 \003(\0132\024.datamodel.Attribu"
-      "teB\'\n\033edge.datamodel.protobuf.amlB\010Proto"
-      "AML"
+      "te\022\020\n\010IntValue\030\006 \001(\022\022\023\n\013DoubleValue\030\007 \001("
+      "\001\022\021\n\tBoolValue\030\010 \001(\010\022\023\n\013BinaryValue\030\t \001("
+      "\014\022\031\n\rIntArrayValue\030\n \003(\022B\002\020\001\022\034\n\020DoubleAr"
+      "rayValue\030\013 \003(\001B\002\020\001\022\030\n\020StringArrayValue\030\014"
+      " \003(\tB\'\n\033edge.datamodel.protobuf.amlB\010Pro"
+      "toAML"
   };
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 1323);
+      descriptor, 1485);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "AML.proto", &protobuf_RegisterTypes);
 }
@@ -5632,6 +5650,13 @@ const int Attribute::kAttributeDataTypeFieldNumber;
 const int Attribute::kValueFieldNumber;
 const int Attribute::kRefSemanticFieldNumber;
 const int Attribute::kAttributeFieldNumber;
+const int Attribute::kIntValueFieldNumber;
+const int Attribute::kDoubleValueFieldNumber;
+const int Attribute::kBoolValueFieldNumber;
+const int Attribute::kBinaryValueFieldNumber;
+const int Attribute::kIntArrayValueFieldNumber;
+const int Attribute::kDoubleArrayValueFieldNumber;
+const int Attribute::kStringArrayValueFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 Attribute::Attribute()
@@ -5647,7 +5672,10 @@ Attribute::Attribute(const Attribute& from)
       _internal_metadata_(NULL),
       _has_bits_(from._has_bits_),
       _cached_size_(0),
-      attribute_(from.attribute_) {
+      attribute_(from.attribute_),
+      intarrayvalue_(from.intarrayvalue_),
+      doublearrayvalue_(from.doublearrayvalue_),
+      stringarrayvalue_(from.stringarrayvalue_) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.has_name()) {
@@ -5661,11 +5689,18 @@ Attribute::Attribute(const Attribute& from)
   if (from.has_value()) {
     value_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.value_);
   }
+  binaryvalue_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_binaryvalue()) {
+    binaryvalue_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.binaryvalue_);
+  }
   if (from.has_refsemantic()) {
     refsemantic_ = new ::datamodel::RefSemantic(*from.refsemantic_);
   } else {
     refsemantic_ = NULL;
   }
+  ::memcpy(&intvalue_, &from.intvalue_,
+    static_cast<size_t>(reinterpret_cast<char*>(&boolvalue_) -
+    reinterpret_cast<char*>(&intvalue_)) + sizeof(boolvalue_));
   // @@protoc_insertion_point(copy_constructor:datamodel.Attribute)
 }
 
@@ -5674,7 +5709,10 @@ void Attribute::SharedCtor() {
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   attributedatatype_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  refsemantic_ = NULL;
+  binaryvalue_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&refsemantic_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&boolvalue_) -
+      reinterpret_cast<char*>(&refsemantic_)) + sizeof(boolvalue_));
 }
 
 Attribute::~Attribute() {
@@ -5686,6 +5724,7 @@ void Attribute::SharedDtor() {
   name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   attributedatatype_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   value_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  binaryvalue_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (this != internal_default_instance()) delete refsemantic_;
 }
 
@@ -5719,8 +5758,11 @@ void Attribute::Clear() {
   (void) cached_has_bits;
 
   attribute_.Clear();
+  intarrayvalue_.Clear();
+  doublearrayvalue_.Clear();
+  stringarrayvalue_.Clear();
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 15u) {
+  if (cached_has_bits & 31u) {
     if (cached_has_bits & 0x00000001u) {
       GOOGLE_DCHECK(!name_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
       (*name_.UnsafeRawStringPointer())->clear();
@@ -5734,10 +5776,19 @@ void Attribute::Clear() {
       (*value_.UnsafeRawStringPointer())->clear();
     }
     if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(!binaryvalue_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+      (*binaryvalue_.UnsafeRawStringPointer())->clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
       GOOGLE_DCHECK(refsemantic_ != NULL);
       refsemantic_->::datamodel::RefSemantic::Clear();
     }
   }
+  if (cached_has_bits & 224u) {
+    ::memset(&intvalue_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&boolvalue_) -
+        reinterpret_cast<char*>(&intvalue_)) + sizeof(boolvalue_));
+  }
   _has_bits_.Clear();
   _internal_metadata_.Clear();
 }
@@ -5824,6 +5875,115 @@ bool Attribute::MergePartialFromCodedStream(
         break;
       }
 
+      // optional sint64 IntValue = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
+          set_has_intvalue();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_SINT64>(
+                 input, &intvalue_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional double DoubleValue = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(57u /* 57 & 0xFF */)) {
+          set_has_doublevalue();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &doublevalue_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional bool BoolValue = 8;
+      case 8: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(64u /* 64 & 0xFF */)) {
+          set_has_boolvalue();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &boolvalue_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional bytes BinaryValue = 9;
+      case 9: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(74u /* 74 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_binaryvalue()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated sint64 IntArrayValue = 10 [packed = true];
+      case 10: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(82u /* 82 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_SINT64>(
+                 input, this->mutable_intarrayvalue())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(80u /* 80 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_SINT64>(
+                 1, 82u, input, this->mutable_intarrayvalue())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated double DoubleArrayValue = 11 [packed = true];
+      case 11: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(90u /* 90 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, this->mutable_doublearrayvalue())));
+        } else if (
+            static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(89u /* 89 & 0xFF */)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 1, 90u, input, this->mutable_doublearrayvalue())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated string StringArrayValue = 12;
+      case 12: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(98u /* 98 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->add_stringarrayvalue()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->stringarrayvalue(this->stringarrayvalue_size() - 1).data(),
+            static_cast<int>(this->stringarrayvalue(this->stringarrayvalue_size() - 1).length()),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "datamodel.Attribute.StringArrayValue");
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -5882,7 +6042,7 @@ void Attribute::SerializeWithCachedSizes(
   }
 
   // optional .datamodel.RefSemantic RefSemantic = 4;
-  if (cached_has_bits & 0x00000008u) {
+  if (cached_has_bits & 0x00000010u) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
       4, *this->refsemantic_, output);
   }
@@ -5894,6 +6054,57 @@ void Attribute::SerializeWithCachedSizes(
       5, this->attribute(static_cast<int>(i)), output);
   }
 
+  // optional sint64 IntValue = 6;
+  if (cached_has_bits & 0x00000020u) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt64(6, this->intvalue(), output);
+  }
+
+  // optional double DoubleValue = 7;
+  if (cached_has_bits & 0x00000040u) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(7, this->doublevalue(), output);
+  }
+
+  // optional bool BoolValue = 8;
+  if (cached_has_bits & 0x00000080u) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(8, this->boolvalue(), output);
+  }
+
+  // optional bytes BinaryValue = 9;
+  if (cached_has_bits & 0x00000008u) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      9, this->binaryvalue(), output);
+  }
+
+  // repeated sint64 IntArrayValue = 10 [packed = true];
+  if (this->intarrayvalue_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(10, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _intarrayvalue_cached_byte_size_));
+  }
+  for (int i = 0, n = this->intarrayvalue_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteSInt64NoTag(
+      this->intarrayvalue(i), output);
+  }
+
+  // repeated double DoubleArrayValue = 11 [packed = true];
+  if (this->doublearrayvalue_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(11, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
+        _doublearrayvalue_cached_byte_size_));
+    ::google::protobuf::internal::WireFormatLite::WriteDoubleArray(
+      this->doublearrayvalue().data(), this->doublearrayvalue_size(), output);
+  }
+
+  // repeated string StringArrayValue = 12;
+  for (int i = 0, n = this->stringarrayvalue_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->stringarrayvalue(i).data(), static_cast<int>(this->stringarrayvalue(i).length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "datamodel.Attribute.StringArrayValue");
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      12, this->stringarrayvalue(i), output);
+  }
+
   if (_internal_metadata_.have_unknown_fields()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         _internal_metadata_.unknown_fields(), output);
@@ -5943,7 +6154,7 @@ void Attribute::SerializeWithCachedSizes(
   }
 
   // optional .datamodel.RefSemantic RefSemantic = 4;
-  if (cached_has_bits & 0x00000008u) {
+  if (cached_has_bits & 0x00000010u) {
     target = ::google::protobuf::internal::WireFormatLite::
       InternalWriteMessageNoVirtualToArray(
         4, *this->refsemantic_, deterministic, target);
@@ -5957,6 +6168,64 @@ void Attribute::SerializeWithCachedSizes(
         5, this->attribute(static_cast<int>(i)), deterministic, target);
   }
 
+  // optional sint64 IntValue = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteSInt64ToArray(6, this->intvalue(), target);
+  }
+
+  // optional double DoubleValue = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(7, this->doublevalue(), target);
+  }
+
+  // optional bool BoolValue = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(8, this->boolvalue(), target);
+  }
+
+  // optional bytes BinaryValue = 9;
+  if (cached_has_bits & 0x00000008u) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        9, this->binaryvalue(), target);
+  }
+
+  // repeated sint64 IntArrayValue = 10 [packed = true];
+  if (this->intarrayvalue_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      10,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      static_cast< ::google::protobuf::uint32>(
+          _intarrayvalue_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteSInt64NoTagToArray(this->intarrayvalue_, target);
+  }
+
+  // repeated double DoubleArrayValue = 11 [packed = true];
+  if (this->doublearrayvalue_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      11,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+      static_cast< ::google::protobuf::uint32>(
+          _doublearrayvalue_cached_byte_size_), target);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteDoubleNoTagToArray(this->doublearrayvalue_, target);
+  }
+
+  // repeated string StringArrayValue = 12;
+  for (int i = 0, n = this->stringarrayvalue_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->stringarrayvalue(i).data(), static_cast<int>(this->stringarrayvalue(i).length()),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "datamodel.Attribute.StringArrayValue");
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(12, this->stringarrayvalue(i), target);
+  }
+
   if (_internal_metadata_.have_unknown_fields()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields(), target);
@@ -6019,7 +6288,47 @@ size_t Attribute::ByteSizeLong() const {
     }
   }
 
-  if (_has_bits_[0 / 32] & 12u) {
+  // repeated sint64 IntArrayValue = 10 [packed = true];
+  {
+    size_t data_size = ::google::protobuf::internal::WireFormatLite::
+      SInt64Size(this->intarrayvalue_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _intarrayvalue_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // repeated double DoubleArrayValue = 11 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->doublearrayvalue_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+            static_cast< ::google::protobuf::int32>(data_size));
+    }
+    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _doublearrayvalue_cached_byte_size_ = cached_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // repeated string StringArrayValue = 12;
+  total_size += 1 *
+      ::google::protobuf::internal::FromIntSize(this->stringarrayvalue_size());
+  for (int i = 0, n = this->stringarrayvalue_size(); i < n; i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->stringarrayvalue(i));
+  }
+
+  if (_has_bits_[0 / 32] & 252u) {
     // optional string Value = 3;
     if (has_value()) {
       total_size += 1 +
@@ -6027,6 +6336,13 @@ size_t Attribute::ByteSizeLong() const {
           this->value());
     }
 
+    // optional bytes BinaryValue = 9;
+    if (has_binaryvalue()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->binaryvalue());
+    }
+
     // optional .datamodel.RefSemantic RefSemantic = 4;
     if (has_refsemantic()) {
       total_size += 1 +
@@ -6034,6 +6350,23 @@ size_t Attribute::ByteSizeLong() const {
           *this->refsemantic_);
     }
 
+    // optional sint64 IntValue = 6;
+    if (has_intvalue()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::SInt64Size(
+          this->intvalue());
+    }
+
+    // optional double DoubleValue = 7;
+    if (has_doublevalue()) {
+      total_size += 1 + 8;
+    }
+
+    // optional bool BoolValue = 8;
+    if (has_boolvalue()) {
+      total_size += 1 + 1;
+    }
+
   }
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
@@ -6065,8 +6398,11 @@ void Attribute::MergeFrom(const Attribute& from) {
   (void) cached_has_bits;
 
   attribute_.MergeFrom(from.attribute_);
+  intarrayvalue_.MergeFrom(from.intarrayvalue_);
+  doublearrayvalue_.MergeFrom(from.doublearrayvalue_);
+  stringarrayvalue_.MergeFrom(from.stringarrayvalue_);
   cached_has_bits = from._has_bits_[0];
-  if (cached_has_bits & 15u) {
+  if (cached_has_bits & 255u) {
     if (cached_has_bits & 0x00000001u) {
       set_has_name();
       name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
@@ -6080,8 +6416,22 @@ void Attribute::MergeFrom(const Attribute& from) {
       value_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.value_);
     }
     if (cached_has_bits & 0x00000008u) {
+      set_has_binaryvalue();
+      binaryvalue_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.binaryvalue_);
+    }
+    if (cached_has_bits & 0x00000010u) {
       mutable_refsemantic()->::datamodel::RefSemantic::MergeFrom(from.refsemantic());
     }
+    if (cached_has_bits & 0x00000020u) {
+      intvalue_ = from.intvalue_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      doublevalue_ = from.doublevalue_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      boolvalue_ = from.boolvalue_;
+    }
+    _has_bits_[0] |= cached_has_bits;
   }
 }
 
@@ -6115,10 +6465,17 @@ void Attribute::Swap(Attribute* other) {
 void Attribute::InternalSwap(Attribute* other) {
   using std::swap;
   attribute_.InternalSwap(&other->attribute_);
+  intarrayvalue_.InternalSwap(&other->intarrayvalue_);
+  doublearrayvalue_.InternalSwap(&other->doublearrayvalue_);
+  stringarrayvalue_.InternalSwap(&other->stringarrayvalue_);
   name_.Swap(&other->name_);
   attributedatatype_.Swap(&other->attributedatatype_);
   value_.Swap(&other->value_);
+  binaryvalue_.Swap(&other->binaryvalue_);
   swap(refsemantic_, other->refsemantic_);
+  swap(intvalue_, other->intvalue_);
+  swap(doublevalue_, other->doublevalue_);
+  swap(boolvalue_, other->boolvalue_);
   swap(_has_bits_[0], other->_has_bits_[0]);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
@@ -6323,13 +6680,13 @@ void Attribute::set_allocated_value(::std::string* value) {
 
 // optional .datamodel.RefSemantic RefSemantic = 4;
 bool Attribute::has_refsemantic() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return (_has_bits_[0] & 0x00000010u) != 0;
 }
 void Attribute::set_has_refsemantic() {
-  _has_bits_[0] |= 0x00000008u;
+  _has_bits_[0] |= 0x00000010u;
 }
 void Attribute::clear_has_refsemantic() {
-  _has_bits_[0] &= ~0x00000008u;
+  _has_bits_[0] &= ~0x00000010u;
 }
 void Attribute::clear_refsemantic() {
   if (refsemantic_ != NULL) refsemantic_->::datamodel::RefSemantic::Clear();
@@ -6397,6 +6754,270 @@ Attribute::attribute() const {
   return attribute_;
 }
 
+// optional sint64 IntValue = 6;
+bool Attribute::has_intvalue() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+void Attribute::set_has_intvalue() {
+  _has_bits_[0] |= 0x00000020u;
+}
+void Attribute::clear_has_intvalue() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+void Attribute::clear_intvalue() {
+  intvalue_ = GOOGLE_LONGLONG(0);
+  clear_has_intvalue();
+}
+::google::protobuf::int64 Attribute::intvalue() const {
+  // @@protoc_insertion_point(field_get:datamodel.Attribute.IntValue)
+  return intvalue_;
+}
+void Attribute::set_intvalue(::google::protobuf::int64 value) {
+  set_has_intvalue();
+  intvalue_ = value;
+  // @@protoc_insertion_point(field_set:datamodel.Attribute.IntValue)
+}
+
+// optional double DoubleValue = 7;
+bool Attribute::has_doublevalue() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+void Attribute::set_has_doublevalue() {
+  _has_bits_[0] |= 0x00000040u;
+}
+void Attribute::clear_has_doublevalue() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+void Attribute::clear_doublevalue() {
+  doublevalue_ = 0;
+  clear_has_doublevalue();
+}
+double Attribute::doublevalue() const {
+  // @@protoc_insertion_point(field_get:datamodel.Attribute.DoubleValue)
+  return doublevalue_;
+}
+void Attribute::set_doublevalue(double value) {
+  set_has_doublevalue();
+  doublevalue_ = value;
+  // @@protoc_insertion_point(field_set:datamodel.Attribute.DoubleValue)
+}
+
+// optional bool BoolValue = 8;
+bool Attribute::has_boolvalue() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
+}
+void Attribute::set_has_boolvalue() {
+  _has_bits_[0] |= 0x00000080u;
+}
+void Attribute::clear_has_boolvalue() {
+  _has_bits_[0] &= ~0x00000080u;
+}
+void Attribute::clear_boolvalue() {
+  boolvalue_ = false;
+  clear_has_boolvalue();
+}
+bool Attribute::boolvalue() const {
+  // @@protoc_insertion_point(field_get:datamodel.Attribute.BoolValue)
+  return boolvalue_;
+}
+void Attribute::set_boolvalue(bool value) {
+  set_has_boolvalue();
+  boolvalue_ = value;
+  // @@protoc_insertion_point(field_set:datamodel.Attribute.BoolValue)
+}
+
+// optional bytes BinaryValue = 9;
+bool Attribute::has_binaryvalue() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+void Attribute::set_has_binaryvalue() {
+  _has_bits_[0] |= 0x00000008u;
+}
+void Attribute::clear_has_binaryvalue() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+void Attribute::clear_binaryvalue() {
+  binaryvalue_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clear_has_binaryvalue();
+}
+const ::std::string& Attribute::binaryvalue() const {
+  // @@protoc_insertion_point(field_get:datamodel.Attribute.BinaryValue)
+  return binaryvalue_.GetNoArena();
+}
+void Attribute::set_binaryvalue(const ::std::string& value) {
+  set_has_binaryvalue();
+  binaryvalue_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:datamodel.Attribute.BinaryValue)
+}
+#if LANG_CXX11
+void Attribute::set_binaryvalue(::std::string&& value) {
+  set_has_binaryvalue();
+  binaryvalue_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:datamodel.Attribute.BinaryValue)
+}
+#endif
+void Attribute::set_binaryvalue(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  set_has_binaryvalue();
+  binaryvalue_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:datamodel.Attribute.BinaryValue)
+}
+void Attribute::set_binaryvalue(const void* value, size_t size) {
+  set_has_binaryvalue();
+  binaryvalue_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:datamodel.Attribute.BinaryValue)
+}
+::std::string* Attribute::mutable_binaryvalue() {
+  set_has_binaryvalue();
+  // @@protoc_insertion_point(field_mutable:datamodel.Attribute.BinaryValue)
+  return binaryvalue_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* Attribute::release_binaryvalue() {
+  // @@protoc_insertion_point(field_release:datamodel.Attribute.BinaryValue)
+  clear_has_binaryvalue();
+  return binaryvalue_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void Attribute::set_allocated_binaryvalue(::std::string* binaryvalue) {
+  if (binaryvalue != NULL) {
+    set_has_binaryvalue();
+  } else {
+    clear_has_binaryvalue();
+  }
+  binaryvalue_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), binaryvalue);
+  // @@protoc_insertion_point(field_set_allocated:datamodel.Attribute.BinaryValue)
+}
+
+// repeated sint64 IntArrayValue = 10 [packed = true];
+int Attribute::intarrayvalue_size() const {
+  return intarrayvalue_.size();
+}
+void Attribute::clear_intarrayvalue() {
+  intarrayvalue_.Clear();
+}
+::google::protobuf::int64 Attribute::intarrayvalue(int index) const {
+  // @@protoc_insertion_point(field_get:datamodel.Attribute.IntArrayValue)
+  return intarrayvalue_.Get(index);
+}
+void Attribute::set_intarrayvalue(int index, ::google::protobuf::int64 value) {
+  intarrayvalue_.Set(index, value);
+  // @@protoc_insertion_point(field_set:datamodel.Attribute.IntArrayValue)
+}
+void Attribute::add_intarrayvalue(::google::protobuf::int64 value) {
+  intarrayvalue_.Add(value);
+  // @@protoc_insertion_point(field_add:datamodel.Attribute.IntArrayValue)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+Attribute::intarrayvalue() const {
+  // @@protoc_insertion_point(field_list:datamodel.Attribute.IntArrayValue)
+  return intarrayvalue_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+Attribute::mutable_intarrayvalue() {
+  // @@protoc_insertion_point(field_mutable_list:datamodel.Attribute.IntArrayValue)
+  return &intarrayvalue_;
+}
+
+// repeated double DoubleArrayValue = 11 [packed = true];
+int Attribute::doublearrayvalue_size() const {
+  return doublearrayvalue_.size();
+}
+void Attribute::clear_doublearrayvalue() {
+  doublearrayvalue_.Clear();
+}
+double Attribute::doublearrayvalue(int index) const {
+  // @@protoc_insertion_point(field_get:datamodel.Attribute.DoubleArrayValue)
+  return doublearrayvalue_.Get(index);
+}
+void Attribute::set_doublearrayvalue(int index, double value) {
+  doublearrayvalue_.Set(index, value);
+  // @@protoc_insertion_point(field_set:datamodel.Attribute.DoubleArrayValue)
+}
+void Attribute::add_doublearrayvalue(double value) {
+  doublearrayvalue_.Add(value);
+  // @@protoc_insertion_point(field_add:datamodel.Attribute.DoubleArrayValue)
+}
+const ::google::protobuf::RepeatedField< double >&
+Attribute::doublearrayvalue() const {
+  // @@protoc_insertion_point(field_list:datamodel.Attribute.DoubleArrayValue)
+  return doublearrayvalue_;
+}
+::google::protobuf::RepeatedField< double >*
+Attribute::mutable_doublearrayvalue() {
+  // @@protoc_insertion_point(field_mutable_list:datamodel.Attribute.DoubleArrayValue)
+  return &doublearrayvalue_;
+}
+
+// repeated string StringArrayValue = 12;
+int Attribute::stringarrayvalue_size() const {
+  return stringarrayvalue_.size();
+}
+void Attribute::clear_stringarrayvalue() {
+  stringarrayvalue_.Clear();
+}
+const ::std::string& Attribute::stringarrayvalue(int index) const {
+  // @@protoc_insertion_point(field_get:datamodel.Attribute.StringArrayValue)
+  return stringarrayvalue_.Get(index);
+}
+::std::string* Attribute::mutable_stringarrayvalue(int index) {
+  // @@protoc_insertion_point(field_mutable:datamodel.Attribute.StringArrayValue)
+  return stringarrayvalue_.Mutable(index);
+}
+void Attribute::set_stringarrayvalue(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:datamodel.Attribute.StringArrayValue)
+  stringarrayvalue_.Mutable(index)->assign(value);
+}
+#if LANG_CXX11
+void Attribute::set_stringarrayvalue(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:datamodel.Attribute.StringArrayValue)
+  stringarrayvalue_.Mutable(index)->assign(std::move(value));
+}
+#endif
+void Attribute::set_stringarrayvalue(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  stringarrayvalue_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:datamodel.Attribute.StringArrayValue)
+}
+void Attribute::set_stringarrayvalue(int index, const char* value, size_t size) {
+  stringarrayvalue_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:datamodel.Attribute.StringArrayValue)
+}
+::std::string* Attribute::add_stringarrayvalue() {
+  // @@protoc_insertion_point(field_add_mutable:datamodel.Attribute.StringArrayValue)
+  return stringarrayvalue_.Add();
+}
+void Attribute::add_stringarrayvalue(const ::std::string& value) {
+  stringarrayvalue_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:datamodel.Attribute.StringArrayValue)
+}
+#if LANG_CXX11
+void Attribute::add_stringarrayvalue(::std::string&& value) {
+  stringarrayvalue_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:datamodel.Attribute.StringArrayValue)
+}
+#endif
+void Attribute::add_stringarrayvalue(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  stringarrayvalue_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:datamodel.Attribute.StringArrayValue)
+}
+void Attribute::add_stringarrayvalue(const char* value, size_t size) {
+  stringarrayvalue_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:datamodel.Attribute.StringArrayValue)
+}
+const ::google::protobuf::RepeatedPtrField< ::std::string>&
+Attribute::stringarrayvalue() const {
+  // @@protoc_insertion_point(field_list:datamodel.Attribute.StringArrayValue)
+  return stringarrayvalue_;
+}
+::google::protobuf::RepeatedPtrField< ::std::string>*
+Attribute::mutable_stringarrayvalue() {
+  // @@protoc_insertion_point(field_mutable_list:datamodel.Attribute.StringArrayValue)
+  return &stringarrayvalue_;
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // @@protoc_insertion_point(namespace_scope)
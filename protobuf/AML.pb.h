@@ -1568,6 +1568,52 @@ class Attribute : public ::google::protobuf::Message /* @@protoc_insertion_point
   const ::google::protobuf::RepeatedPtrField< ::datamodel::Attribute >&
       attribute() const;
 
+  // repeated sint64 IntArrayValue = 10 [packed = true];
+  int intarrayvalue_size() const;
+  void clear_intarrayvalue();
+  static const int kIntArrayValueFieldNumber = 10;
+  ::google::protobuf::int64 intarrayvalue(int index) const;
+  void set_intarrayvalue(int index, ::google::protobuf::int64 value);
+  void add_intarrayvalue(::google::protobuf::int64 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      intarrayvalue() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_intarrayvalue();
+
+  // repeated double DoubleArrayValue = 11 [packed = true];
+  int doublearrayvalue_size() const;
+  void clear_doublearrayvalue();
+  static const int kDoubleArrayValueFieldNumber = 11;
+  double doublearrayvalue(int index) const;
+  void set_doublearrayvalue(int index, double value);
+  void add_doublearrayvalue(double value);
+  const ::google::protobuf::RepeatedField< double >&
+      doublearrayvalue() const;
+  ::google::protobuf::RepeatedField< double >*
+      mutable_doublearrayvalue();
+
+  // repeated string StringArrayValue = 12;
+  int stringarrayvalue_size() const;
+  void clear_stringarrayvalue();
+  static const int kStringArrayValueFieldNumber = 12;
+  const ::std::string& stringarrayvalue(int index) const;
+  ::std::string* mutable_stringarrayvalue(int index);
+  void set_stringarrayvalue(int index, const ::std::string& value);
+  #if LANG_CXX11
+  void set_stringarrayvalue(int index, ::std::string&& value);
+  #endif
+  void set_stringarrayvalue(int index, const char* value);
+  void set_stringarrayvalue(int index, const char* value, size_t size);
+  ::std::string* add_stringarrayvalue();
+  void add_stringarrayvalue(const ::std::string& value);
+  #if LANG_CXX11
+  void add_stringarrayvalue(::std::string&& value);
+  #endif
+  void add_stringarrayvalue(const char* value);
+  void add_stringarrayvalue(const char* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& stringarrayvalue() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_stringarrayvalue();
+
   // required string Name = 1;
   bool has_name() const;
   void clear_name();
@@ -1613,6 +1659,21 @@ class Attribute : public ::google::protobuf::Message /* @@protoc_insertion_point
   ::std::string* release_value();
   void set_allocated_value(::std::string* value);
 
+  // optional bytes BinaryValue = 9;
+  bool has_binaryvalue() const;
+  void clear_binaryvalue();
+  static const int kBinaryValueFieldNumber = 9;
+  const ::std::string& binaryvalue() const;
+  void set_binaryvalue(const ::std::string& value);
+  #if LANG_CXX11
+  void set_binaryvalue(::std::string&& value);
+  #endif
+  void set_binaryvalue(const char* value);
+  void set_binaryvalue(const void* value, size_t size);
+  ::std::string* mutable_binaryvalue();
+  ::std::string* release_binaryvalue();
+  void set_allocated_binaryvalue(::std::string* binaryvalue);
+
   // optional .datamodel.RefSemantic RefSemantic = 4;
   bool has_refsemantic() const;
   void clear_refsemantic();
@@ -1622,6 +1683,27 @@ class Attribute : public ::google::protobuf::Message /* @@protoc_insertion_point
   ::datamodel::RefSemantic* release_refsemantic();
   void set_allocated_refsemantic(::datamodel::RefSemantic* refsemantic);
 
+  // optional sint64 IntValue = 6;
+  bool has_intvalue() const;
+  void clear_intvalue();
+  static const int kIntValueFieldNumber = 6;
+  ::google::protobuf::int64 intvalue() const;
+  void set_intvalue(::google::protobuf::int64 value);
+
+  // optional double DoubleValue = 7;
+  bool has_doublevalue() const;
+  void clear_doublevalue();
+  static const int kDoubleValueFieldNumber = 7;
+  double doublevalue() const;
+  void set_doublevalue(double value);
+
+  // optional bool BoolValue = 8;
+  bool has_boolvalue() const;
+  void clear_boolvalue();
+  static const int kBoolValueFieldNumber = 8;
+  bool boolvalue() const;
+  void set_boolvalue(bool value);
+
   // @@protoc_insertion_point(class_scope:datamodel.Attribute)
  private:
   void set_has_name();
@@ -1632,6 +1714,14 @@ class Attribute : public ::google::protobuf::Message /* @@protoc_insertion_point
   void clear_has_value();
   void set_has_refsemantic();
   void clear_has_refsemantic();
+  void set_has_intvalue();
+  void clear_has_intvalue();
+  void set_has_doublevalue();
+  void clear_has_doublevalue();
+  void set_has_boolvalue();
+  void clear_has_boolvalue();
+  void set_has_binaryvalue();
+  void clear_has_binaryvalue();
 
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
@@ -1640,10 +1730,19 @@ class Attribute : public ::google::protobuf::Message /* @@protoc_insertion_point
   ::google::protobuf::internal::HasBits<1> _has_bits_;
   mutable int _cached_size_;
   ::google::protobuf::RepeatedPtrField< ::datamodel::Attribute > attribute_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > intarrayvalue_;
+  mutable int _intarrayvalue_cached_byte_size_;
+  ::google::protobuf::RepeatedField< double > doublearrayvalue_;
+  mutable int _doublearrayvalue_cached_byte_size_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> stringarrayvalue_;
   ::google::protobuf::internal::ArenaStringPtr name_;
   ::google::protobuf::internal::ArenaStringPtr attributedatatype_;
   ::google::protobuf::internal::ArenaStringPtr value_;
+  ::google::protobuf::internal::ArenaStringPtr binaryvalue_;
   ::datamodel::RefSemantic* refsemantic_;
+  ::google::protobuf::int64 intvalue_;
+  double doublevalue_;
+  bool boolvalue_;
   friend struct protobuf_AML_2eproto::TableStruct;
 };
 // ===================================================================
@@ -3507,13 +3606,13 @@ inline void Attribute::set_allocated_value(::std::string* value) {
 
 // optional .datamodel.RefSemantic RefSemantic = 4;
 inline bool Attribute::has_refsemantic() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return (_has_bits_[0] & 0x00000010u) != 0;
 }
 inline void Attribute::set_has_refsemantic() {
-  _has_bits_[0] |= 0x00000008u;
+  _has_bits_[0] |= 0x00000010u;
 }
 inline void Attribute::clear_has_refsemantic() {
-  _has_bits_[0] &= ~0x00000008u;
+  _has_bits_[0] &= ~0x00000010u;
 }
 inline void Attribute::clear_refsemantic() {
   if (refsemantic_ != NULL) refsemantic_->::datamodel::RefSemantic::Clear();
@@ -3581,6 +3680,271 @@ Attribute::attribute() const {
   return attribute_;
 }
 
+// optional sint64 IntValue = 6;
+inline bool Attribute::has_intvalue() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void Attribute::set_has_intvalue() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void Attribute::clear_has_intvalue() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void Attribute::clear_intvalue() {
+  intvalue_ = GOOGLE_LONGLONG(0);
+  clear_has_intvalue();
+}
+inline ::google::protobuf::int64 Attribute::intvalue() const {
+  // @@protoc_insertion_point(field_get:datamodel.Attribute.IntValue)
+  return intvalue_;
+}
+inline void Attribute::set_intvalue(::google::protobuf::int64 value) {
+  set_has_intvalue();
+  intvalue_ = value;
+  // @@protoc_insertion_point(field_set:datamodel.Attribute.IntValue)
+}
+
+// optional double DoubleValue = 7;
+inline bool Attribute::has_doublevalue() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void Attribute::set_has_doublevalue() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void Attribute::clear_has_doublevalue() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void Attribute::clear_doublevalue() {
+  doublevalue_ = 0;
+  clear_has_doublevalue();
+}
+inline double Attribute::doublevalue() const {
+  // @@protoc_insertion_point(field_get:datamodel.Attribute.DoubleValue)
+  return doublevalue_;
+}
+inline void Attribute::set_doublevalue(double value) {
+  set_has_doublevalue();
+  doublevalue_ = value;
+  // @@protoc_insertion_point(field_set:datamodel.Attribute.DoubleValue)
+}
+
+// optional bool BoolValue = 8;
+inline bool Attribute::has_boolvalue() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
+}
+inline void Attribute::set_has_boolvalue() {
+  _has_bits_[0] |= 0x00000080u;
+}
+inline void Attribute::clear_has_boolvalue() {
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline void Attribute::clear_boolvalue() {
+  boolvalue_ = false;
+  clear_has_boolvalue();
+}
+inline bool Attribute::boolvalue() const {
+  // @@protoc_insertion_point(field_get:datamodel.Attribute.BoolValue)
+  return boolvalue_;
+}
+inline void Attribute::set_boolvalue(bool value) {
+  set_has_boolvalue();
+  boolvalue_ = value;
+  // @@protoc_insertion_point(field_set:datamodel.Attribute.BoolValue)
+}
+
+// optional bytes BinaryValue = 9;
+inline bool Attribute::has_binaryvalue() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void Attribute::set_has_binaryvalue() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void Attribute::clear_has_binaryvalue() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void Attribute::clear_binaryvalue() {
+  binaryvalue_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clear_has_binaryvalue();
+}
+inline const ::std::string& Attribute::binaryvalue() const {
+  // @@protoc_insertion_point(field_get:datamodel.Attribute.BinaryValue)
+  return binaryvalue_.GetNoArena();
+}
+inline void Attribute::set_binaryvalue(const ::std::string& value) {
+  set_has_binaryvalue();
+  binaryvalue_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:datamodel.Attribute.BinaryValue)
+}
+#if LANG_CXX11
+inline void Attribute::set_binaryvalue(::std::string&& value) {
+  set_has_binaryvalue();
+  binaryvalue_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:datamodel.Attribute.BinaryValue)
+}
+#endif
+inline void Attribute::set_binaryvalue(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  set_has_binaryvalue();
+  binaryvalue_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:datamodel.Attribute.BinaryValue)
+}
+inline void Attribute::set_binaryvalue(const void* value, size_t size) {
+  set_has_binaryvalue();
+  binaryvalue_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:datamodel.Attribute.BinaryValue)
+}
+inline ::std::string* Attribute::mutable_binaryvalue() {
+  set_has_binaryvalue();
+  // @@protoc_insertion_point(field_mutable:datamodel.Attribute.BinaryValue)
+  return binaryvalue_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* Attribute::release_binaryvalue() {
+  // @@protoc_insertion_point(field_release:datamodel.Attribute.BinaryValue)
+  clear_has_binaryvalue();
+  return binaryvalue_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void Attribute::set_allocated_binaryvalue(::std::string* binaryvalue) {
+  if (binaryvalue != NULL) {
+    set_has_binaryvalue();
+  } else {
+    clear_has_binaryvalue();
+  }
+  binaryvalue_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), binaryvalue);
+  // @@protoc_insertion_point(field_set_allocated:datamodel.Attribute.BinaryValue)
+}
+
+// repeated sint64 IntArrayValue = 10 [packed = true];
+inline int Attribute::intarrayvalue_size() const {
+  return intarrayvalue_.size();
+}
+inline void Attribute::clear_intarrayvalue() {
+  intarrayvalue_.Clear();
+}
+inline ::google::protobuf::int64 Attribute::intarrayvalue(int index) const {
+  // @@protoc_insertion_point(field_get:datamodel.Attribute.IntArrayValue)
+  return intarrayvalue_.Get(index);
+}
+inline void Attribute::set_intarrayvalue(int index, ::google::protobuf::int64 value) {
+  intarrayvalue_.Set(index, value);
+  // @@protoc_insertion_point(field_set:datamodel.Attribute.IntArrayValue)
+}
+inline void Attribute::add_intarrayvalue(::google::protobuf::int64 value) {
+  intarrayvalue_.Add(value);
+  // @@protoc_insertion_point(field_add:datamodel.Attribute.IntArrayValue)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+Attribute::intarrayvalue() const {
+  // @@protoc_insertion_point(field_list:datamodel.Attribute.IntArrayValue)
+  return intarrayvalue_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+Attribute::mutable_intarrayvalue() {
+  // @@protoc_insertion_point(field_mutable_list:datamodel.Attribute.IntArrayValue)
+  return &intarrayvalue_;
+}
+
+// repeated double DoubleArrayValue = 11 [packed = true];
+inline int Attribute::doublearrayvalue_size() const {
+  return doublearrayvalue_.size();
+}
+inline void Attribute::clear_doublearrayvalue() {
+  doublearrayvalue_.Clear();
+}
+inline double Attribute::doublearrayvalue(int index) const {
+  // @@protoc_insertion_point(field_get:datamodel.Attribute.DoubleArrayValue)
+  return doublearrayvalue_.Get(index);
+}
+inline void Attribute::set_doublearrayvalue(int index, double value) {
+  doublearrayvalue_.Set(index, value);
+  // @@protoc_insertion_point(field_set:datamodel.Attribute.DoubleArrayValue)
+}
+inline void Attribute::add_doublearrayvalue(double value) {
+  doublearrayvalue_.Add(value);
+  // @@protoc_insertion_point(field_add:datamodel.Attribute.DoubleArrayValue)
+}
+inline const ::google::protobuf::RepeatedField< double >&
+Attribute::doublearrayvalue() const {
+  // @@protoc_insertion_point(field_list:datamodel.Attribute.DoubleArrayValue)
+  return doublearrayvalue_;
+}
+inline ::google::protobuf::RepeatedField< double >*
+Attribute::mutable_doublearrayvalue() {
+  // @@protoc_insertion_point(field_mutable_list:datamodel.Attribute.DoubleArrayValue)
+  return &doublearrayvalue_;
+}
+
+// repeated string StringArrayValue = 12;
+inline int Attribute::stringarrayvalue_size() const {
+  return stringarrayvalue_.size();
+}
+inline void Attribute::clear_stringarrayvalue() {
+  stringarrayvalue_.Clear();
+}
+inline const ::std::string& Attribute::stringarrayvalue(int index) const {
+  // @@protoc_insertion_point(field_get:datamodel.Attribute.StringArrayValue)
+  return stringarrayvalue_.Get(index);
+}
+inline ::std::string* Attribute::mutable_stringarrayvalue(int index) {
+  // @@protoc_insertion_point(field_mutable:datamodel.Attribute.StringArrayValue)
+  return stringarrayvalue_.Mutable(index);
+}
+inline void Attribute::set_stringarrayvalue(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:datamodel.Attribute.StringArrayValue)
+  stringarrayvalue_.Mutable(index)->assign(value);
+}
+#if LANG_CXX11
+inline void Attribute::set_stringarrayvalue(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:datamodel.Attribute.StringArrayValue)
+  stringarrayvalue_.Mutable(index)->assign(std::move(value));
+}
+#endif
+inline void Attribute::set_stringarrayvalue(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  stringarrayvalue_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:datamodel.Attribute.StringArrayValue)
+}
+inline void Attribute::set_stringarrayvalue(int index, const char* value, size_t size) {
+  stringarrayvalue_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:datamodel.Attribute.StringArrayValue)
+}
+inline ::std::string* Attribute::add_stringarrayvalue() {
+  // @@protoc_insertion_point(field_add_mutable:datamodel.Attribute.StringArrayValue)
+  return stringarrayvalue_.Add();
+}
+inline void Attribute::add_stringarrayvalue(const ::std::string& value) {
+  stringarrayvalue_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:datamodel.Attribute.StringArrayValue)
+}
+#if LANG_CXX11
+inline void Attribute::add_stringarrayvalue(::std::string&& value) {
+  stringarrayvalue_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:datamodel.Attribute.StringArrayValue)
+}
+#endif
+inline void Attribute::add_stringarrayvalue(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  stringarrayvalue_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:datamodel.Attribute.StringArrayValue)
+}
+inline void Attribute::add_stringarrayvalue(const char* value, size_t size) {
+  stringarrayvalue_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:datamodel.Attribute.StringArrayValue)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+Attribute::stringarrayvalue() const {
+  // @@protoc_insertion_point(field_list:datamodel.Attribute.StringArrayValue)
+  return stringarrayvalue_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+Attribute::mutable_stringarrayvalue() {
+  // @@protoc_insertion_point(field_mutable_list:datamodel.Attribute.StringArrayValue)
+  return &stringarrayvalue_;
+}
+
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
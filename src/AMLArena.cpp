@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <cstdlib>
+#include <cstdint>
+
+#include "AMLArena.h"
+#include "AMLException.h"
+#include "AMLLogger.h"
+
+#define TAG "AMLArena"
+
+using namespace std;
+using namespace AML;
+
+struct AMLArena::Block
+{
+    Block*  next;
+    size_t  size;   // size of memory after this header
+};
+
+// blocks from malloc() are aligned for any type, and so is the memory after the header
+static const size_t MAX_ALIGNMENT = 16;
+
+const size_t AMLArena::BLOCK_HEADER_SIZE = (sizeof(AMLArena::Block) + MAX_ALIGNMENT - 1) & ~(MAX_ALIGNMENT - 1);
+
+AMLArena::AMLArena(size_t blockSize)
+ : m_blocks(nullptr), m_cleanups(nullptr), m_cursor(nullptr), m_end(nullptr), m_blockSize(0 == blockSize ? 1 : blockSize), m_usedSize(0)
+{
+}
+
+AMLArena::~AMLArena(void)
+{
+    destroyObjects();
+
+    while (nullptr != m_blocks)
+    {
+        Block* next = m_blocks->next;
+        free(m_blocks);
+        m_blocks = next;
+    }
+}
+
+void* AMLArena::allocate(size_t size, size_t alignment)
+{
+    uintptr_t cursor = (reinterpret_cast<uintptr_t>(m_cursor) + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    if (nullptr == m_cursor || cursor + size > reinterpret_cast<uintptr_t>(m_end))
+    {
+        // start a new block which is twice as large as the last one, or large enough for the request
+        size_t blockSize = (nullptr == m_blocks) ? m_blockSize : m_blocks->size * 2;
+        if (blockSize < size + alignment)
+        {
+            blockSize = size + alignment;
+        }
+
+        Block* block = static_cast<Block*>(malloc(BLOCK_HEADER_SIZE + blockSize));
+        if (nullptr == block)
+        {
+            AML_LOG_V(ERROR, TAG, "Failed to allocate memory block : %zu bytes", blockSize);
+            throw AMLException(NO_MEMORY);
+        }
+        block->next = m_blocks;
+        block->size = blockSize;
+        m_blocks = block;
+
+        m_cursor = reinterpret_cast<char*>(block) + BLOCK_HEADER_SIZE;
+        m_end = m_cursor + blockSize;
+        cursor = (reinterpret_cast<uintptr_t>(m_cursor) + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    }
+
+    m_cursor = reinterpret_cast<char*>(cursor + size);
+    m_usedSize += size;
+    return reinterpret_cast<void*>(cursor);
+}
+
+void AMLArena::reset(void)
+{
+    destroyObjects();
+
+    if (nullptr == m_blocks)
+    {
+        return;
+    }
+
+    // keep only the largest (last) block, so the next round fits in one block
+    while (nullptr != m_blocks->next)
+    {
+        Block* next = m_blocks->next;
+        m_blocks->next = next->next;
+        free(next);
+    }
+
+    m_cursor = reinterpret_cast<char*>(m_blocks) + BLOCK_HEADER_SIZE;
+    m_end = m_cursor + m_blocks->size;
+    m_usedSize = 0;
+}
+
+size_t AMLArena::getUsedSize(void) const
+{
+    return m_usedSize;
+}
+
+void AMLArena::destroyObjects(void)
+{
+    while (nullptr != m_cleanups)
+    {
+        Cleanup* cleanup = m_cleanups;
+        m_cleanups = cleanup->next;
+        cleanup->destroy(cleanup->object);
+    }
+}
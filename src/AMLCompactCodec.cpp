@@ -0,0 +1,581 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <algorithm>
+
+#include "AMLCompactCodec.h"
+#include "AMLHasher.h"
+#include "AMLSchema.h"
+#include "AMLScalar.h"
+#include "AMLInterface.h"
+#include "AMLException.h"
+#include "AMLLogger.h"
+
+#define TAG "AMLCompactCodec"
+
+using namespace std;
+using namespace AML;
+
+/*
+ * Compact byte data :
+ *   version        varint
+ *   model hash     8 bytes, little endian
+ *   deviceId       string
+ *   timeStamp      string
+ *   id             varint 0 if it is "<deviceId>_<timeStamp>", or size + 1 followed by the bytes
+ *   data           varint count, then for each of them : varint ordinal of SystemUnitClass, fields
+ *
+ *   fields         varint count, then for each of them : varint (ordinal of attribute << 4 | AMLValueType), value
+ *   value          String, Binary : string
+ *                  StringArray : varint count, strings
+ *                  AMLData : fields of the children of the attribute
+ *                  Integer : varint (ZigZag), Double : 8 bytes, little endian, Boolean : 1 byte
+ *                  IntegerArray, DoubleArray : varint count, elements
+ *   string         varint size followed by the bytes
+ *
+ * The ordinal of data is the index of the first SystemUnitClass of its name, as a later one of the same name is ignored.
+ * The ordinals of attributes are their indexes in the model, static ones included, and are increasing in fields.
+ */
+static const uint64_t COMPACT_VERSION               = 1;
+static const unsigned int TYPE_BITS                 = 4;
+
+namespace
+{
+
+class ModelHasher : public AMLHasher
+{
+public:
+    // terminated so that adjacent names are not ambiguous
+    void addString(const std::string& value)
+    {
+        addBytes(value.data(), value.size());
+        addByte(0);
+    }
+
+    void addAttributes(const std::vector<AttributeSchema>& attributes)
+    {
+        addByte('(');
+        for (const AttributeSchema& attr : attributes)
+        {
+            addString(attr.name);
+            addByte(static_cast<unsigned char>(attr.kind));
+            addByte(static_cast<unsigned char>(attr.scalarType));
+            addAttributes(attr.attributes);
+        }
+        addByte(')');
+    }
+};
+
+class CompactWriter
+{
+public:
+    explicit CompactWriter(std::string& out) : m_out(out)
+    {
+    }
+
+    void writeVarint(uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            m_out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        m_out.push_back(static_cast<char>(value));
+    }
+
+    void writeFixed64(uint64_t value)
+    {
+        char bytes[8];
+        for (size_t i = 0; i < sizeof(bytes); ++i)
+        {
+            bytes[i] = static_cast<char>(value >> (i * 8));
+        }
+        m_out.append(bytes, sizeof(bytes));
+    }
+
+    void writeInt(int64_t value)
+    {
+        // ZigZag, so that small negative values are short as well
+        writeVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    void writeDouble(double value)
+    {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        writeFixed64(bits);
+    }
+
+    void writeBytes(const void* data, size_t size)
+    {
+        writeVarint(size);
+        m_out.append(static_cast<const char*>(data), size);
+    }
+
+    void writeString(const std::string& value)
+    {
+        writeBytes(value.data(), value.size());
+    }
+
+    void writeFields(const std::vector<AttributeSchema>& attributes, const AMLData& amlData)
+    {
+        size_t count = 0;
+        for (const AttributeSchema& attr : attributes)
+        {
+            if (AttributeKind::Invalid == attr.kind)
+            {
+                AML_LOG_V(ERROR, TAG, "Invalid AML : <%s> has value of invalid type", attr.name.c_str());
+                throw AMLException(INVALID_AML_SCHEMA);
+            }
+            count += (AttributeKind::Static != attr.kind) ? 1 : 0;
+        }
+        writeVarint(count);
+
+        for (size_t ordinal = 0; ordinal < attributes.size(); ++ordinal)
+        {
+            const AttributeSchema& attr = attributes[ordinal];
+            AMLValueType type;
+            switch (attr.kind)
+            {
+                case AttributeKind::String:
+                    type = getScalarValueType(amlData, attr.symbol, attr.scalarType);
+                    break;
+                case AttributeKind::StringArray:
+                    type = getArrayValueType(amlData, attr.symbol, attr.scalarType);
+                    break;
+                case AttributeKind::AMLData:
+                    type = AMLValueType::AMLData;
+                    break;
+                default:
+                    continue;
+            }
+
+            writeVarint((static_cast<uint64_t>(ordinal) << TYPE_BITS) | static_cast<uint64_t>(type));
+            writeValue(attr, amlData, type);
+        }
+    }
+
+private:
+    void writeValue(const AttributeSchema& attr, const AMLData& amlData, AMLValueType type)
+    {
+        const AMLSymbol& key = attr.symbol;
+        switch (type)
+        {
+            case AMLValueType::String:
+                writeString(amlData.getValueToStr(key));
+                break;
+            case AMLValueType::StringArray:
+            {
+                const std::vector<std::string>& values = amlData.getValueToStrArr(key);
+                writeVarint(values.size());
+                for (const std::string& value : values)
+                {
+                    writeString(value);
+                }
+                break;
+            }
+            case AMLValueType::AMLData:
+                writeFields(attr.attributes, amlData.getValueToAMLData(key));
+                break;
+            case AMLValueType::Integer:
+                writeInt(amlData.getValueToInt(key));
+                break;
+            case AMLValueType::Double:
+                writeDouble(amlData.getValueToDouble(key));
+                break;
+            case AMLValueType::Boolean:
+                writeVarint(amlData.getValueToBool(key) ? 1 : 0);
+                break;
+            case AMLValueType::Binary:
+            {
+                const std::vector<uint8_t>& value = amlData.getValueToBinary(key);
+                writeBytes(value.data(), value.size());
+                break;
+            }
+            case AMLValueType::IntegerArray:
+            {
+                const std::vector<int64_t>& values = amlData.getValueToIntArr(key);
+                writeVarint(values.size());
+                for (int64_t value : values)
+                {
+                    writeInt(value);
+                }
+                break;
+            }
+            case AMLValueType::DoubleArray:
+            {
+                const std::vector<double>& values = amlData.getValueToDoubleArr(key);
+                writeVarint(values.size());
+                for (double value : values)
+                {
+                    writeDouble(value);
+                }
+                break;
+            }
+        }
+    }
+
+    std::string&    m_out;
+};
+
+/**
+ * Every read is checked against the end of the data, so that truncated or corrupted data throws
+ * AMLException(INVALID_BYTE_STR) instead of being read out of bounds.
+ */
+class CompactReader
+{
+public:
+    CompactReader(const char* data, size_t size) : m_data(data), m_end(data + size)
+    {
+    }
+
+    uint64_t readVarint()
+    {
+        uint64_t value = 0;
+        for (unsigned int shift = 0; shift < 64; shift += 7)
+        {
+            if (m_data == m_end)
+            {
+                break;
+            }
+
+            unsigned char c = static_cast<unsigned char>(*m_data++);
+            value |= static_cast<uint64_t>(c & 0x7F) << shift;
+            if (0 == (c & 0x80))
+            {
+                return value;
+            }
+        }
+        fail("truncated");
+        return 0;
+    }
+
+    uint64_t readFixed64()
+    {
+        if (static_cast<size_t>(m_end - m_data) < 8)
+        {
+            fail("truncated");
+        }
+
+        uint64_t value = 0;
+        for (size_t i = 0; i < 8; ++i)
+        {
+            value |= static_cast<uint64_t>(static_cast<unsigned char>(m_data[i])) << (i * 8);
+        }
+        m_data += 8;
+        return value;
+    }
+
+    // The number of elements which follow, each of which is at least one byte.
+    size_t readCount()
+    {
+        uint64_t count = readVarint();
+        if (count > static_cast<uint64_t>(m_end - m_data))
+        {
+            fail("truncated");
+        }
+        return static_cast<size_t>(count);
+    }
+
+    std::string readRaw(size_t size)
+    {
+        if (size > static_cast<size_t>(m_end - m_data))
+        {
+            fail("truncated");
+        }
+
+        std::string value(m_data, size);
+        m_data += size;
+        return value;
+    }
+
+    // Values of AMLData and ids of AMLObject should not be empty, while the elements of a string array can be.
+    std::string readString(bool allowEmpty = false)
+    {
+        size_t size = readCount();
+        if (0 == size && false == allowEmpty)
+        {
+            fail("empty value");
+        }
+        return readRaw(size);
+    }
+
+    void readFields(const std::vector<AttributeSchema>& attributes, AMLArena* arena, AMLData* amlData)
+    {
+        size_t count = readCount();
+        size_t next = 0;    // ordinals are increasing, so that a key is not set twice
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint64_t header = readVarint();
+            uint64_t ordinal = header >> TYPE_BITS;
+            if (ordinal < next || ordinal >= attributes.size())
+            {
+                fail("invalid ordinal of attribute");
+            }
+            next = static_cast<size_t>(ordinal) + 1;
+
+            readValue(attributes[ordinal], static_cast<unsigned int>(header & ((1u << TYPE_BITS) - 1)), arena, amlData);
+        }
+    }
+
+    void finish() const
+    {
+        if (m_data != m_end)
+        {
+            fail("trailing bytes");
+        }
+    }
+
+    static void fail(const char* reason)
+    {
+        AML_LOG_V(ERROR, TAG, "Invalid compact byte : %s", reason);
+        throw AMLException(INVALID_BYTE_STR);
+    }
+
+private:
+    void readValue(const AttributeSchema& attr, unsigned int type, AMLArena* arena, AMLData* amlData)
+    {
+        const AMLSymbol& key = attr.symbol;
+        AttributeKind kind = attr.kind;
+        switch (static_cast<AMLValueType>(type))
+        {
+            case AMLValueType::String:
+                if (AttributeKind::String != kind) break;
+                amlData->setValue(key, readString());
+                return;
+            case AMLValueType::Integer:
+                if (AttributeKind::String != kind) break;
+                amlData->setIntValue(key, readInt());
+                return;
+            case AMLValueType::Double:
+                if (AttributeKind::String != kind) break;
+                amlData->setDoubleValue(key, readDouble());
+                return;
+            case AMLValueType::Boolean:
+            {
+                if (AttributeKind::String != kind) break;
+                uint64_t value = readVarint();
+                if (value > 1)
+                {
+                    fail("invalid boolean");
+                }
+                amlData->setBoolValue(key, 1 == value);
+                return;
+            }
+            case AMLValueType::Binary:
+            {
+                if (AttributeKind::String != kind) break;
+                std::string value = readString();
+                amlData->setBinaryValue(key, std::vector<uint8_t>(value.begin(), value.end()));
+                return;
+            }
+            case AMLValueType::StringArray:
+            {
+                if (AttributeKind::StringArray != kind) break;
+                std::vector<std::string> values(readNonEmptyCount());
+                for (std::string& value : values)
+                {
+                    value = readString(true);
+                }
+                amlData->setValue(key, std::move(values));
+                return;
+            }
+            case AMLValueType::IntegerArray:
+            {
+                if (AttributeKind::StringArray != kind) break;
+                std::vector<int64_t> values(readNonEmptyCount());
+                for (int64_t& value : values)
+                {
+                    value = readInt();
+                }
+                amlData->setIntArrayValue(key, std::move(values));
+                return;
+            }
+            case AMLValueType::DoubleArray:
+            {
+                if (AttributeKind::StringArray != kind) break;
+                std::vector<double> values(readNonEmptyCount());
+                for (double& value : values)
+                {
+                    value = readDouble();
+                }
+                amlData->setDoubleArrayValue(key, std::move(values));
+                return;
+            }
+            case AMLValueType::AMLData:
+            {
+                if (AttributeKind::AMLData != kind) break;
+                AMLData nested(arena);
+                readFields(attr.attributes, arena, &nested);
+                amlData->setValue(key, std::move(nested));
+                return;
+            }
+        }
+
+        AML_LOG_V(ERROR, TAG, "Invalid compact byte : <%s> has value of invalid type", attr.name.c_str());
+        throw AMLException(INVALID_BYTE_STR);
+    }
+
+    size_t readNonEmptyCount()
+    {
+        size_t count = readCount();
+        if (0 == count)
+        {
+            fail("empty array");
+        }
+        return count;
+    }
+
+    int64_t readInt()
+    {
+        uint64_t value = readVarint();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    double readDouble()
+    {
+        uint64_t bits = readFixed64();
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    const char*         m_data;
+    const char*         m_end;
+};
+
+} // namespace
+
+uint64_t AML::hashCompactModel(const AMLSchema& schema)
+{
+    ModelHasher hasher;
+    for (const std::string& name : schema.getSystemUnitClassNames())
+    {
+        // the one without name is not compiled
+        const InternalElementSchema* suc = schema.findSystemUnitClass(name);
+        hasher.addString(name);
+        hasher.addAttributes((nullptr == suc) ? std::vector<AttributeSchema>() : suc->attributes);
+    }
+    return hasher.hash();
+}
+
+size_t AML::serializeToCompact(const AMLSchema& schema, uint64_t modelHash, const AMLObject& amlObject, std::string& binary)
+{
+    const std::vector<std::string>& sucNames = schema.getSystemUnitClassNames();
+    size_t offset = binary.size();
+    try
+    {
+        CompactWriter writer(binary);
+        writer.writeVarint(COMPACT_VERSION);
+        writer.writeFixed64(modelHash);
+        writer.writeString(amlObject.getDeviceId());
+        writer.writeString(amlObject.getTimeStamp());
+
+        const std::string& id = amlObject.getId();
+        if (id == amlObject.getDeviceId() + "_" + amlObject.getTimeStamp())
+        {
+            writer.writeVarint(0);
+        }
+        else
+        {
+            writer.writeVarint(static_cast<uint64_t>(id.size()) + 1);
+            binary.append(id);
+        }
+
+        std::vector<std::string> dataNames = amlObject.getDataNames();
+        writer.writeVarint(dataNames.size());
+        for (const std::string& name : dataNames)
+        {
+            const InternalElementSchema* suc = schema.findSystemUnitClass(name);
+            if (nullptr == suc)
+            {
+                AML_LOG_V(ERROR, TAG, "Invalid Data : <%s> is not present in SystemUnitClassLib", name.c_str());
+                throw AMLException(NOT_MATCH_TO_AML_MODEL);
+            }
+
+            writer.writeVarint(std::find(sucNames.begin(), sucNames.end(), name) - sucNames.begin());
+            writer.writeFields(suc->attributes, amlObject.getData(name));
+        }
+    }
+    catch (...)
+    {
+        binary.resize(offset);
+        throw;
+    }
+
+    return binary.size() - offset;
+}
+
+AMLObject* AML::parseFromCompact(const AMLSchema& schema, uint64_t modelHash, const char* data, size_t size, AMLArena* arena)
+{
+    if (nullptr == data && 0 != size)
+    {
+        AML_LOG(ERROR, TAG, "Invalid parameter : buffer is null");
+        throw AMLException(INVALID_PARAM);
+    }
+
+    CompactReader reader(data, size);
+    uint64_t version = reader.readVarint();
+    if (COMPACT_VERSION != version)
+    {
+        CompactReader::fail("version is not supported");
+    }
+    if (modelHash != reader.readFixed64())
+    {
+        AML_LOG(ERROR, TAG, "Invalid compact byte : written with another model");
+        throw AMLException(NOT_MATCH_TO_AML_MODEL);
+    }
+
+    std::string deviceId = reader.readString();
+    std::string timeStamp = reader.readString();
+    uint64_t idSize = reader.readVarint();
+    if (1 == idSize)
+    {
+        CompactReader::fail("empty value");
+    }
+    std::string id = (0 == idSize) ? deviceId + "_" + timeStamp : reader.readRaw(static_cast<size_t>(idSize - 1));
+
+    const std::vector<std::string>& sucNames = schema.getSystemUnitClassNames();
+    std::unique_ptr<AMLObject> amlObj(new AMLObject(deviceId, timeStamp, id, arena));
+    std::vector<bool> found(sucNames.size(), false);
+
+    size_t count = reader.readCount();
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint64_t ordinal = reader.readVarint();
+        const InternalElementSchema* suc = (ordinal < sucNames.size()) ? schema.findSystemUnitClass(sucNames[ordinal]) : nullptr;
+        if (nullptr == suc || found[ordinal] ||
+            static_cast<size_t>(std::find(sucNames.begin(), sucNames.end(), sucNames[ordinal]) - sucNames.begin()) != ordinal)
+        {
+            CompactReader::fail("invalid ordinal of data");
+        }
+        found[ordinal] = true;
+
+        AMLData amlData(arena);
+        reader.readFields(suc->attributes, arena, &amlData);
+
+        amlObj->addData(suc->symbol, std::move(amlData));
+    }
+    reader.finish();
+
+    return amlObj.release();
+}
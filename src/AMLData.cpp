@@ -17,10 +17,13 @@
 
 #include <string>
 #include <vector>
-#include <map>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
 
 #include "AMLInterface.h"
-#include "AMLValue.h"
+#include "AMLDataAlloc.h"
+#include "AMLScalar.h"
 #include "AMLException.h"
 #include "AMLLogger.h"
 
@@ -28,86 +31,509 @@
 
 #define VERIFY_NON_EMPTY_THROW_EXCEPTION(str)   if ((str).empty()) throw AMLException(INVALID_PARAM); 
 
-// For logging
-#define TYPE(type)  ((type) == AMLValueType::String ? "String" : ((type) == AMLValueType::StringArray ? "String Array" : "AMLData"))
-
 using namespace std;
 using namespace AML;
 
+// For logging
+static inline const char* typeName(AMLValueType type)
+{
+    switch (type)
+    {
+        case AMLValueType::String:        return "String";
+        case AMLValueType::StringArray:   return "String Array";
+        case AMLValueType::AMLData:       return "AMLData";
+        case AMLValueType::Integer:       return "Integer";
+        case AMLValueType::Double:        return "Double";
+        case AMLValueType::Boolean:       return "Boolean";
+        case AMLValueType::Binary:        return "Binary";
+        case AMLValueType::IntegerArray:  return "Integer Array";
+        case AMLValueType::DoubleArray:   return "Double Array";
+    }
+    return "Unknown";
+}
+
+template <typename Entry>
+static bool lessKey(const Entry& entry, const std::string& key)
+{
+    return entry.m_key.str() < key;
+}
+
+// Interned keys are matched by identity. Up to this size, scanning is faster than binary search on names.
+static const size_t MAX_SIZE_TO_SCAN = 32;
+
+template <typename Iterator>
+static Iterator findKey(Iterator begin, Iterator end, const AMLSymbol& key)
+{
+    if (static_cast<size_t>(end - begin) <= MAX_SIZE_TO_SCAN)
+    {
+        for (Iterator iter = begin; iter != end; ++iter)
+        {
+            if (iter->m_key == key)
+            {
+                return iter;
+            }
+        }
+        return end;
+    }
+
+    Iterator iter = std::lower_bound(begin, end, key.str(), lessKey<typename Iterator::value_type>);
+    return (iter != end && iter->m_key == key) ? iter : end;
+}
+
+AMLData::Entry::Entry(const AMLSymbol& key, std::string&& value)
+ : m_key(key), m_type(AMLValueType::String)
+{
+    new (&m_str) std::string(std::move(value));
+}
+
+AMLData::Entry::Entry(const AMLSymbol& key, std::vector<std::string>&& value)
+ : m_key(key), m_type(AMLValueType::StringArray)
+{
+    new (&m_strArr) std::vector<std::string>(std::move(value));
+}
+
+AMLData::Entry::Entry(const AMLSymbol& key, AMLData* value)
+ : m_key(key), m_type(AMLValueType::AMLData), m_data(value)
+{
+}
+
+AMLData::Entry::Entry(const AMLSymbol& key, int64_t value)
+ : m_key(key), m_type(AMLValueType::Integer), m_int(value)
+{
+}
+
+AMLData::Entry::Entry(const AMLSymbol& key, double value)
+ : m_key(key), m_type(AMLValueType::Double), m_double(value)
+{
+}
+
+AMLData::Entry::Entry(const AMLSymbol& key, bool value)
+ : m_key(key), m_type(AMLValueType::Boolean), m_bool(value)
+{
+}
+
+AMLData::Entry::Entry(const AMLSymbol& key, std::vector<uint8_t>&& value)
+ : m_key(key), m_type(AMLValueType::Binary)
+{
+    new (&m_binary) std::vector<uint8_t>(std::move(value));
+}
+
+AMLData::Entry::Entry(const AMLSymbol& key, std::vector<int64_t>&& value)
+ : m_key(key), m_type(AMLValueType::IntegerArray)
+{
+    new (&m_intArr) std::vector<int64_t>(std::move(value));
+}
+
+AMLData::Entry::Entry(const AMLSymbol& key, std::vector<double>&& value)
+ : m_key(key), m_type(AMLValueType::DoubleArray)
+{
+    new (&m_doubleArr) std::vector<double>(std::move(value));
+}
+
+AMLData::Entry::Entry(Entry&& t) noexcept
+ : m_key(std::move(t.m_key)), m_type(t.m_type)
+{
+    moveValue(std::move(t));
+}
+
+AMLData::Entry& AMLData::Entry::operator=(Entry&& t) noexcept
+{
+    if (&t != this)
+    {
+        destroyValue();
+        m_key = std::move(t.m_key);
+        m_type = t.m_type;
+        moveValue(std::move(t));
+    }
+    return *this;
+}
+
+AMLData::Entry::~Entry()
+{
+    destroyValue();
+}
+
+void AMLData::Entry::moveValue(Entry&& t)
+{
+    switch (m_type)
+    {
+        case AMLValueType::String:
+            new (&m_str) std::string(std::move(t.m_str));
+            break;
+        case AMLValueType::StringArray:
+            new (&m_strArr) std::vector<std::string>(std::move(t.m_strArr));
+            break;
+        case AMLValueType::Binary:
+            new (&m_binary) std::vector<uint8_t>(std::move(t.m_binary));
+            break;
+        case AMLValueType::IntegerArray:
+            new (&m_intArr) std::vector<int64_t>(std::move(t.m_intArr));
+            break;
+        case AMLValueType::DoubleArray:
+            new (&m_doubleArr) std::vector<double>(std::move(t.m_doubleArr));
+            break;
+        case AMLValueType::AMLData:
+            m_data = t.m_data;
+            break;
+        case AMLValueType::Integer:
+            m_int = t.m_int;
+            break;
+        case AMLValueType::Double:
+            m_double = t.m_double;
+            break;
+        case AMLValueType::Boolean:
+            m_bool = t.m_bool;
+            break;
+    }
+}
+
+void AMLData::Entry::destroyValue()
+{
+    if (AMLValueType::String == m_type)
+    {
+        m_str.~basic_string();
+    }
+    else if (AMLValueType::StringArray == m_type)
+    {
+        m_strArr.~vector();
+    }
+    else if (AMLValueType::Binary == m_type)
+    {
+        m_binary.~vector();
+    }
+    else if (AMLValueType::IntegerArray == m_type)
+    {
+        m_intArr.~vector();
+    }
+    else if (AMLValueType::DoubleArray == m_type)
+    {
+        m_doubleArr.~vector();
+    }
+}
 
 AMLData::AMLData(void)
+ : m_arena(nullptr)
+{
+}
+
+AMLData::AMLData(AMLArena* arena)
+ : m_arena(arena), m_entries(EntryVector::allocator_type(arena))
 {
 }
 
 AMLData::AMLData(const AMLData& t) 
+ : m_arena(nullptr)
 {
     t.copyData(this);
 }
 
+AMLData::AMLData(AMLData&& t) noexcept
+ : m_arena(t.m_arena), m_entries(std::move(t.m_entries))
+{
+    t.m_entries.clear();
+}
+
 AMLData& AMLData::operator=(const AMLData& t)
 {
-    t.copyData(this);
+    if (&t != this)
+    {
+        clearValues();
+        t.copyData(this);
+    }
     return *this;
 }
 
-AMLData::~AMLData(void)
+AMLData& AMLData::operator=(AMLData&& t) noexcept
 {
-    if (!m_values.empty()) 
+    if (&t != this)
     {
-        for (auto const& iter : m_values)
+        clearValues();
+        if (m_arena == t.m_arena)
         {
-            delete iter.second;
+            m_entries.swap(t.m_entries);
+        }
+        else
+        {
+            // values of t are placed in another arena, so they cannot be taken over
+            t.copyData(this);
         }
     }
+    return *this;
+}
+
+// std::vector<AMLData> relocates AMLData by move only if it cannot throw.
+static_assert(std::is_nothrow_move_constructible<AMLData>::value, "AMLData should be nothrow move constructible");
+static_assert(std::is_nothrow_move_assignable<AMLData>::value, "AMLData should be nothrow move assignable");
+
+AMLData::~AMLData(void)
+{
+    clearValues();
 }
 
 void AMLData::setValue(const std::string& key, const std::string& value)
 {
     VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
-    VERIFY_NON_EMPTY_THROW_EXCEPTION(value);
 
-    if (m_values.find(key) != m_values.end())
-    {
-        AML_LOG_V(ERROR, TAG, "Key already exist in AMLData : %s", key.c_str());
-        throw AMLException(KEY_ALREADY_EXIST);
-    }
+    setValue(AMLSymbol::lookup(key, m_arena), std::string(value));
+}
 
-    m_values[key] = (AMLValue*) new AMLValue_<std::string>(AMLValueType::String, value);
+void AMLData::setValue(const std::string& key, std::string&& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    setValue(AMLSymbol::lookup(key, m_arena), std::move(value));
+}
+
+void AMLData::setValue(const AMLSymbol& key, const std::string& value)
+{
+    setValue(key, std::string(value));
+}
+
+void AMLData::setValue(const AMLSymbol& key, std::string&& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(value);
+
+    EntryVector::iterator iter = findInsertPosition(key);
+    m_entries.emplace(iter, key.placeIn(m_arena), std::move(value));
 }
 
 void AMLData::setValue(const std::string& key, const std::vector<std::string>& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    setValue(AMLSymbol::lookup(key, m_arena), std::vector<std::string>(value));
+}
+
+void AMLData::setValue(const std::string& key, std::vector<std::string>&& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    setValue(AMLSymbol::lookup(key, m_arena), std::move(value));
+}
+
+void AMLData::setValue(const AMLSymbol& key, const std::vector<std::string>& value)
+{
+    setValue(key, std::vector<std::string>(value));
+}
+
+void AMLData::setValue(const AMLSymbol& key, std::vector<std::string>&& value)
 {
     VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
     VERIFY_NON_EMPTY_THROW_EXCEPTION(value);
 
-    if (m_values.find(key) != m_values.end())
+    EntryVector::iterator iter = findInsertPosition(key);
+    m_entries.emplace(iter, key.placeIn(m_arena), std::move(value));
+}
+
+void AMLData::setValue(const std::string& key, const AMLData& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    setValue(AMLSymbol::lookup(key, m_arena), value);
+}
+
+void AMLData::setValue(const std::string& key, AMLData&& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    setValue(AMLSymbol::lookup(key, m_arena), std::move(value));
+}
+
+void AMLData::setValue(const AMLSymbol& key, const AMLData& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    EntryVector::iterator iter = findInsertPosition(key);
+
+    AMLData* data = newData(m_arena);
+    try
     {
-        AML_LOG_V(ERROR, TAG, "Key already exist in AMLData : %s", key.c_str());
-        throw AMLException(KEY_ALREADY_EXIST);
+        *data = value;
+        m_entries.emplace(iter, key.placeIn(m_arena), data);
+    }
+    catch (...)
+    {
+        deleteData(m_arena, data);
+        throw;
+    }
+}
+
+void AMLData::setValue(const AMLSymbol& key, AMLData&& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    EntryVector::iterator iter = findInsertPosition(key);
+
+    AMLData* data = newData(m_arena);
+    try
+    {
+        *data = std::move(value);
+        m_entries.emplace(iter, key.placeIn(m_arena), data);
     }
+    catch (...)
+    {
+        deleteData(m_arena, data);
+        throw;
+    }
+}
 
-    m_values[key] = (AMLValue*) new AMLValue_<std::vector<std::string>>(AMLValueType::StringArray, value);
+AMLData& AMLData::emplaceData(const std::string& key)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return emplaceData(AMLSymbol::lookup(key, m_arena));
 }
 
-void AMLData::setValue(const std::string& key, const AMLData& value)
+AMLData& AMLData::emplaceData(const AMLSymbol& key)
 {
     VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
 
-    if (m_values.find(key) != m_values.end())
+    EntryVector::iterator iter = findInsertPosition(key);
+
+    AMLData* data = newData(m_arena);
+    try
     {
-        AML_LOG_V(ERROR, TAG, "Key already exist in AMLData : %s", key.c_str());
-        throw AMLException(KEY_ALREADY_EXIST);
+        m_entries.emplace(iter, key.placeIn(m_arena), data);
     }
-    
-    m_values[key] = (AMLValue*) new AMLValue_<AMLData>(AMLValueType::AMLData, value);
+    catch (...)
+    {
+        deleteData(m_arena, data);
+        throw;
+    }
+    return *data;
+}
+
+template <typename T>
+void AMLData::addEntry(const AMLSymbol& key, T&& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    EntryVector::iterator iter = findInsertPosition(key);
+    m_entries.emplace(iter, key.placeIn(m_arena), std::forward<T>(value));
+}
+
+void AMLData::setIntValue(const std::string& key, int64_t value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    addEntry(AMLSymbol::lookup(key, m_arena), value);
+}
+
+void AMLData::setIntValue(const AMLSymbol& key, int64_t value)
+{
+    addEntry(key, value);
+}
+
+void AMLData::setDoubleValue(const std::string& key, double value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    addEntry(AMLSymbol::lookup(key, m_arena), value);
+}
+
+void AMLData::setDoubleValue(const AMLSymbol& key, double value)
+{
+    addEntry(key, value);
+}
+
+void AMLData::setBoolValue(const std::string& key, bool value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    addEntry(AMLSymbol::lookup(key, m_arena), value);
+}
+
+void AMLData::setBoolValue(const AMLSymbol& key, bool value)
+{
+    addEntry(key, value);
+}
+
+void AMLData::setBinaryValue(const std::string& key, const std::vector<uint8_t>& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    setBinaryValue(AMLSymbol::lookup(key, m_arena), std::vector<uint8_t>(value));
+}
+
+void AMLData::setBinaryValue(const std::string& key, std::vector<uint8_t>&& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    setBinaryValue(AMLSymbol::lookup(key, m_arena), std::move(value));
+}
+
+void AMLData::setBinaryValue(const AMLSymbol& key, const std::vector<uint8_t>& value)
+{
+    setBinaryValue(key, std::vector<uint8_t>(value));
+}
+
+void AMLData::setBinaryValue(const AMLSymbol& key, std::vector<uint8_t>&& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(value);
+
+    addEntry(key, std::move(value));
+}
+
+void AMLData::setIntArrayValue(const std::string& key, const std::vector<int64_t>& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    setIntArrayValue(AMLSymbol::lookup(key, m_arena), std::vector<int64_t>(value));
+}
+
+void AMLData::setIntArrayValue(const std::string& key, std::vector<int64_t>&& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    setIntArrayValue(AMLSymbol::lookup(key, m_arena), std::move(value));
+}
+
+void AMLData::setIntArrayValue(const AMLSymbol& key, const std::vector<int64_t>& value)
+{
+    setIntArrayValue(key, std::vector<int64_t>(value));
+}
+
+void AMLData::setIntArrayValue(const AMLSymbol& key, std::vector<int64_t>&& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(value);
+
+    addEntry(key, std::move(value));
+}
+
+void AMLData::setDoubleArrayValue(const std::string& key, const std::vector<double>& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    setDoubleArrayValue(AMLSymbol::lookup(key, m_arena), std::vector<double>(value));
+}
+
+void AMLData::setDoubleArrayValue(const std::string& key, std::vector<double>&& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    setDoubleArrayValue(AMLSymbol::lookup(key, m_arena), std::move(value));
+}
+
+void AMLData::setDoubleArrayValue(const AMLSymbol& key, const std::vector<double>& value)
+{
+    setDoubleArrayValue(key, std::vector<double>(value));
+}
+
+void AMLData::setDoubleArrayValue(const AMLSymbol& key, std::vector<double>&& value)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(value);
+
+    addEntry(key, std::move(value));
 }
 
 std::vector<std::string> AMLData::getKeys() const
 {
     std::vector<std::string> keys;
-    for (auto const& element : m_values)
+    keys.reserve(m_entries.size());
+    for (auto const& entry : m_entries)
     {
-        keys.push_back(element.first);
+        keys.push_back(entry.m_key.str());
     }
 
     return keys;
@@ -117,96 +543,306 @@ AMLValueType AMLData::getValueType(const std::string& key) const
 {
     VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
 
-    for (auto const& element : m_values)
-    {
-        if (key.compare(element.first) == 0)
-        {
-            AMLValueType type = element.second->getType();
+    return findEntry(key).m_type;
+}
 
-            return type;
-        }
-    }
+AMLValueType AMLData::getValueType(const AMLSymbol& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
 
-    AML_LOG_V(ERROR, TAG, "Key does not exist in AMLData : %s", key.c_str());
-    throw AMLException(KEY_NOT_EXIST);
+    return findEntry(key).m_type;
 }
 
 const std::string& AMLData::getValueToStr(const std::string& key) const
 {
     VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
 
-    auto iter = m_values.find(key);
-    if (iter == m_values.end())
+    return findEntry(key, AMLValueType::String).m_str;
+}
+
+const std::string& AMLData::getValueToStr(const AMLSymbol& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return findEntry(key, AMLValueType::String).m_str;
+}
+
+const std::vector<std::string>& AMLData::getValueToStrArr(const std::string& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return findEntry(key, AMLValueType::StringArray).m_strArr;
+}
+
+const std::vector<std::string>& AMLData::getValueToStrArr(const AMLSymbol& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return findEntry(key, AMLValueType::StringArray).m_strArr;
+}
+
+const AMLData& AMLData::getValueToAMLData(const std::string& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return *findEntry(key, AMLValueType::AMLData).m_data;
+}
+
+const AMLData& AMLData::getValueToAMLData(const AMLSymbol& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return *findEntry(key, AMLValueType::AMLData).m_data;
+}
+
+int64_t AMLData::getValueToInt(const std::string& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return toInt(findEntry(key));
+}
+
+int64_t AMLData::getValueToInt(const AMLSymbol& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return toInt(findEntry(key));
+}
+
+double AMLData::getValueToDouble(const std::string& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return toDouble(findEntry(key));
+}
+
+double AMLData::getValueToDouble(const AMLSymbol& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return toDouble(findEntry(key));
+}
+
+bool AMLData::getValueToBool(const std::string& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return toBool(findEntry(key));
+}
+
+bool AMLData::getValueToBool(const AMLSymbol& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return toBool(findEntry(key));
+}
+
+const std::vector<uint8_t>& AMLData::getValueToBinary(const std::string& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return findEntry(key, AMLValueType::Binary).m_binary;
+}
+
+const std::vector<uint8_t>& AMLData::getValueToBinary(const AMLSymbol& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return findEntry(key, AMLValueType::Binary).m_binary;
+}
+
+const std::vector<int64_t>& AMLData::getValueToIntArr(const std::string& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return findEntry(key, AMLValueType::IntegerArray).m_intArr;
+}
+
+const std::vector<int64_t>& AMLData::getValueToIntArr(const AMLSymbol& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return findEntry(key, AMLValueType::IntegerArray).m_intArr;
+}
+
+const std::vector<double>& AMLData::getValueToDoubleArr(const std::string& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return findEntry(key, AMLValueType::DoubleArray).m_doubleArr;
+}
+
+const std::vector<double>& AMLData::getValueToDoubleArr(const AMLSymbol& key) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+
+    return findEntry(key, AMLValueType::DoubleArray).m_doubleArr;
+}
+
+int64_t AMLData::toInt(const Entry& entry)
+{
+    int64_t value = 0;
+    if (AMLValueType::Integer == entry.m_type)
     {
-        AML_LOG_V(ERROR, TAG, "Key does not exist in AMLData : %s", key.c_str());
-        throw AMLException(KEY_NOT_EXIST);
+        return entry.m_int;
     }
-    else if (AMLValueType::String != iter->second->getType())
+    else if (AMLValueType::String == entry.m_type && parseInt(entry.m_str, value))
     {
-        AML_LOG_V(ERROR, TAG, "'%s' has a value of %s type", key.c_str(), TYPE(iter->second->getType()));
-        throw AMLException(WRONG_GETTER_TYPE);
+        return value;
     }
 
-    return ((AMLValue_<std::string>*)iter->second)->getValue();
+    AML_LOG_V(ERROR, TAG, "'%s' does not have a value of Integer type", entry.m_key.str().c_str());
+    throw AMLException(WRONG_GETTER_TYPE);
 }
 
-const std::vector<std::string>& AMLData::getValueToStrArr(const std::string& key) const
+double AMLData::toDouble(const Entry& entry)
 {
-    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+    double value = 0;
+    if (AMLValueType::Double == entry.m_type)
+    {
+        return entry.m_double;
+    }
+    else if (AMLValueType::Integer == entry.m_type)
+    {
+        return static_cast<double>(entry.m_int);
+    }
+    else if (AMLValueType::String == entry.m_type && parseDouble(entry.m_str, value))
+    {
+        return value;
+    }
+
+    AML_LOG_V(ERROR, TAG, "'%s' does not have a value of Double type", entry.m_key.str().c_str());
+    throw AMLException(WRONG_GETTER_TYPE);
+}
 
-    auto iter = m_values.find(key);
-    if (iter == m_values.end())
+bool AMLData::toBool(const Entry& entry)
+{
+    bool value = false;
+    if (AMLValueType::Boolean == entry.m_type)
     {
-        AML_LOG_V(ERROR, TAG, "Key does not exist in AMLData : %s", key.c_str());
-        throw AMLException(KEY_NOT_EXIST);
+        return entry.m_bool;
     }
-    else if (AMLValueType::StringArray != iter->second->getType())
+    else if (AMLValueType::String == entry.m_type && parseBool(entry.m_str, value))
     {
-        AML_LOG_V(ERROR, TAG, "'%s' has a value of %s type", key.c_str(), TYPE(iter->second->getType()));
+        return value;
+    }
+
+    AML_LOG_V(ERROR, TAG, "'%s' does not have a value of Boolean type", entry.m_key.str().c_str());
+    throw AMLException(WRONG_GETTER_TYPE);
+}
+
+const AMLData::Entry& AMLData::findEntry(const std::string& key, AMLValueType type) const
+{
+    const Entry& entry = findEntry(key);
+    if (type != entry.m_type)
+    {
+        AML_LOG_V(ERROR, TAG, "'%s' has a value of %s type", key.c_str(), typeName(entry.m_type));
         throw AMLException(WRONG_GETTER_TYPE);
     }
 
-    AMLValue_<std::vector<std::string>>* amlVal = (AMLValue_<std::vector<std::string>>*)iter->second;
-    return amlVal->getValue();
+    return entry;
 }
 
-const AMLData& AMLData::getValueToAMLData(const std::string& key) const
+const AMLData::Entry& AMLData::findEntry(const AMLSymbol& key, AMLValueType type) const
 {
-    VERIFY_NON_EMPTY_THROW_EXCEPTION(key);
+    const Entry& entry = findEntry(key);
+    if (type != entry.m_type)
+    {
+        AML_LOG_V(ERROR, TAG, "'%s' has a value of %s type", key.str().c_str(), typeName(entry.m_type));
+        throw AMLException(WRONG_GETTER_TYPE);
+    }
+
+    return entry;
+}
 
-    auto iter = m_values.find(key);
-    if (iter == m_values.end())
+const AMLData::Entry& AMLData::findEntry(const std::string& key) const
+{
+    auto iter = std::lower_bound(m_entries.begin(), m_entries.end(), key, lessKey<Entry>);
+    if (iter == m_entries.end() || iter->m_key.str() != key)
     {
         AML_LOG_V(ERROR, TAG, "Key does not exist in AMLData : %s", key.c_str());
         throw AMLException(KEY_NOT_EXIST);
     }
-    else if (AMLValueType::AMLData != iter->second->getType())
+
+    return *iter;
+}
+
+const AMLData::Entry& AMLData::findEntry(const AMLSymbol& key) const
+{
+    auto iter = findKey(m_entries.begin(), m_entries.end(), key);
+    if (iter == m_entries.end())
     {
-        AML_LOG_V(ERROR, TAG, "'%s' has a value of %s type", key.c_str(), TYPE(iter->second->getType()));
-        throw AMLException(WRONG_GETTER_TYPE);
+        AML_LOG_V(ERROR, TAG, "Key does not exist in AMLData : %s", key.str().c_str());
+        throw AMLException(KEY_NOT_EXIST);
     }
 
-    AMLValue_<AMLData>* amlVal = (AMLValue_<AMLData>*)iter->second;
-    return amlVal->getValue();
+    return *iter;
 }
 
-void AMLData::copyData(AMLData* target) const
+AMLData::EntryVector::iterator AMLData::findInsertPosition(const AMLSymbol& key)
 {
-    for (auto const& element : m_values)
+    // values are mostly added in order, so the end is checked first
+    if (m_entries.empty() || m_entries.back().m_key < key)
     {
-        string key(element.first);
+        return m_entries.end();
+    }
 
-        if (AMLValueType::String == element.second->getType())
-        {
-            target->setValue(key, ((AMLValue_<string>*)element.second)->getValue());
-        }
-        else if (AMLValueType::StringArray == element.second->getType())
+    auto iter = std::lower_bound(m_entries.begin(), m_entries.end(), key.str(), lessKey<Entry>);
+    if (iter->m_key == key)
+    {
+        AML_LOG_V(ERROR, TAG, "Key already exist in AMLData : %s", key.str().c_str());
+        throw AMLException(KEY_ALREADY_EXIST);
+    }
+    return iter;
+}
+
+void AMLData::clearValues()
+{
+    for (auto const& entry : m_entries)
+    {
+        if (AMLValueType::AMLData == entry.m_type)
         {
-            target->setValue(key, ((AMLValue_<vector<string>>*)element.second)->getValue());
+            deleteData(m_arena, entry.m_data);
         }
-        else
+    }
+    m_entries.clear();
+}
+
+void AMLData::copyData(AMLData* target) const
+{
+    target->m_entries.reserve(target->m_entries.size() + m_entries.size());
+
+    for (auto const& entry : m_entries)
+    {
+        switch (entry.m_type)
         {
-            target->setValue(key, ((AMLValue_<AMLData>*)element.second)->getValue());
+            case AMLValueType::String:
+                target->setValue(entry.m_key, entry.m_str);
+                break;
+            case AMLValueType::StringArray:
+                target->setValue(entry.m_key, entry.m_strArr);
+                break;
+            case AMLValueType::AMLData:
+                target->setValue(entry.m_key, *entry.m_data);
+                break;
+            case AMLValueType::Integer:
+                target->setIntValue(entry.m_key, entry.m_int);
+                break;
+            case AMLValueType::Double:
+                target->setDoubleValue(entry.m_key, entry.m_double);
+                break;
+            case AMLValueType::Boolean:
+                target->setBoolValue(entry.m_key, entry.m_bool);
+                break;
+            case AMLValueType::Binary:
+                target->setBinaryValue(entry.m_key, entry.m_binary);
+                break;
+            case AMLValueType::IntegerArray:
+                target->setIntArrayValue(entry.m_key, entry.m_intArr);
+                break;
+            case AMLValueType::DoubleArray:
+                target->setDoubleArrayValue(entry.m_key, entry.m_doubleArr);
+                break;
         }
     }
-}
\ No newline at end of file
+}
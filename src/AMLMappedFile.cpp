@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <string>
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "AMLMappedFile.h"
+#include "AMLException.h"
+#include "AMLLogger.h"
+
+#define TAG "AMLMappedFile"
+
+using namespace std;
+using namespace AML;
+
+AMLMappedFile::AMLMappedFile(const std::string& path) : m_data(nullptr), m_size(0), m_isMapped(false)
+{
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        AML_LOG_V(ERROR, TAG, "Failed to open file : %s", path.c_str());
+        throw AMLException(INVALID_FILE_PATH);
+    }
+
+    struct stat st;
+    if (0 != fstat(fd, &st) || false == S_ISREG(st.st_mode))
+    {
+        AML_LOG_V(ERROR, TAG, "Failed to open file : %s is not a regular file", path.c_str());
+        close(fd);
+        throw AMLException(INVALID_FILE_PATH);
+    }
+
+    m_size = static_cast<size_t>(st.st_size);
+    m_stamp = std::to_string(st.st_dev) + ":" + std::to_string(st.st_ino) + ":" + std::to_string(st.st_size) + ":" +
+              std::to_string(st.st_mtim.tv_sec) + "." + std::to_string(st.st_mtim.tv_nsec);
+    if (0 != m_size)
+    {
+        // private mapping : the parser writes into the pages, which are copied on write and are never written to the file
+        void* data = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (MAP_FAILED == data)
+        {
+            AML_LOG_V(ERROR, TAG, "Failed to map file : %s", path.c_str());
+            close(fd);
+            throw AMLException(INVALID_FILE_PATH);
+        }
+        m_data = static_cast<char*>(data);
+        m_isMapped = true;
+    }
+    close(fd);
+#else
+    std::ifstream file(path.c_str(), std::ios::binary | std::ios::ate);
+    if (false == file.is_open())
+    {
+        AML_LOG_V(ERROR, TAG, "Failed to open file : %s", path.c_str());
+        throw AMLException(INVALID_FILE_PATH);
+    }
+
+    m_size = static_cast<size_t>(file.tellg());
+    if (0 != m_size)
+    {
+        m_data = new char[m_size];
+        file.seekg(0);
+        if (false == file.read(m_data, m_size).good())
+        {
+            AML_LOG_V(ERROR, TAG, "Failed to read file : %s", path.c_str());
+            delete[] m_data;
+            throw AMLException(INVALID_FILE_PATH);
+        }
+    }
+#endif
+}
+
+AMLMappedFile::~AMLMappedFile(void)
+{
+#ifndef _WIN32
+    if (m_isMapped)
+    {
+        munmap(m_data, m_size);
+        return;
+    }
+#endif
+    delete[] m_data;
+}
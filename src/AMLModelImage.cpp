@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <string.h>
+#include <string>
+
+#include "AMLModelImage.h"
+#include "AMLException.h"
+#include "AMLLogger.h"
+
+#define TAG "AMLModelImage"
+
+using namespace std;
+using namespace AML;
+
+// 'A' is never the first character of XML, so a model is told from an image by the first bytes.
+static const char IMAGE_MAGIC[]                     = "AMLMODEL";
+static const size_t IMAGE_MAGIC_SIZE                = sizeof(IMAGE_MAGIC) - 1;
+
+// Changed whenever AMLSchema or the templates of AMLXmlWriter are changed, so that an old image is not misread.
+static const size_t IMAGE_VERSION                   = 1;
+
+static void appendSize(size_t value, std::string& out)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+AMLImageWriter::AMLImageWriter(void)
+{
+}
+
+void AMLImageWriter::writeSize(size_t value)
+{
+    appendSize(value, m_body);
+}
+
+void AMLImageWriter::writeBool(bool value)
+{
+    m_body.push_back(value ? 1 : 0);
+}
+
+void AMLImageWriter::writeString(const std::string& value)
+{
+    appendSize(value.size(), m_body);
+    m_body.append(value);
+}
+
+std::string AMLImageWriter::finish(void) const
+{
+    std::string image(IMAGE_MAGIC, IMAGE_MAGIC_SIZE);
+    appendSize(IMAGE_VERSION, image);
+    appendSize(m_body.size(), image);
+    image.append(m_body);
+    return image;
+}
+
+AMLImageReader::AMLImageReader(const char* data, size_t size) : m_data(data), m_end(data + size)
+{
+    if (false == isImage(data, size))
+    {
+        AML_LOG(ERROR, TAG, "Invalid compiled model : header does not exist");
+        throw AMLException(INVALID_BYTE_STR);
+    }
+    m_data += IMAGE_MAGIC_SIZE;
+
+    size_t version = readSize();
+    if (IMAGE_VERSION != version)
+    {
+        AML_LOG_V(ERROR, TAG, "Invalid compiled model : version %zu is not supported", version);
+        throw AMLException(INVALID_BYTE_STR);
+    }
+
+    size_t bodySize = readSize();
+    if (bodySize != static_cast<size_t>(m_end - m_data))
+    {
+        AML_LOG(ERROR, TAG, "Invalid compiled model : size does not match");
+        throw AMLException(INVALID_BYTE_STR);
+    }
+}
+
+size_t AMLImageReader::readSize(void)
+{
+    size_t value = 0;
+    for (unsigned int shift = 0; shift < sizeof(size_t) * 8; shift += 7)
+    {
+        if (m_data == m_end)
+        {
+            break;
+        }
+
+        unsigned char c = static_cast<unsigned char>(*m_data++);
+        value |= static_cast<size_t>(c & 0x7F) << shift;
+        if (0 == (c & 0x80))
+        {
+            return value;
+        }
+    }
+
+    AML_LOG(ERROR, TAG, "Invalid compiled model : truncated");
+    throw AMLException(INVALID_BYTE_STR);
+}
+
+size_t AMLImageReader::readSize(size_t limit)
+{
+    size_t value = readSize();
+    if (value >= limit)
+    {
+        AML_LOG_V(ERROR, TAG, "Invalid compiled model : %zu is out of range", value);
+        throw AMLException(INVALID_BYTE_STR);
+    }
+    return value;
+}
+
+size_t AMLImageReader::readCount(void)
+{
+    return readSize(static_cast<size_t>(m_end - m_data) + 1);
+}
+
+bool AMLImageReader::readBool(void)
+{
+    return 0 != readSize(2);
+}
+
+std::string AMLImageReader::readString(void)
+{
+    size_t size = readSize();
+    if (size > static_cast<size_t>(m_end - m_data))
+    {
+        AML_LOG(ERROR, TAG, "Invalid compiled model : truncated");
+        throw AMLException(INVALID_BYTE_STR);
+    }
+
+    std::string value(m_data, size);
+    m_data += size;
+    return value;
+}
+
+void AMLImageReader::finish(void) const
+{
+    if (m_data != m_end)
+    {
+        AML_LOG(ERROR, TAG, "Invalid compiled model : trailing bytes");
+        throw AMLException(INVALID_BYTE_STR);
+    }
+}
+
+bool AMLImageReader::isImage(const char* data, size_t size)
+{
+    return nullptr != data && size >= IMAGE_MAGIC_SIZE && 0 == memcmp(data, IMAGE_MAGIC, IMAGE_MAGIC_SIZE);
+}
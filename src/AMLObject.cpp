@@ -17,9 +17,12 @@
 
 #include <string>
 #include <vector>
-#include <map>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
 
 #include "AMLInterface.h"
+#include "AMLDataAlloc.h"
 #include "AMLException.h"
 #include "AMLLogger.h"
 
@@ -30,19 +33,33 @@
 using namespace std;
 using namespace AML;
 
+// AMLData are sorted by name, so that they are listed (and serialized) in the order of name.
+static bool lessName(const std::pair<AMLSymbol, AMLData*>& element, const std::string& name)
+{
+    return element.first.str() < name;
+}
+
 /*
  * "id" is automatically created using "deviceId" and "timeStamp".
  * e.g.) "deviceId" : "Robot", "timeStamp" : "001" -> "id" : "Robot_001"
  */
 AMLObject::AMLObject(const std::string& deviceId, const std::string& timeStamp)
- : m_deviceId(deviceId), m_timeStamp(timeStamp), m_id(deviceId + "_" + timeStamp)
+ : m_deviceId(deviceId), m_timeStamp(timeStamp), m_id(deviceId + "_" + timeStamp), m_arena(nullptr)
 {
     VERIFY_NON_EMPTY_THROW_EXCEPTION(deviceId);
     VERIFY_NON_EMPTY_THROW_EXCEPTION(timeStamp);
 }
 
 AMLObject::AMLObject(const std::string& deviceId, const std::string& timeStamp, const std::string& id)
- : m_deviceId(deviceId), m_timeStamp(timeStamp), m_id(id)
+ : m_deviceId(deviceId), m_timeStamp(timeStamp), m_id(id), m_arena(nullptr)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(deviceId);
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(timeStamp);
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(id);
+}
+
+AMLObject::AMLObject(const std::string& deviceId, const std::string& timeStamp, const std::string& id, AMLArena* arena)
+ : m_deviceId(deviceId), m_timeStamp(timeStamp), m_id(id), m_arena(arena), m_amlDatas(DataVector::allocator_type(arena))
 {
     VERIFY_NON_EMPTY_THROW_EXCEPTION(deviceId);
     VERIFY_NON_EMPTY_THROW_EXCEPTION(timeStamp);
@@ -50,57 +67,139 @@ AMLObject::AMLObject(const std::string& deviceId, const std::string& timeStamp,
 }
 
 AMLObject::AMLObject(const AMLObject& t)
- : m_deviceId(t.getDeviceId()), m_timeStamp(t.getTimeStamp()), m_id(t.getId())
+ : m_deviceId(t.getDeviceId()), m_timeStamp(t.getTimeStamp()), m_id(t.getId()), m_arena(nullptr)
 {
     t.copyObject(this);
 }
 
+AMLObject::AMLObject(AMLObject&& t) noexcept
+ : m_deviceId(std::move(t.m_deviceId)), m_timeStamp(std::move(t.m_timeStamp)), m_id(std::move(t.m_id)), m_arena(t.m_arena), m_amlDatas(std::move(t.m_amlDatas))
+{
+    t.m_amlDatas.clear();
+}
+
 AMLObject& AMLObject::operator=(const AMLObject& t)
 {
     if (&t != this)
     {
-        const_cast<std::string&>(m_deviceId) = t.getDeviceId();
-        const_cast<std::string&>(m_timeStamp) = t.getTimeStamp();
-        const_cast<std::string&>(m_id) = t.getId();
+        m_deviceId = t.getDeviceId();
+        m_timeStamp = t.getTimeStamp();
+        m_id = t.getId();
 
+        clearObject();
         t.copyObject(this);
     }
     return *this;
 }
 
-AMLObject::~AMLObject(void)
+AMLObject& AMLObject::operator=(AMLObject&& t) noexcept
 {
-    if (!m_amlDatas.empty()) 
+    if (&t != this)
     {
-        for (auto const& iter : m_amlDatas)
+        m_deviceId.swap(t.m_deviceId);
+        m_timeStamp.swap(t.m_timeStamp);
+        m_id.swap(t.m_id);
+
+        clearObject();
+        if (m_arena == t.m_arena)
+        {
+            m_amlDatas.swap(t.m_amlDatas);
+        }
+        else
         {
-            delete iter.second;
+            // AMLData in another arena should not outlive it, so they are copied into ours.
+            t.copyObject(this);
         }
     }
+    return *this;
+}
+
+static_assert(std::is_nothrow_move_constructible<AMLObject>::value, "AMLObject should be nothrow move constructible");
+static_assert(std::is_nothrow_move_assignable<AMLObject>::value, "AMLObject should be nothrow move assignable");
+
+AMLObject::~AMLObject(void)
+{
+    clearObject();
 }
 
 void AMLObject::addData(const std::string& name, const AMLData& data)
 {
     VERIFY_NON_EMPTY_THROW_EXCEPTION(name);
 
-    AMLData* amlData = new AMLData();
-    *amlData = data;
+    AMLSymbol symbol = AMLSymbol::lookup(name, m_arena);
+    DataVector::iterator iter = findInsertPosition(symbol);
 
-    //Try to insert a new element into the map and if the key already exists, throw an exeption.
-    std::pair<const std::string, AMLData*> temp = std::make_pair(name, amlData);
-    if (!m_amlDatas.insert(temp).second)
+    AMLData* amlData = newData(m_arena);
+    try
     {
-        AML_LOG_V(ERROR, TAG, "Name already exist in AMLObject : %s", name.c_str());
-        throw AMLException(KEY_ALREADY_EXIST);
+        *amlData = data;
+        m_amlDatas.insert(iter, DataEntry(symbol, amlData));
+    }
+    catch (...)
+    {
+        deleteData(m_arena, amlData);
+        throw;
+    }
+}
+
+void AMLObject::addData(const std::string& name, AMLData&& data)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(name);
+
+    addData(AMLSymbol::lookup(name, m_arena), std::move(data));
+}
+
+void AMLObject::addData(const AMLSymbol& name, AMLData&& data)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(name);
+
+    DataVector::iterator iter = findInsertPosition(name);
+
+    AMLData* amlData = newData(m_arena);
+    try
+    {
+        *amlData = std::move(data);
+        m_amlDatas.insert(iter, DataEntry(name.placeIn(m_arena), amlData));
+    }
+    catch (...)
+    {
+        deleteData(m_arena, amlData);
+        throw;
+    }
+}
+
+AMLData& AMLObject::emplaceData(const std::string& name)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(name);
+
+    return emplaceData(AMLSymbol::lookup(name, m_arena));
+}
+
+AMLData& AMLObject::emplaceData(const AMLSymbol& name)
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(name);
+
+    DataVector::iterator iter = findInsertPosition(name);
+
+    AMLData* amlData = newData(m_arena);
+    try
+    {
+        m_amlDatas.insert(iter, DataEntry(name.placeIn(m_arena), amlData));
     }
+    catch (...)
+    {
+        deleteData(m_arena, amlData);
+        throw;
+    }
+    return *amlData;
 }
 
 const AMLData& AMLObject::getData(const std::string& name) const
 {
     VERIFY_NON_EMPTY_THROW_EXCEPTION(name);
 
-    map<string, AMLData*>::iterator iter = m_amlDatas.find(name);
-    if (iter == m_amlDatas.end())
+    DataVector::const_iterator iter = std::lower_bound(m_amlDatas.begin(), m_amlDatas.end(), name, lessName);
+    if (iter == m_amlDatas.end() || iter->first.str() != name)
     {
         // The name does not exist.
         AML_LOG_V(ERROR, TAG, "Name does not exist in AMLObject : %s", name.c_str());
@@ -109,12 +208,30 @@ const AMLData& AMLObject::getData(const std::string& name) const
     return *(iter->second);
 }
 
+const AMLData& AMLObject::getData(const AMLSymbol& name) const
+{
+    VERIFY_NON_EMPTY_THROW_EXCEPTION(name);
+
+    // An event has a few AMLData, so they are scanned.
+    for (auto const& element : m_amlDatas)
+    {
+        if (element.first == name)
+        {
+            return *element.second;
+        }
+    }
+
+    AML_LOG_V(ERROR, TAG, "Name does not exist in AMLObject : %s", name.str().c_str());
+    throw AMLException(KEY_NOT_EXIST);
+}
+
 vector<string> AMLObject::getDataNames() const
 {
     vector<string> dataNames;
+    dataNames.reserve(m_amlDatas.size());
     for (auto const& iter : m_amlDatas)
     {
-        dataNames.push_back(iter.first);
+        dataNames.push_back(iter.first.str());
     }
 
     return dataNames;
@@ -139,8 +256,45 @@ void AMLObject::copyObject(AMLObject* target) const
 {
     for (auto const& element : m_amlDatas)
     {
-        string key(element.first);
+        DataVector::iterator iter = target->findInsertPosition(element.first);
 
-        target->addData(key, *element.second);
+        AMLData* amlData = newData(target->m_arena);
+        try
+        {
+            *amlData = *element.second;
+            target->m_amlDatas.insert(iter, DataEntry(element.first.placeIn(target->m_arena), amlData));
+        }
+        catch (...)
+        {
+            deleteData(target->m_arena, amlData);
+            throw;
+        }
+    }
+}
+
+AMLObject::DataVector::iterator AMLObject::findInsertPosition(const AMLSymbol& name)
+{
+    // AMLData are mostly added in order, so the end is checked first
+    if (m_amlDatas.empty() || m_amlDatas.back().first < name)
+    {
+        return m_amlDatas.end();
+    }
+
+    DataVector::iterator iter = std::lower_bound(m_amlDatas.begin(), m_amlDatas.end(), name.str(), lessName);
+    if (iter->first == name)
+    {
+        //If the name already exists, throw an exeption.
+        AML_LOG_V(ERROR, TAG, "Name already exist in AMLObject : %s", name.str().c_str());
+        throw AMLException(KEY_ALREADY_EXIST);
+    }
+    return iter;
+}
+
+void AMLObject::clearObject()
+{
+    for (auto const& iter : m_amlDatas)
+    {
+        deleteData(m_arena, iter.second);
     }
+    m_amlDatas.clear();
 }
\ No newline at end of file
@@ -0,0 +1,230 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <mutex>
+
+#include "AMLObjectView.h"
+#include "AMLObjectViewSource.h"
+#include "AMLArena.h"
+#include "AMLDataAlloc.h"
+#include "AMLException.h"
+#include "AMLLogger.h"
+
+#define TAG "AMLObjectView"
+
+using namespace std;
+using namespace AML;
+
+namespace
+{
+
+struct Entry
+{
+    AMLSymbol   name;
+    size_t      position;   // position in the payload, which is given to Source::decodeData()
+    AMLData*    data;       // nullptr until it is decoded
+};
+
+bool lessEntry(const Entry& a, const Entry& b)
+{
+    return a.name < b.name;
+}
+
+bool lessName(const Entry& entry, const std::string& name)
+{
+    return entry.name.str() < name;
+}
+
+} // namespace
+
+class AMLObjectView::Impl
+{
+public:
+    explicit Impl(Source* source) : m_source(source), m_decodedCount(0)
+    {
+    }
+
+    ~Impl()
+    {
+        // AMLData are placed in the arena, which frees their memory
+        for (auto& entry : m_entries)
+        {
+            if (nullptr != entry.data)
+            {
+                deleteData(&m_arena, entry.data);
+            }
+        }
+        delete m_source;
+    }
+
+    void index()
+    {
+        std::vector<AMLSymbol> names;
+        m_source->index(m_deviceId, m_timeStamp, m_id, names);
+
+        // the same checks as AMLObject which is converted from the payload
+        if (m_deviceId.empty() || m_timeStamp.empty() || m_id.empty())
+        {
+            AML_LOG(ERROR, TAG, "Invalid AML : device, timestamp or id of the event is empty");
+            throw AMLException(INVALID_PARAM);
+        }
+
+        m_entries.reserve(names.size());
+        for (size_t position = 0; position < names.size(); ++position)
+        {
+            if (names[position].empty())
+            {
+                AML_LOG(ERROR, TAG, "Invalid AML : name of data is empty");
+                throw AMLException(INVALID_PARAM);
+            }
+
+            Entry entry = {names[position], position, nullptr};
+            m_entries.push_back(entry);
+        }
+
+        std::stable_sort(m_entries.begin(), m_entries.end(), lessEntry);
+        for (size_t i = 1; i < m_entries.size(); ++i)
+        {
+            if (m_entries[i - 1].name == m_entries[i].name)
+            {
+                AML_LOG_V(ERROR, TAG, "Name already exist in AMLObject : %s", m_entries[i].name.str().c_str());
+                throw AMLException(KEY_ALREADY_EXIST);
+            }
+        }
+    }
+
+    const AMLData& getData(Entry& entry)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (nullptr == entry.data)
+        {
+            AMLData* amlData = newData(&m_arena);
+            try
+            {
+                m_source->decodeData(entry.position, &m_arena, amlData);
+            }
+            catch (...)
+            {
+                deleteData(&m_arena, amlData);
+                throw;
+            }
+
+            entry.data = amlData;
+            m_decodedCount++;
+        }
+        return *entry.data;
+    }
+
+    Entry& findEntry(const std::string& name)
+    {
+        auto iter = std::lower_bound(m_entries.begin(), m_entries.end(), name, lessName);
+        if (iter == m_entries.end() || iter->name.str() != name)
+        {
+            // The name does not exist.
+            AML_LOG_V(ERROR, TAG, "Name does not exist in AMLObject : %s", name.c_str());
+            throw AMLException(KEY_NOT_EXIST);
+        }
+        return *iter;
+    }
+
+    Source*                 m_source;
+    std::string             m_deviceId;
+    std::string             m_timeStamp;
+    std::string             m_id;
+    std::vector<Entry>      m_entries;      // sorted by name, as AMLObject
+    AMLArena                m_arena;
+    size_t                  m_decodedCount;
+    std::mutex              m_mutex;        // guards decoding, which writes the arena and the entries
+};
+
+AMLObjectView::AMLObjectView(Source* source) : m_impl(nullptr)
+{
+    try
+    {
+        m_impl = new Impl(source);
+    }
+    catch (...)
+    {
+        delete source;
+        throw;
+    }
+
+    try
+    {
+        m_impl->index();
+    }
+    catch (...)
+    {
+        delete m_impl;
+        throw;
+    }
+}
+
+AMLObjectView::~AMLObjectView(void)
+{
+    delete m_impl;
+}
+
+const AMLData& AMLObjectView::getData(const std::string& name) const
+{
+    if (name.empty())
+    {
+        throw AMLException(INVALID_PARAM);
+    }
+
+    return m_impl->getData(m_impl->findEntry(name));
+}
+
+const AMLData& AMLObjectView::getData(const AMLSymbol& name) const
+{
+    return getData(name.str());
+}
+
+vector<string> AMLObjectView::getDataNames() const
+{
+    vector<string> dataNames;
+    dataNames.reserve(m_impl->m_entries.size());
+    for (auto const& entry : m_impl->m_entries)
+    {
+        dataNames.push_back(entry.name.str());
+    }
+    return dataNames;
+}
+
+const std::string& AMLObjectView::getDeviceId() const
+{
+    return m_impl->m_deviceId;
+}
+
+const std::string& AMLObjectView::getTimeStamp() const
+{
+    return m_impl->m_timeStamp;
+}
+
+const std::string& AMLObjectView::getId() const
+{
+    return m_impl->m_id;
+}
+
+size_t AMLObjectView::getDecodedCount() const
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    return m_impl->m_decodedCount;
+}
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <utility>
+
+#include "AMLProjection.h"
+#include "AMLException.h"
+#include "AMLLogger.h"
+
+#define TAG "AMLProjection"
+
+using namespace std;
+using namespace AML;
+
+static const char PATH_SEPARATOR = '/';
+
+class AMLProjection::Impl
+{
+public:
+    Impl() : m_all(false)
+    {
+    }
+
+    ~Impl()
+    {
+        clear();
+    }
+
+    void clear()
+    {
+        for (auto& child : m_children)
+        {
+            delete child.second;
+        }
+        m_children.clear();
+    }
+
+    bool                                    m_all;      // every name at this level is selected with all its children
+    std::map<std::string, AMLProjection*>   m_children;
+};
+
+AMLProjection::AMLProjection(void) : m_impl(new Impl())
+{
+}
+
+AMLProjection::AMLProjection(const std::vector<std::string>& paths) : m_impl(new Impl())
+{
+    try
+    {
+        for (const std::string& path : paths)
+        {
+            add(path);
+        }
+    }
+    catch (...)
+    {
+        delete m_impl;
+        throw;
+    }
+}
+
+AMLProjection::~AMLProjection(void)
+{
+    delete m_impl;
+}
+
+void AMLProjection::add(const std::string& path)
+{
+    // check the whole path first, so that nothing is added for an invalid one
+    if (path.empty() || PATH_SEPARATOR == path[0] || PATH_SEPARATOR == path[path.size() - 1] ||
+        std::string::npos != path.find("//"))
+    {
+        AML_LOG_V(ERROR, TAG, "Invalid parameter : path has an empty name : \"%s\"", path.c_str());
+        throw AMLException(INVALID_PARAM);
+    }
+
+    AMLProjection* projection = this;
+    size_t begin = 0;
+    while (false == projection->m_impl->m_all)
+    {
+        size_t end = path.find(PATH_SEPARATOR, begin);
+        std::string name = path.substr(begin, end - begin);
+
+        auto& children = projection->m_impl->m_children;
+        auto iter = children.find(name);
+        if (iter == children.end())
+        {
+            std::unique_ptr<AMLProjection> child(new AMLProjection());
+            iter = children.insert(std::make_pair(name, child.get())).first;
+            child.release();
+        }
+        projection = iter->second;
+
+        if (std::string::npos == end)
+        {
+            // the last name selects all of its children, including the paths which have been added under it
+            projection->m_impl->clear();
+            projection->m_impl->m_all = true;
+            break;
+        }
+        begin = end + 1;
+    }
+}
+
+bool AMLProjection::select(const std::string& name, const AMLProjection** children) const
+{
+    if (m_impl->m_all)
+    {
+        *children = nullptr;
+        return true;
+    }
+
+    auto iter = m_impl->m_children.find(name);
+    if (iter == m_impl->m_children.end())
+    {
+        return false;
+    }
+
+    *children = iter->second->m_impl->m_all ? nullptr : iter->second;
+    return true;
+}
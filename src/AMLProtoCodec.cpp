@@ -0,0 +1,1440 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#ifndef _DISABLE_PROTOBUF_
+
+#include <string.h>
+#include <cassert>
+#include <climits>
+#include <string>
+#include <vector>
+#include <utility>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
+#include "AMLProtoCodec.h"
+#include "AMLOutputBuffer.h"
+#include "AMLObjectViewSource.h"
+#include "AMLSchema.h"
+#include "AMLScalar.h"
+#include "AMLInterface.h"
+#include "AMLException.h"
+#include "AMLLogger.h"
+#include "AML.pb.h"
+
+#define TAG "AMLProtoCodec"
+
+using namespace std;
+using namespace AML;
+
+using google::protobuf::uint8;
+using google::protobuf::uint32;
+using google::protobuf::uint64;
+using google::protobuf::io::CodedInputStream;
+using google::protobuf::io::CodedOutputStream;
+using google::protobuf::internal::WireFormatLite;
+
+static const char EVENT[]                           = "Event";
+
+static const char KEY_DEVICE[]                      = "device";
+static const char KEY_ID[]                          = "id";
+static const char KEY_TIMESTAMP[]                   = "timestamp";
+
+// CAEXFile attributes which are written on every AML(XML) document
+static const std::string CAEX_FILE_NAME             = "";
+static const std::string CAEX_SCHEMA_VERSION        = "2.15";
+static const std::string CAEX_XSI                   = "CAEX_ClassModel_V2.15.xsd";
+static const std::string CAEX_XMLNS                 = "http://www.w3.org/2001/XMLSchema-instance";
+
+// Largest sizes of varints, which are reserved before a tag, a size or a value is written
+static const size_t MAX_VARINT32_SIZE               = 5;
+static const size_t MAX_VARINT64_SIZE               = 10;
+
+namespace
+{
+
+/**
+ * Writes wire bytes in two passes over the same traversal.
+ * The first pass resolves values from AMLObject and measures the size of every nested message in pre-order,
+ * then the second pass writes the bytes into a buffer of the exact size using the measured sizes,
+ * or into the chunks of AMLSinkBuffer, so that nothing is written if the first pass throws.
+ */
+class ProtoEncoder
+{
+public:
+    ProtoEncoder(const AMLSchema& schema, const AMLObject& amlObject, ByteLayout layout)
+     : m_schema(schema), m_amlObject(amlObject), m_layout(layout), m_target(nullptr), m_sink(nullptr), m_sizeIndex(0), m_valueIndex(0)
+    {
+    }
+
+    size_t measure()
+    {
+        m_target = nullptr;
+        return encodeCAEXFile();
+    }
+
+    void write(uint8* target)
+    {
+        m_target = target;
+        m_sizeIndex = 0;
+        m_valueIndex = 0;
+        encodeCAEXFile();
+    }
+
+    void write(AMLSinkBuffer& sink)
+    {
+        m_sink = &sink;
+        write(reinterpret_cast<uint8*>(sink.reserve()));
+        sink.commit(reinterpret_cast<char*>(m_target));
+    }
+
+private:
+    union Value
+    {
+        const std::string*                  str;
+        const std::vector<std::string>*     strArr;
+        const AMLData*                      data;
+        const InternalElementSchema*        suc;
+        AMLValueType                        type;
+    };
+
+    const AMLSchema&        m_schema;
+    const AMLObject&        m_amlObject;
+    const ByteLayout        m_layout;
+    uint8*                  m_target;
+    AMLSinkBuffer*          m_sink;             // m_target is in the chunk of the sink, if it is not null
+
+    std::vector<uint32>     m_sizes;
+    size_t                  m_sizeIndex;
+    std::vector<Value>      m_values;
+    size_t                  m_valueIndex;
+    std::vector<std::string> m_dataNames;
+
+    bool isMeasuring() const
+    {
+        return nullptr == m_target;
+    }
+
+    // Makes room for size bytes at m_target, which is AMLSinkBuffer::MAX_RESERVE or less. The chunk of a sink is sent when it is full.
+    void reserve(size_t size)
+    {
+        if (nullptr != m_sink)
+        {
+            assert(size <= AMLSinkBuffer::MAX_RESERVE);
+            (void)size;
+            m_sink->commit(reinterpret_cast<char*>(m_target));
+            m_target = reinterpret_cast<uint8*>(m_sink->reserve());
+        }
+    }
+
+    // Strings and binaries are copied into the chunks of a sink, as they can be larger than a chunk.
+    void writeRaw(const void* data, size_t size)
+    {
+        if (nullptr != m_sink)
+        {
+            m_sink->commit(reinterpret_cast<char*>(m_target));
+            m_sink->append(static_cast<const char*>(data), size);
+            m_target = reinterpret_cast<uint8*>(m_sink->reserve());
+        }
+        else
+        {
+            m_target = CodedOutputStream::WriteRawToArray(data, static_cast<int>(size), m_target);
+        }
+    }
+
+    static size_t fieldSize(uint32 field, size_t size)
+    {
+        uint32 tag = WireFormatLite::MakeTag(field, WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
+        return CodedOutputStream::VarintSize32(tag) + CodedOutputStream::VarintSize32(static_cast<uint32>(size)) + size;
+    }
+
+    size_t encodeString(uint32 field, const std::string& value)
+    {
+        if (!isMeasuring())
+        {
+            reserve(2 * MAX_VARINT32_SIZE);
+            m_target = CodedOutputStream::WriteTagToArray(WireFormatLite::MakeTag(field, WireFormatLite::WIRETYPE_LENGTH_DELIMITED), m_target);
+            m_target = CodedOutputStream::WriteVarint32ToArray(static_cast<uint32>(value.size()), m_target);
+            writeRaw(value.data(), value.size());
+        }
+        return fieldSize(field, value.size());
+    }
+
+    // Nested message : the tag and the size are written before its fields.
+    size_t beginMessage(uint32 field)
+    {
+        if (isMeasuring())
+        {
+            m_sizes.push_back(0);
+            return m_sizes.size() - 1;
+        }
+
+        uint32 size = m_sizes[m_sizeIndex];
+        reserve(2 * MAX_VARINT32_SIZE);
+        m_target = CodedOutputStream::WriteTagToArray(WireFormatLite::MakeTag(field, WireFormatLite::WIRETYPE_LENGTH_DELIMITED), m_target);
+        m_target = CodedOutputStream::WriteVarint32ToArray(size, m_target);
+        return m_sizeIndex++;
+    }
+
+    size_t endMessage(uint32 field, size_t index, size_t size)
+    {
+        if (isMeasuring())
+        {
+            m_sizes[index] = static_cast<uint32>(size);
+        }
+        return fieldSize(field, size);
+    }
+
+    // Values are resolved(and verified) from AMLData only on the first pass.
+    template <typename T>
+    const T* resolve(const T* value, const T* Value::* member)
+    {
+        if (isMeasuring())
+        {
+            Value v;
+            v.*member = value;
+            m_values.push_back(v);
+            return value;
+        }
+        return m_values[m_valueIndex++].*member;
+    }
+
+    const std::string* resolveStr(const AMLData* amlData, const AMLSymbol& key)
+    {
+        return resolve<std::string>(isMeasuring() ? &amlData->getValueToStr(key) : nullptr, &Value::str);
+    }
+
+    const std::vector<std::string>* resolveStrArr(const AMLData* amlData, const AMLSymbol& key)
+    {
+        return resolve<std::vector<std::string>>(isMeasuring() ? &amlData->getValueToStrArr(key) : nullptr, &Value::strArr);
+    }
+
+    const AMLData* resolveAMLData(const AMLData* amlData, const AMLSymbol& key)
+    {
+        return resolve<AMLData>(isMeasuring() ? &amlData->getValueToAMLData(key) : nullptr, &Value::data);
+    }
+
+    AMLValueType resolveType(const AMLData* amlData, const AttributeSchema& attr)
+    {
+        if (isMeasuring())
+        {
+            Value v;
+            v.type = (AttributeKind::StringArray == attr.kind) ? getArrayValueType(*amlData, attr.symbol, attr.scalarType)
+                                                               : getScalarValueType(*amlData, attr.symbol, attr.scalarType);
+            m_values.push_back(v);
+            return v.type;
+        }
+        return m_values[m_valueIndex++].type;
+    }
+
+    // Typed values are written in the wire types of their fields, instead of text.
+    size_t encodeScalar(const AMLData& amlData, const AMLSymbol& key, AMLValueType type)
+    {
+        switch (type)
+        {
+            case AMLValueType::Integer:
+            {
+                int64_t value = amlData.getValueToInt(key);
+                if (!isMeasuring())
+                {
+                    reserve(MAX_VARINT32_SIZE + MAX_VARINT64_SIZE);
+                    m_target = WireFormatLite::WriteSInt64ToArray(datamodel::Attribute::kIntValueFieldNumber, value, m_target);
+                }
+                return CodedOutputStream::VarintSize32(WireFormatLite::MakeTag(datamodel::Attribute::kIntValueFieldNumber, WireFormatLite::WIRETYPE_VARINT)) +
+                       WireFormatLite::SInt64Size(value);
+            }
+            case AMLValueType::Double:
+                if (!isMeasuring())
+                {
+                    reserve(MAX_VARINT32_SIZE + WireFormatLite::kDoubleSize);
+                    m_target = WireFormatLite::WriteDoubleToArray(datamodel::Attribute::kDoubleValueFieldNumber, amlData.getValueToDouble(key), m_target);
+                }
+                return CodedOutputStream::VarintSize32(WireFormatLite::MakeTag(datamodel::Attribute::kDoubleValueFieldNumber, WireFormatLite::WIRETYPE_FIXED64)) +
+                       WireFormatLite::kDoubleSize;
+            case AMLValueType::Boolean:
+                if (!isMeasuring())
+                {
+                    reserve(MAX_VARINT32_SIZE + WireFormatLite::kBoolSize);
+                    m_target = WireFormatLite::WriteBoolToArray(datamodel::Attribute::kBoolValueFieldNumber, amlData.getValueToBool(key), m_target);
+                }
+                return CodedOutputStream::VarintSize32(WireFormatLite::MakeTag(datamodel::Attribute::kBoolValueFieldNumber, WireFormatLite::WIRETYPE_VARINT)) +
+                       WireFormatLite::kBoolSize;
+            case AMLValueType::Binary:
+            {
+                const std::vector<uint8_t>& value = amlData.getValueToBinary(key);
+                if (!isMeasuring())
+                {
+                    reserve(2 * MAX_VARINT32_SIZE);
+                    m_target = CodedOutputStream::WriteTagToArray(WireFormatLite::MakeTag(datamodel::Attribute::kBinaryValueFieldNumber, WireFormatLite::WIRETYPE_LENGTH_DELIMITED), m_target);
+                    m_target = CodedOutputStream::WriteVarint32ToArray(static_cast<uint32>(value.size()), m_target);
+                    writeRaw(value.data(), value.size());
+                }
+                return fieldSize(datamodel::Attribute::kBinaryValueFieldNumber, value.size());
+            }
+            default:
+                break;
+        }
+        return 0;
+    }
+
+    // Elements of a numeric array are packed into a single field, whose size is measured as the one of a nested message.
+    size_t encodePackedArray(const AMLData& amlData, const AMLSymbol& key, AMLValueType type)
+    {
+        if (AMLValueType::IntegerArray == type)
+        {
+            const std::vector<int64_t>& values = amlData.getValueToIntArr(key);
+            size_t index = beginMessage(datamodel::Attribute::kIntArrayValueFieldNumber);
+            size_t size = 0;
+            if (isMeasuring())
+            {
+                for (int64_t value : values)
+                {
+                    size += WireFormatLite::SInt64Size(value);
+                }
+            }
+            else
+            {
+                for (int64_t value : values)
+                {
+                    reserve(MAX_VARINT64_SIZE);
+                    m_target = WireFormatLite::WriteSInt64NoTagToArray(value, m_target);
+                }
+            }
+            return endMessage(datamodel::Attribute::kIntArrayValueFieldNumber, index, size);
+        }
+
+        const std::vector<double>& values = amlData.getValueToDoubleArr(key);
+        size_t index = beginMessage(datamodel::Attribute::kDoubleArrayValueFieldNumber);
+        if (!isMeasuring())
+        {
+            for (double value : values)
+            {
+                reserve(WireFormatLite::kDoubleSize);
+                m_target = WireFormatLite::WriteDoubleNoTagToArray(value, m_target);
+            }
+        }
+        return endMessage(datamodel::Attribute::kDoubleArrayValueFieldNumber, index, values.size() * WireFormatLite::kDoubleSize);
+    }
+
+    size_t encodeCAEXFile()
+    {
+        size_t size = 0;
+        size += encodeString(datamodel::CAEXFile::kFileNameFieldNumber,       CAEX_FILE_NAME);
+        size += encodeString(datamodel::CAEXFile::kSchemaVersionFieldNumber,  CAEX_SCHEMA_VERSION);
+        size += encodeString(datamodel::CAEXFile::kXsiFieldNumber,            CAEX_XSI);
+        size += encodeString(datamodel::CAEXFile::kXmlnsFieldNumber,          CAEX_XMLNS);
+
+        // set IH name to be the same as SUCL name
+        const uint32 field = datamodel::CAEXFile::kInstanceHierarchyFieldNumber;
+        size_t index = beginMessage(field);
+        size_t ihSize = 0;
+        ihSize += encodeString(datamodel::InstanceHierarchy::kNameFieldNumber, m_schema.getName());
+        ihSize += encodeEvent(datamodel::InstanceHierarchy::kInternalElementFieldNumber);
+        size += endMessage(field, index, ihSize);
+
+        return size;
+    }
+
+    const InternalElementSchema* findSystemUnitClass(const std::string& name)
+    {
+        const InternalElementSchema* suc = m_schema.findSystemUnitClass(name);
+        if (nullptr == suc)
+        {
+            AML_LOG_V(ERROR, TAG, "Invalid Data : <%s> is not present in SystemUnitClassLib", name.c_str());
+            throw AMLException(NOT_MATCH_TO_AML_MODEL);
+        }
+        return suc;
+    }
+
+    size_t encodeInternalElementHeader(const InternalElementSchema& ie)
+    {
+        size_t size = 0;
+        size += encodeString(datamodel::InternalElement::kNameFieldNumber,                  ie.name);
+        size += encodeString(datamodel::InternalElement::kRefBaseSystemUnitPathFieldNumber, ie.refBaseSystemUnitPath);
+
+        if (ie.hasSupportedRoleClass)
+        {
+            const uint32 field = datamodel::InternalElement::kSupportedRoleClassFieldNumber;
+            size_t index = beginMessage(field);
+            size_t srcSize = encodeString(datamodel::SupportedRoleClass::kRefRoleClassPathFieldNumber, ie.refRoleClassPath);
+            size += endMessage(field, index, srcSize);
+        }
+
+        for (const InternalElementSchema& child : ie.internalElements)
+        {
+            size += encodeInternalElement(datamodel::InternalElement::kInternalElementFieldNumber, child, nullptr);
+        }
+        return size;
+    }
+
+    size_t encodeEvent(uint32 field)
+    {
+        const InternalElementSchema* event = findSystemUnitClass(EVENT);
+
+        size_t index = beginMessage(field);
+        size_t size = encodeInternalElementHeader(*event);
+
+        // add AMLDatas into Event
+        const vector<string>& dataNames = isMeasuring() ? (m_dataNames = m_amlObject.getDataNames()) : m_dataNames;
+        for (const string& name : dataNames)
+        {
+            const InternalElementSchema* suc = resolve<InternalElementSchema>(isMeasuring() ? findSystemUnitClass(name) : nullptr, &Value::suc);
+            const AMLData* amlData = resolve<AMLData>(isMeasuring() ? &m_amlObject.getData(name) : nullptr, &Value::data);
+
+            size += encodeInternalElement(datamodel::InternalElement::kInternalElementFieldNumber, *suc, amlData);
+        }
+
+        // set default attributes of Event (This has a dependency on AMLObject class..)
+        for (const AttributeSchema& attr : event->attributes)
+        {
+            const std::string* value = nullptr;
+            if      (attr.name == KEY_DEVICE)       value = &m_amlObject.getDeviceId();
+            else if (attr.name == KEY_TIMESTAMP)    value = &m_amlObject.getTimeStamp();
+            else if (attr.name == KEY_ID)           value = &m_amlObject.getId();
+
+            size += encodeAttribute(datamodel::InternalElement::kAttributeFieldNumber, attr, AttributeKind::Static, value, nullptr);
+        }
+
+        return endMessage(field, index, size);
+    }
+
+    size_t encodeInternalElement(uint32 field, const InternalElementSchema& ie, const AMLData* amlData)
+    {
+        size_t index = beginMessage(field);
+        size_t size = encodeInternalElementHeader(ie);
+
+        for (const AttributeSchema& attr : ie.attributes)
+        {
+            size += encodeAttribute(datamodel::InternalElement::kAttributeFieldNumber, attr, amlData);
+        }
+
+        return endMessage(field, index, size);
+    }
+
+    size_t encodeAttribute(uint32 field, const AttributeSchema& attr, const AMLData* amlData)
+    {
+        const std::string* value = nullptr;
+        const std::vector<std::string>* valueArray = nullptr;
+        const AMLData* nested = nullptr;
+        AMLValueType type = AMLValueType::String;
+
+        switch (nullptr == amlData ? AttributeKind::Static : attr.kind)
+        {
+            case AttributeKind::String:
+                type = resolveType(amlData, attr);
+                if (AMLValueType::String == type)
+                {
+                    value = resolveStr(amlData, attr.symbol);
+                }
+                else
+                {
+                    nested = amlData;   // which has the typed value
+                }
+                break;
+            case AttributeKind::StringArray:
+                type = resolveType(amlData, attr);
+                if (AMLValueType::StringArray == type)
+                {
+                    valueArray = resolveStrArr(amlData, attr.symbol);
+                }
+                else
+                {
+                    nested = amlData;   // which has the numeric array
+                }
+                break;
+            case AttributeKind::AMLData:
+                nested = resolveAMLData(amlData, attr.symbol);
+                break;
+            case AttributeKind::Static:
+                break;
+            case AttributeKind::Invalid:
+                AML_LOG_V(ERROR, TAG, "Invalid AML : <%s> has value of invalid type", attr.name.c_str());
+                throw AMLException(INVALID_AML_SCHEMA);
+        }
+
+        if (AttributeKind::StringArray == attr.kind && nullptr != amlData)
+        {
+            return encodeArrayAttribute(field, attr, valueArray, nested, type);
+        }
+        return encodeAttribute(field, attr, attr.kind, value, nested, type);
+    }
+
+    // 'nested' is AMLData of the children if kind is AMLData, or AMLData which has the value if type is not String.
+    size_t encodeAttribute(uint32 field, const AttributeSchema& attr, AttributeKind kind, const std::string* value, const AMLData* nested,
+                           AMLValueType type = AMLValueType::String)
+    {
+        size_t index = beginMessage(field);
+        size_t size = 0;
+
+        size += encodeString(datamodel::Attribute::kNameFieldNumber,              attr.name);
+        size += encodeString(datamodel::Attribute::kAttributeDataTypeFieldNumber, attr.dataType);
+
+        // The <Value> which is already present in the model comes first.
+        if (attr.hasValue)          size += encodeString(datamodel::Attribute::kValueFieldNumber, attr.value);
+        else if (nullptr != value)  size += encodeString(datamodel::Attribute::kValueFieldNumber, *value);
+        else if (nullptr != nested && AMLValueType::String != type) size += encodeScalar(*nested, attr.symbol, type);
+
+        size += encodeRefSemantic(attr);
+
+        for (const AttributeSchema& child : attr.attributes)
+        {
+            size += encodeAttribute(datamodel::Attribute::kAttributeFieldNumber, child, (AttributeKind::AMLData == kind) ? nested : nullptr);
+        }
+
+        return endMessage(field, index, size);
+    }
+
+    // The elements are either child attributes of a string array, or a packed field of a numeric array in 'amlData'.
+    size_t encodeArrayAttribute(uint32 field, const AttributeSchema& attr, const std::vector<std::string>* valueArray, const AMLData* amlData,
+                                AMLValueType type)
+    {
+        size_t index = beginMessage(field);
+        size_t size = 0;
+
+        // As AML Document(BPR MLA, V 1.0.0), 'AttributeDataType' of the parent attribute node should be kept empty.
+        size += encodeString(datamodel::Attribute::kNameFieldNumber,              attr.name);
+        size += encodeString(datamodel::Attribute::kAttributeDataTypeFieldNumber, std::string());
+
+        if (attr.hasValue)
+        {
+            size += encodeString(datamodel::Attribute::kValueFieldNumber, attr.value);
+        }
+
+        size += encodeRefSemantic(attr);
+
+        for (const AttributeSchema& child : attr.attributes)
+        {
+            size += encodeAttribute(datamodel::Attribute::kAttributeFieldNumber, child, nullptr);
+        }
+
+        if (nullptr == valueArray)
+        {
+            size += encodePackedArray(*amlData, attr.symbol, type);
+            return endMessage(field, index, size);
+        }
+
+        // The elements only, as their names and AttributeDataType are given by the model.
+        if (ByteLayout::Compact == m_layout)
+        {
+            for (const std::string& element : *valueArray)
+            {
+                size += encodeString(datamodel::Attribute::kStringArrayValueFieldNumber, element);
+            }
+            return endMessage(field, index, size);
+        }
+
+        // The names of child attribute are "1", "2", "3"...
+        const uint32 childField = datamodel::Attribute::kAttributeFieldNumber;
+        for (std::size_t i = 0, count = valueArray->size(); i != count; ++i)
+        {
+            size_t childIndex = beginMessage(childField);
+            size_t childSize = 0;
+
+            childSize += encodeString(datamodel::Attribute::kNameFieldNumber,               std::to_string(i + 1));
+            childSize += encodeString(datamodel::Attribute::kAttributeDataTypeFieldNumber,  attr.dataType);
+            childSize += encodeString(datamodel::Attribute::kValueFieldNumber,              (*valueArray)[i]);
+
+            size += endMessage(childField, childIndex, childSize);
+        }
+
+        return endMessage(field, index, size);
+    }
+
+    size_t encodeRefSemantic(const AttributeSchema& attr)
+    {
+        if (!attr.hasRefSemantic)
+        {
+            return 0;
+        }
+
+        const uint32 field = datamodel::Attribute::kRefSemanticFieldNumber;
+        size_t index = beginMessage(field);
+        size_t size = encodeString(datamodel::RefSemantic::kCorrespondingAttributePathFieldNumber, attr.correspondingAttributePath);
+        return endMessage(field, index, size);
+    }
+};
+
+/**
+ * Type of a message in AML.proto which can be present in 'datamodel::CAEXFile'.
+ */
+enum class ProtoMessage
+{
+    CAEXFile = 0,
+    InstanceHierarchy,
+    InternalElement,
+    SupportedRoleClass,
+    RefSemantic,
+    Attribute,
+    None            // string field
+};
+
+#define FIELD_BIT(field)    (1u << (field))
+
+// Returns false if the field is not known to the message type.
+static bool lookupField(ProtoMessage type, uint32 field, ProtoMessage* nested, bool* repeated)
+{
+    *nested = ProtoMessage::None;
+    *repeated = false;
+
+    switch (type)
+    {
+        case ProtoMessage::CAEXFile:
+            if (datamodel::CAEXFile::kInstanceHierarchyFieldNumber == field)
+            {
+                *nested = ProtoMessage::InstanceHierarchy;
+                *repeated = true;
+                return true;
+            }
+            return (datamodel::CAEXFile::kFileNameFieldNumber <= field && datamodel::CAEXFile::kXmlnsFieldNumber >= field);
+
+        case ProtoMessage::InstanceHierarchy:
+            if (datamodel::InstanceHierarchy::kInternalElementFieldNumber == field)
+            {
+                *nested = ProtoMessage::InternalElement;
+                *repeated = true;
+                return true;
+            }
+            return (datamodel::InstanceHierarchy::kNameFieldNumber == field || datamodel::InstanceHierarchy::kVersionFieldNumber == field);
+
+        case ProtoMessage::InternalElement:
+            if (datamodel::InternalElement::kSupportedRoleClassFieldNumber == field)
+            {
+                *nested = ProtoMessage::SupportedRoleClass;
+                return true;
+            }
+            if (datamodel::InternalElement::kInternalElementFieldNumber == field || datamodel::InternalElement::kAttributeFieldNumber == field)
+            {
+                *nested = (datamodel::InternalElement::kAttributeFieldNumber == field) ? ProtoMessage::Attribute : ProtoMessage::InternalElement;
+                *repeated = true;
+                return true;
+            }
+            return (datamodel::InternalElement::kNameFieldNumber == field || datamodel::InternalElement::kRefBaseSystemUnitPathFieldNumber == field);
+
+        case ProtoMessage::SupportedRoleClass:
+            return (datamodel::SupportedRoleClass::kRefRoleClassPathFieldNumber == field);
+
+        case ProtoMessage::RefSemantic:
+            return (datamodel::RefSemantic::kCorrespondingAttributePathFieldNumber == field);
+
+        case ProtoMessage::Attribute:
+            if (datamodel::Attribute::kRefSemanticFieldNumber == field)
+            {
+                *nested = ProtoMessage::RefSemantic;
+                return true;
+            }
+            if (datamodel::Attribute::kAttributeFieldNumber == field)
+            {
+                *nested = ProtoMessage::Attribute;
+                *repeated = true;
+                return true;
+            }
+            return (datamodel::Attribute::kNameFieldNumber <= field && datamodel::Attribute::kValueFieldNumber >= field);
+
+        case ProtoMessage::None:
+            break;
+    }
+    return false;
+}
+
+static uint32 requiredFields(ProtoMessage type)
+{
+    switch (type)
+    {
+        case ProtoMessage::CAEXFile:
+            return FIELD_BIT(datamodel::CAEXFile::kFileNameFieldNumber) | FIELD_BIT(datamodel::CAEXFile::kSchemaVersionFieldNumber) |
+                   FIELD_BIT(datamodel::CAEXFile::kXsiFieldNumber) | FIELD_BIT(datamodel::CAEXFile::kXmlnsFieldNumber);
+        case ProtoMessage::InstanceHierarchy:
+            return FIELD_BIT(datamodel::InstanceHierarchy::kNameFieldNumber);
+        case ProtoMessage::InternalElement:
+            return FIELD_BIT(datamodel::InternalElement::kNameFieldNumber);
+        case ProtoMessage::SupportedRoleClass:
+            return FIELD_BIT(datamodel::SupportedRoleClass::kRefRoleClassPathFieldNumber);
+        case ProtoMessage::RefSemantic:
+            return FIELD_BIT(datamodel::RefSemantic::kCorrespondingAttributePathFieldNumber);
+        case ProtoMessage::Attribute:
+            return FIELD_BIT(datamodel::Attribute::kNameFieldNumber) | FIELD_BIT(datamodel::Attribute::kAttributeDataTypeFieldNumber);
+        case ProtoMessage::None:
+            break;
+    }
+    return 0;
+}
+
+// Checks the elements of a packed numeric array, which the generated message fails to parse if they are not well-formed.
+static bool validatePackedArray(CodedInputStream* input, uint32 field)
+{
+    uint32 length;
+    if (false == input->ReadVarint32(&length) || length > static_cast<uint32>(input->BytesUntilLimit()))
+    {
+        return false;
+    }
+
+    if (datamodel::Attribute::kDoubleArrayValueFieldNumber == field)
+    {
+        return 0 == length % WireFormatLite::kDoubleSize && input->Skip(static_cast<int>(length));
+    }
+
+    CodedInputStream::Limit limit = input->PushLimit(static_cast<int>(length));
+    uint64 value;
+    while (0 != input->BytesUntilLimit())
+    {
+        if (false == input->ReadVarint64(&value))
+        {
+            return false;
+        }
+    }
+    input->PopLimit(limit);
+    return true;
+}
+
+/**
+ * Checks the wire bytes with the same rule as 'ParseFromString()' of the generated message,
+ * i.e. well-formed wire format, known fields of wrong wire type and unknown fields are skipped, and all required fields are set.
+ * 'present' gets the bits of (known) fields which are present in the message.
+ */
+static bool validateMessage(CodedInputStream* input, ProtoMessage type, uint32* present)
+{
+    *present = 0;
+
+    // A singular message field which appears several times is merged, so its required fields are checked after all.
+    bool hasSingular = false;
+    ProtoMessage singularType = ProtoMessage::None;
+    uint32 singularPresent = 0;
+
+    while (0 != input->BytesUntilLimit())
+    {
+        uint32 tag = input->ReadTag();
+        uint32 field = WireFormatLite::GetTagFieldNumber(tag);
+        if (0 == field)
+        {
+            return false;
+        }
+
+        if (ProtoMessage::Attribute == type && WireFormatLite::WIRETYPE_LENGTH_DELIMITED == WireFormatLite::GetTagWireType(tag) &&
+            (datamodel::Attribute::kIntArrayValueFieldNumber == field || datamodel::Attribute::kDoubleArrayValueFieldNumber == field))
+        {
+            if (false == validatePackedArray(input, field))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        ProtoMessage nested;
+        bool repeated;
+        if (WireFormatLite::WIRETYPE_LENGTH_DELIMITED != WireFormatLite::GetTagWireType(tag) ||
+            false == lookupField(type, field, &nested, &repeated))
+        {
+            if (false == WireFormatLite::SkipField(input, tag))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        uint32 length;
+        if (false == input->ReadVarint32(&length) || length > static_cast<uint32>(input->BytesUntilLimit()))
+        {
+            return false;
+        }
+
+        if (ProtoMessage::None == nested)
+        {
+            if (false == input->Skip(static_cast<int>(length)))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            if (false == input->IncrementRecursionDepth())
+            {
+                return false;
+            }
+            CodedInputStream::Limit limit = input->PushLimit(static_cast<int>(length));
+
+            uint32 nestedPresent;
+            if (false == validateMessage(input, nested, &nestedPresent))
+            {
+                return false;
+            }
+
+            input->PopLimit(limit);
+            input->DecrementRecursionDepth();
+
+            if (repeated)
+            {
+                if (requiredFields(nested) != (nestedPresent & requiredFields(nested)))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                hasSingular = true;
+                singularType = nested;
+                singularPresent |= nestedPresent;
+            }
+        }
+
+        *present |= FIELD_BIT(field);
+    }
+
+    if (hasSingular && requiredFields(singularType) != (singularPresent & requiredFields(singularType)))
+    {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Bytes of a length-delimited field in the buffer given by caller.
+ */
+struct ProtoBytes
+{
+    ProtoBytes() : data(nullptr), size(0) {}
+    ProtoBytes(const uint8* d, int s) : data(d), size(s) {}
+
+    const uint8*    data;
+    int             size;
+};
+
+/**
+ * Iterates length-delimited fields of a message which has been validated already.
+ * Typed values of 'datamodel::Attribute' are iterated by nextValue(), which returns varint and fixed64 fields as well.
+ */
+class ProtoFieldReader
+{
+public:
+    explicit ProtoFieldReader(const ProtoBytes& message)
+     : m_base(message.data), m_input(message.data, message.size)
+    {
+    }
+
+    bool next(uint32* field, ProtoBytes* bytes)
+    {
+        uint32 tag;
+        while (0 != (tag = m_input.ReadTag()))
+        {
+            if (WireFormatLite::WIRETYPE_LENGTH_DELIMITED != WireFormatLite::GetTagWireType(tag))
+            {
+                WireFormatLite::SkipField(&m_input, tag);
+                continue;
+            }
+
+            uint32 length = 0;
+            m_input.ReadVarint32(&length);
+            *bytes = ProtoBytes(m_base + m_input.CurrentPosition(), static_cast<int>(length));
+            m_input.Skip(bytes->size);
+
+            *field = WireFormatLite::GetTagFieldNumber(tag);
+            return true;
+        }
+        return false;
+    }
+
+    bool nextValue(uint32* field, WireFormatLite::WireType* wireType, ProtoBytes* bytes, uint64* value)
+    {
+        uint32 tag;
+        while (0 != (tag = m_input.ReadTag()))
+        {
+            *field = WireFormatLite::GetTagFieldNumber(tag);
+            *wireType = WireFormatLite::GetTagWireType(tag);
+            switch (*wireType)
+            {
+                case WireFormatLite::WIRETYPE_VARINT:
+                    m_input.ReadVarint64(value);
+                    return true;
+                case WireFormatLite::WIRETYPE_FIXED64:
+                    m_input.ReadLittleEndian64(value);
+                    return true;
+                case WireFormatLite::WIRETYPE_LENGTH_DELIMITED:
+                {
+                    uint32 length = 0;
+                    m_input.ReadVarint32(&length);
+                    *bytes = ProtoBytes(m_base + m_input.CurrentPosition(), static_cast<int>(length));
+                    m_input.Skip(bytes->size);
+                    return true;
+                }
+                default:
+                    WireFormatLite::SkipField(&m_input, tag);
+                    break;
+            }
+        }
+        return false;
+    }
+
+private:
+    const uint8*        m_base;
+    CodedInputStream    m_input;
+};
+
+// String values have been passed through AML(XML) as C strings, so they end at the first '\0'.
+static size_t textLength(const ProtoBytes& bytes)
+{
+    if (0 == bytes.size)
+    {
+        return 0;
+    }
+
+    const void* end = memchr(bytes.data, '\0', bytes.size);
+    return (nullptr == end) ? bytes.size : static_cast<size_t>(static_cast<const uint8*>(end) - bytes.data);
+}
+
+static std::string toText(const ProtoBytes& bytes)
+{
+    return std::string(reinterpret_cast<const char*>(bytes.data), textLength(bytes));
+}
+
+static bool isText(const ProtoBytes& bytes, const char* text)
+{
+    size_t length = strlen(text);
+    return textLength(bytes) == length && 0 == memcmp(bytes.data, text, length);
+}
+
+// Returns the index of array element from its name "1".."count", or 0 if the name is not one of them.
+static size_t toArrayIndex(const ProtoBytes& name, size_t count)
+{
+    size_t length = textLength(name);
+    if (0 == length || '0' == name.data[0])
+    {
+        return 0;
+    }
+
+    size_t index = 0;
+    for (size_t i = 0; i < length; ++i)
+    {
+        uint8 c = name.data[i];
+        if (c < '0' || c > '9')
+        {
+            return 0;
+        }
+        index = index * 10 + (c - '0');
+        if (index > count)
+        {
+            return 0;
+        }
+    }
+    return index;
+}
+
+static void decodeAmlData(const AMLSchema& schema, const ProtoBytes& message, uint32 attributeField, const AMLProjection* projection,
+                          AMLArena* arena, AMLData* amlData);
+
+static void decodeStringArray(const ProtoBytes& message, size_t count, std::vector<std::string>* values)
+{
+    // Each element gets the value of the first child attribute which has its index as name, or "" if there is none.
+    values->assign(count, std::string());
+    std::vector<bool> found(count, false);
+
+    ProtoFieldReader reader(message);
+    uint32 field;
+    ProtoBytes child;
+    while (reader.next(&field, &child))
+    {
+        if (datamodel::Attribute::kAttributeFieldNumber != field)
+        {
+            continue;
+        }
+
+        ProtoBytes name, value;
+        ProtoFieldReader childReader(child);
+        ProtoBytes bytes;
+        while (childReader.next(&field, &bytes))
+        {
+            if      (datamodel::Attribute::kNameFieldNumber == field)   name = bytes;
+            else if (datamodel::Attribute::kValueFieldNumber == field)  value = bytes;
+        }
+
+        size_t index = toArrayIndex(name, count);
+        if (0 != index && false == found[index - 1])
+        {
+            found[index - 1] = true;
+            (*values)[index - 1] = toText(value);
+        }
+    }
+}
+
+// Elements of a string array in the compact layout, which are in the order of the list instead of being named by their indexes.
+static void decodeStringArrayValue(const ProtoBytes& message, size_t count, std::vector<std::string>* values)
+{
+    values->clear();
+    values->reserve(count);
+
+    ProtoFieldReader reader(message);
+    uint32 field;
+    ProtoBytes bytes;
+    while (reader.next(&field, &bytes))
+    {
+        if (datamodel::Attribute::kStringArrayValueFieldNumber == field)
+        {
+            values->push_back(toText(bytes));
+        }
+    }
+}
+
+// Elements of a packed numeric array, which has been validated already, are appended as an array may be split into several fields.
+static void decodePackedInts(const ProtoBytes& bytes, std::vector<int64_t>* values)
+{
+    // each varint ends at the byte whose most significant bit is clear
+    size_t count = 0;
+    for (int i = 0; i < bytes.size; ++i)
+    {
+        count += (0 == (bytes.data[i] & 0x80)) ? 1 : 0;
+    }
+    values->reserve(values->size() + count);
+
+    CodedInputStream input(bytes.data, bytes.size);
+    uint64 bits;
+    while (input.ReadVarint64(&bits))
+    {
+        values->push_back(WireFormatLite::ZigZagDecode64(bits));
+    }
+}
+
+static void decodePackedDoubles(const ProtoBytes& bytes, std::vector<double>* values)
+{
+    size_t offset = values->size();
+    values->resize(offset + bytes.size / WireFormatLite::kDoubleSize);
+
+    const uint8* data = bytes.data;
+    for (size_t i = offset, size = values->size(); i != size; ++i)
+    {
+        uint64 bits;
+        data = CodedInputStream::ReadLittleEndian64FromArray(data, &bits);
+        (*values)[i] = WireFormatLite::DecodeDouble(bits);
+    }
+}
+
+static void decodeAttribute(const AMLSchema& schema, const ProtoBytes& message, const AMLProjection* projection, AMLArena* arena, AMLData* amlData)
+{
+    ProtoBytes name, value, binary;
+    bool hasValue = false, hasRefSemantic = false;
+    size_t sizeOfChildren = 0;
+    AMLValueType type = AMLValueType::String;   // of the typed value which comes last, if any
+    uint64 scalar = 0;
+    std::vector<int64_t> ints;                  // elements of a numeric array, packed or not
+    std::vector<double> doubles;
+    size_t sizeOfStrings = 0;                   // elements of a string array in the compact layout
+
+    ProtoFieldReader reader(message);
+    uint32 field;
+    WireFormatLite::WireType wireType;
+    ProtoBytes bytes;
+    uint64 bits;
+    while (reader.nextValue(&field, &wireType, &bytes, &bits))
+    {
+        if (WireFormatLite::WIRETYPE_LENGTH_DELIMITED == wireType)
+        {
+            switch (field)
+            {
+                case datamodel::Attribute::kNameFieldNumber:        name = bytes;                           break;
+                case datamodel::Attribute::kValueFieldNumber:       value = bytes;  hasValue = true;        break;
+                case datamodel::Attribute::kRefSemanticFieldNumber: hasRefSemantic = true;                  break;
+                case datamodel::Attribute::kAttributeFieldNumber:   ++sizeOfChildren;                       break;
+                case datamodel::Attribute::kBinaryValueFieldNumber:
+                    binary = bytes;
+                    type = AMLValueType::Binary;
+                    break;
+                case datamodel::Attribute::kIntArrayValueFieldNumber:
+                    decodePackedInts(bytes, &ints);
+                    type = AMLValueType::IntegerArray;
+                    break;
+                case datamodel::Attribute::kDoubleArrayValueFieldNumber:
+                    decodePackedDoubles(bytes, &doubles);
+                    type = AMLValueType::DoubleArray;
+                    break;
+                case datamodel::Attribute::kStringArrayValueFieldNumber:
+                    ++sizeOfStrings;
+                    type = AMLValueType::StringArray;
+                    break;
+                default:
+                    break;
+            }
+        }
+        else if (WireFormatLite::WIRETYPE_VARINT == wireType && datamodel::Attribute::kIntValueFieldNumber == field)
+        {
+            scalar = bits;
+            type = AMLValueType::Integer;
+        }
+        else if (WireFormatLite::WIRETYPE_FIXED64 == wireType && datamodel::Attribute::kDoubleValueFieldNumber == field)
+        {
+            scalar = bits;
+            type = AMLValueType::Double;
+        }
+        else if (WireFormatLite::WIRETYPE_VARINT == wireType && datamodel::Attribute::kBoolValueFieldNumber == field)
+        {
+            scalar = bits;
+            type = AMLValueType::Boolean;
+        }
+        else if (WireFormatLite::WIRETYPE_VARINT == wireType && datamodel::Attribute::kIntArrayValueFieldNumber == field)
+        {
+            ints.push_back(WireFormatLite::ZigZagDecode64(bits));
+            type = AMLValueType::IntegerArray;
+        }
+        else if (WireFormatLite::WIRETYPE_FIXED64 == wireType && datamodel::Attribute::kDoubleArrayValueFieldNumber == field)
+        {
+            doubles.push_back(WireFormatLite::DecodeDouble(bits));
+            type = AMLValueType::DoubleArray;
+        }
+    }
+
+    // the attribute which is not selected is skipped without decoding its children
+    const AMLProjection* keys = nullptr;
+    if (nullptr != projection && false == projection->select(toText(name), &keys))
+    {
+        return;
+    }
+
+    AMLSymbol key = schema.findSymbol(toText(name), arena);
+
+    if (hasValue)
+    {
+        amlData->setValue(key, toText(value));
+    }
+    else if (AMLValueType::Integer == type)
+    {
+        amlData->setIntValue(key, WireFormatLite::ZigZagDecode64(scalar));
+    }
+    else if (AMLValueType::Double == type)
+    {
+        amlData->setDoubleValue(key, WireFormatLite::DecodeDouble(scalar));
+    }
+    else if (AMLValueType::Boolean == type)
+    {
+        amlData->setBoolValue(key, 0 != scalar);
+    }
+    else if (AMLValueType::Binary == type && 0 != binary.size)
+    {
+        amlData->setBinaryValue(key, std::vector<uint8_t>(binary.data, binary.data + binary.size));
+    }
+    else if (AMLValueType::IntegerArray == type && false == ints.empty())
+    {
+        amlData->setIntArrayValue(key, std::move(ints));
+    }
+    else if (AMLValueType::DoubleArray == type && false == doubles.empty())
+    {
+        amlData->setDoubleArrayValue(key, std::move(doubles));
+    }
+    else if (AMLValueType::StringArray == type && hasRefSemantic)
+    {
+        vector<string> values;
+        decodeStringArrayValue(message, sizeOfStrings, &values);
+
+        amlData->setValue(key, std::move(values));
+    }
+    else if (hasRefSemantic)
+    {
+        vector<string> values;
+        decodeStringArray(message, sizeOfChildren, &values);
+
+        amlData->setValue(key, std::move(values));
+    }
+    else if (0 != sizeOfChildren)
+    {
+        AMLData nested(arena);
+        decodeAmlData(schema, message, datamodel::Attribute::kAttributeFieldNumber, keys, arena, &nested);
+
+        amlData->setValue(key, std::move(nested));
+    }
+    else
+    {
+        AML_LOG_V(ERROR, TAG, "Invalid AML : <%s> has value of invalid type", key.str().c_str());
+        throw AMLException(INVALID_AML_SCHEMA);
+    }
+}
+
+// Decodes the attributes which are selected by the projection, or all of them if it is nullptr.
+static void decodeAmlData(const AMLSchema& schema, const ProtoBytes& message, uint32 attributeField, const AMLProjection* projection,
+                          AMLArena* arena, AMLData* amlData)
+{
+    ProtoFieldReader reader(message);
+    uint32 field;
+    ProtoBytes attr;
+    while (reader.next(&field, &attr))
+    {
+        if (attributeField == field)
+        {
+            decodeAttribute(schema, attr, projection, arena, amlData);
+        }
+    }
+}
+
+static bool findField(const ProtoBytes& message, uint32 field, ProtoBytes* found)
+{
+    ProtoFieldReader reader(message);
+    uint32 f;
+    while (reader.next(&f, found))
+    {
+        if (field == f)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// The last one is taken for a singular field which appears several times.
+static ProtoBytes findLastField(const ProtoBytes& message, uint32 field)
+{
+    ProtoBytes found, bytes;
+    ProtoFieldReader reader(message);
+    uint32 f;
+    while (reader.next(&f, &bytes))
+    {
+        if (field == f)
+        {
+            found = bytes;
+        }
+    }
+    return found;
+}
+
+// Returns the first <InternalElement> named "Event" in the <InstanceHierarchy>.
+static bool findEvent(const ProtoBytes& ih, ProtoBytes* event)
+{
+    ProtoFieldReader reader(ih);
+    uint32 field;
+    while (reader.next(&field, event))
+    {
+        if (datamodel::InstanceHierarchy::kInternalElementFieldNumber == field &&
+            isText(findLastField(*event, datamodel::InternalElement::kNameFieldNumber), EVENT))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void readEvent(const ProtoBytes& event, std::string& deviceId, std::string& timeStamp, std::string& id)
+{
+    ProtoFieldReader reader(event);
+    uint32 field;
+    ProtoBytes bytes;
+    while (reader.next(&field, &bytes))
+    {
+        if (datamodel::InternalElement::kAttributeFieldNumber != field)
+        {
+            continue;
+        }
+
+        ProtoBytes name, value;
+        ProtoFieldReader attrReader(bytes);
+        ProtoBytes attrBytes;
+        while (attrReader.next(&field, &attrBytes))
+        {
+            if      (datamodel::Attribute::kNameFieldNumber == field)   name = attrBytes;
+            else if (datamodel::Attribute::kValueFieldNumber == field)  value = attrBytes;
+        }
+
+        if      (isText(name, KEY_DEVICE))      deviceId = toText(value);
+        else if (isText(name, KEY_TIMESTAMP))   timeStamp = toText(value);
+        else if (isText(name, KEY_ID))          id = toText(value);
+    }
+}
+
+static AMLSymbol dataName(const AMLSchema& schema, const ProtoBytes& ie, AMLArena* arena)
+{
+    return schema.findSymbol(toText(findLastField(ie, datamodel::InternalElement::kNameFieldNumber)), arena);
+}
+
+static AMLObject* decodeEvent(const AMLSchema& schema, const ProtoBytes& event, const AMLProjection* projection, AMLArena* arena)
+{
+    std::string deviceId, timeStamp, id;
+    readEvent(event, deviceId, timeStamp, id);
+
+    AMLObject* amlObj = new AMLObject(deviceId, timeStamp, id, arena);
+
+    try
+    {
+        ProtoFieldReader ieReader(event);
+        uint32 field;
+        ProtoBytes ie;
+        while (ieReader.next(&field, &ie))
+        {
+            if (datamodel::InternalElement::kInternalElementFieldNumber != field)
+            {
+                continue;
+            }
+
+            AMLSymbol name = dataName(schema, ie, arena);
+
+            // the data which is not selected is skipped without decoding its attributes
+            const AMLProjection* keys = nullptr;
+            if (nullptr != projection && false == projection->select(name.str(), &keys))
+            {
+                continue;
+            }
+
+            AMLData amlData(arena);
+            decodeAmlData(schema, ie, datamodel::InternalElement::kAttributeFieldNumber, keys, arena, &amlData);
+
+            amlObj->addData(name, std::move(amlData));
+        }
+    }
+    catch (...)
+    {
+        delete amlObj;
+        throw;
+    }
+
+    return amlObj;
+}
+
+// Checks that the bytes are a valid 'datamodel::CAEXFile', and returns its event.
+static ProtoBytes validateEvent(const char* data, size_t size)
+{
+    const uint8* buffer = reinterpret_cast<const uint8*>(data);
+
+    bool valid = (size <= static_cast<size_t>(INT_MAX));
+    if (valid)
+    {
+        CodedInputStream input(buffer, static_cast<int>(size));
+        input.PushLimit(static_cast<int>(size));
+
+        uint32 present;
+        valid = validateMessage(&input, ProtoMessage::CAEXFile, &present) &&
+                (requiredFields(ProtoMessage::CAEXFile) == (present & requiredFields(ProtoMessage::CAEXFile)));
+    }
+    if (false == valid)
+    {
+        AML_LOG(ERROR, TAG, "Failed to parse from string : Invalid byte");
+        throw AMLException(INVALID_BYTE_STR);
+    }
+
+    ProtoBytes caex(buffer, static_cast<int>(size));
+    ProtoBytes ih, event;
+    if (false == findField(caex, datamodel::CAEXFile::kInstanceHierarchyFieldNumber, &ih))
+    {
+        AML_LOG(ERROR, TAG, "<CAEXFile> or <InstanceHierarchy> does not exist");
+        throw AMLException(INVALID_AML_SCHEMA);
+    }
+    if (false == findEvent(ih, &event))
+    {
+        AML_LOG(ERROR, TAG, "<Event> does not exist");
+        throw AMLException(INVALID_AML_SCHEMA);
+    }
+    return event;
+}
+
+// Protobuf byte data of AMLObjectView, which keeps the position of each data
+class ProtoViewSource : public AMLObjectView::Source
+{
+public:
+    ProtoViewSource(const AMLSchema& schema, std::string&& data)
+     : m_schema(schema), m_data(std::move(data))
+    {
+    }
+
+    void index(std::string& deviceId, std::string& timeStamp, std::string& id, std::vector<AMLSymbol>& names) override
+    {
+        ProtoBytes event = validateEvent(m_data.data(), m_data.size());
+        readEvent(event, deviceId, timeStamp, id);
+
+        ProtoFieldReader ieReader(event);
+        uint32 field;
+        ProtoBytes ie;
+        while (ieReader.next(&field, &ie))
+        {
+            if (datamodel::InternalElement::kInternalElementFieldNumber == field)
+            {
+                m_ies.push_back(ie);
+                names.push_back(dataName(m_schema, ie, nullptr));
+            }
+        }
+    }
+
+    void decodeData(size_t position, AMLArena* arena, AMLData* amlData) const override
+    {
+        decodeAmlData(m_schema, m_ies[position], datamodel::InternalElement::kAttributeFieldNumber, nullptr, arena, amlData);
+    }
+
+private:
+    ProtoViewSource(const ProtoViewSource&);
+    ProtoViewSource& operator=(const ProtoViewSource&);
+
+    const AMLSchema&            m_schema;
+    const std::string           m_data;     // m_ies point into this string
+    std::vector<ProtoBytes>     m_ies;
+};
+
+static size_t measureMessage(ProtoEncoder& encoder)
+{
+    size_t size = encoder.measure();
+    if (size > static_cast<size_t>(INT_MAX))
+    {
+        AML_LOG(ERROR, TAG, "Failed to serialize : message is too large for protobuf");
+        throw AMLException(SERIALIZE_FAIL);
+    }
+    return size;
+}
+
+template <typename Buffer>
+static size_t appendMessage(const AMLSchema& schema, const AMLObject& amlObject, ByteLayout layout, Buffer& binary)
+{
+    ProtoEncoder encoder(schema, amlObject, layout);
+
+    size_t size = measureMessage(encoder);
+    if (0 != size)
+    {
+        size_t offset = binary.size();
+        binary.resize(offset + size);
+        encoder.write(reinterpret_cast<uint8*>(&binary[offset]));
+    }
+    return size;
+}
+
+} // namespace
+
+size_t AML::measureProto(const AMLSchema& schema, const AMLObject& amlObject, ByteLayout layout)
+{
+    ProtoEncoder encoder(schema, amlObject, layout);
+    return measureMessage(encoder);
+}
+
+size_t AML::serializeToProto(const AMLSchema& schema, const AMLObject& amlObject, ByteLayout layout, std::string& binary)
+{
+    return appendMessage(schema, amlObject, layout, binary);
+}
+
+size_t AML::serializeToProto(const AMLSchema& schema, const AMLObject& amlObject, ByteLayout layout, std::vector<char>& binary)
+{
+    return appendMessage(schema, amlObject, layout, binary);
+}
+
+size_t AML::serializeToProto(const AMLSchema& schema, const AMLObject& amlObject, ByteLayout layout, AMLOutputSink& sink)
+{
+    ProtoEncoder encoder(schema, amlObject, layout);
+
+    size_t size = measureMessage(encoder);
+    AMLSinkBuffer buffer(sink);
+    encoder.write(buffer);
+    buffer.flush();
+    return size;
+}
+
+AMLObject* AML::parseFromProto(const AMLSchema& schema, const char* data, size_t size, const AMLProjection* projection, AMLArena* arena)
+{
+    return decodeEvent(schema, validateEvent(data, size), projection, arena);
+}
+
+AMLObjectView::Source* AML::newProtoViewSource(const AMLSchema& schema, std::string&& data)
+{
+    return new ProtoViewSource(schema, std::move(data));
+}
+
+#endif // _DISABLE_PROTOBUF_
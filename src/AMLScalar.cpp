@@ -0,0 +1,636 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "AMLScalar.h"
+#include "AMLOutputBuffer.h"
+#include "AMLException.h"
+#include "AMLLogger.h"
+
+#define TAG "AMLScalar"
+
+using namespace std;
+using namespace AML;
+
+static const std::unordered_map<std::string, ScalarType>& getScalarTypes()
+{
+    static const std::unordered_map<std::string, ScalarType> types =
+    {
+        { "long",               ScalarType::Integer },
+        { "int",                ScalarType::Integer },
+        { "short",              ScalarType::Integer },
+        { "byte",               ScalarType::Integer },
+        { "integer",            ScalarType::Integer },
+        { "negativeInteger",    ScalarType::Integer },
+        { "nonNegativeInteger", ScalarType::Integer },
+        { "positiveInteger",    ScalarType::Integer },
+        { "nonPositiveInteger", ScalarType::Integer },
+        { "unsignedLong",       ScalarType::Integer },
+        { "unsignedInt",        ScalarType::Integer },
+        { "unsignedShort",      ScalarType::Integer },
+        { "unsignedByte",       ScalarType::Integer },
+        { "double",             ScalarType::Double },
+        { "float",              ScalarType::Double },
+        { "decimal",            ScalarType::Double },
+        { "boolean",            ScalarType::Boolean },
+        { "base64Binary",       ScalarType::Base64Binary },
+        { "hexBinary",          ScalarType::HexBinary }
+    };
+    return types;
+}
+
+ScalarType AML::toScalarType(const std::string& attributeDataType)
+{
+    // "xs:long", "xsd:long" and "long" are the same type
+    size_t colon = attributeDataType.find(':');
+    std::string localName = (std::string::npos == colon) ? attributeDataType : attributeDataType.substr(colon + 1);
+
+    auto iter = getScalarTypes().find(localName);
+    return (iter == getScalarTypes().end()) ? ScalarType::String : iter->second;
+}
+
+AMLValueType AML::getScalarValueType(const AMLData& data, const AMLSymbol& key, ScalarType scalarType)
+{
+    AMLValueType valueType = data.getValueType(key);
+    bool isMatched = false;
+    switch (valueType)
+    {
+        case AMLValueType::Integer:
+            isMatched = (ScalarType::Integer == scalarType || ScalarType::Double == scalarType);
+            break;
+        case AMLValueType::Double:
+            isMatched = (ScalarType::Double == scalarType);
+            break;
+        case AMLValueType::Boolean:
+            isMatched = (ScalarType::Boolean == scalarType);
+            break;
+        case AMLValueType::Binary:
+            isMatched = (ScalarType::Base64Binary == scalarType || ScalarType::HexBinary == scalarType);
+            break;
+        default:
+            return AMLValueType::String;
+    }
+
+    if (false == isMatched)
+    {
+        AML_LOG_V(ERROR, TAG, "Value of '%s' does not match AttributeDataType of the model", key.str().c_str());
+        throw AMLException(NOT_MATCH_TO_AML_MODEL);
+    }
+    return valueType;
+}
+
+AMLValueType AML::getArrayValueType(const AMLData& data, const AMLSymbol& key, ScalarType scalarType)
+{
+    AMLValueType valueType = data.getValueType(key);
+    bool isMatched = false;
+    switch (valueType)
+    {
+        case AMLValueType::IntegerArray:
+            isMatched = (ScalarType::Integer == scalarType || ScalarType::Double == scalarType);
+            break;
+        case AMLValueType::DoubleArray:
+            isMatched = (ScalarType::Double == scalarType);
+            break;
+        default:
+            return AMLValueType::StringArray;
+    }
+
+    if (false == isMatched)
+    {
+        AML_LOG_V(ERROR, TAG, "Value of '%s' does not match AttributeDataType of the model", key.str().c_str());
+        throw AMLException(NOT_MATCH_TO_AML_MODEL);
+    }
+    return valueType;
+}
+
+template <typename Output>
+void AML::appendScalar(const AMLData& data, const AMLSymbol& key, AMLValueType valueType, ScalarType scalarType, Output& out)
+{
+    switch (valueType)
+    {
+        case AMLValueType::Integer:
+            appendInt(data.getValueToInt(key), out);
+            break;
+        case AMLValueType::Double:
+            appendDouble(data.getValueToDouble(key), out);
+            break;
+        case AMLValueType::Boolean:
+            appendBool(data.getValueToBool(key), out);
+            break;
+        case AMLValueType::Binary:
+            if (ScalarType::HexBinary == scalarType)
+            {
+                appendHex(data.getValueToBinary(key), out);
+            }
+            else
+            {
+                appendBase64(data.getValueToBinary(key), out);
+            }
+            break;
+        case AMLValueType::IntegerArray:
+            appendIntList(data.getValueToIntArr(key), out);
+            break;
+        case AMLValueType::DoubleArray:
+            appendDoubleList(data.getValueToDoubleArr(key), out);
+            break;
+        default:
+            break;
+    }
+}
+
+// "-9223372036854775808"
+static const size_t MAX_INT_LENGTH = 20;
+
+static const char DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// Powers of ten which are exact in double
+static const double POWERS_OF_TEN[] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Writes the decimal digits of magnitude, two digits at a time, and returns the end of them.
+static char* formatDigits(uint64_t magnitude, char* out)
+{
+    char digits[MAX_INT_LENGTH];
+    char* first = digits + sizeof(digits);
+    while (magnitude >= 100)
+    {
+        unsigned int pair = static_cast<unsigned int>(magnitude % 100);
+        magnitude /= 100;
+        first -= 2;
+        memcpy(first, DIGIT_PAIRS + 2 * pair, 2);
+    }
+    if (magnitude >= 10)
+    {
+        first -= 2;
+        memcpy(first, DIGIT_PAIRS + 2 * magnitude, 2);
+    }
+    else
+    {
+        *--first = static_cast<char>('0' + magnitude);
+    }
+
+    size_t size = static_cast<size_t>(digits + sizeof(digits) - first);
+    memcpy(out, first, size);
+    return out + size;
+}
+
+static char* formatInt(int64_t value, char* out)
+{
+    uint64_t magnitude = static_cast<uint64_t>(value);
+    if (value < 0)
+    {
+        *out++ = '-';
+        magnitude = 0 - magnitude;
+    }
+    return formatDigits(magnitude, out);
+}
+
+// Writes a value which is a decimal of up to 15 significant digits between 1e-4 and 1e15, without snprintf().
+// The digits and the power of ten are exact, so that their quotient is rounded correctly as strtod() does, and
+// the text is the same as "%.15g" which writes such a value without exponent. Returns 0 for the other values.
+static int formatShortDecimal(double value, char* buf)
+{
+    double magnitude = std::fabs(value);
+    if (false == (magnitude >= 1e-4 && magnitude < 1e15))
+    {
+        return 0;
+    }
+
+    for (int decimals = 0; decimals < 20; ++decimals)
+    {
+        double scaled = magnitude * POWERS_OF_TEN[decimals];
+        if (scaled >= 1e15)
+        {
+            break;
+        }
+
+        double digits = std::floor(scaled + 0.5);
+        if (digits / POWERS_OF_TEN[decimals] != magnitude)
+        {
+            continue;
+        }
+
+        char text[MAX_INT_LENGTH];
+        int length = static_cast<int>(formatDigits(static_cast<uint64_t>(digits), text) - text);
+
+        char* out = buf;
+        if (value < 0)
+        {
+            *out++ = '-';
+        }
+        if (length <= decimals)
+        {
+            // "0.000ddd"
+            *out++ = '0';
+            *out++ = '.';
+            memset(out, '0', decimals - length);
+            out += decimals - length;
+            memcpy(out, text, length);
+            out += length;
+        }
+        else
+        {
+            memcpy(out, text, length - decimals);
+            out += length - decimals;
+            if (0 != decimals)
+            {
+                *out++ = '.';
+                memcpy(out, text + length - decimals, decimals);
+                out += decimals;
+            }
+        }
+        return static_cast<int>(out - buf);
+    }
+    return 0;
+}
+
+// Writes the text of value to buf, which has 32 bytes at least, and returns its size.
+static int formatDouble(double value, char* buf)
+{
+    // NaN and infinities are written as in XML schema
+    if (std::isnan(value) || std::isinf(value))
+    {
+        const char* text = std::isnan(value) ? "NaN" : ((value < 0) ? "-INF" : "INF");
+        int size = static_cast<int>(strlen(text));
+        memcpy(buf, text, size);
+        return size;
+    }
+
+    int size = formatShortDecimal(value, buf);
+    if (0 != size)
+    {
+        return size;
+    }
+
+    // 15 digits are enough for most values, and 17 digits for all of them
+    for (int precision = 15; precision <= 17; ++precision)
+    {
+        size = snprintf(buf, 32, "%.*g", precision, value);
+        if (strtod(buf, nullptr) == value)
+        {
+            break;
+        }
+    }
+    return size;
+}
+
+template <typename Output>
+void AML::appendInt(int64_t value, Output& out)
+{
+    char buf[MAX_INT_LENGTH];
+    out.append(buf, formatInt(value, buf) - buf);
+}
+
+template <typename Output>
+void AML::appendDouble(double value, Output& out)
+{
+    char buf[32];
+    out.append(buf, formatDouble(value, buf));
+}
+
+template <typename Output>
+void AML::appendIntList(const std::vector<int64_t>& values, Output& out)
+{
+    // an element and the space before it
+    char buf[MAX_INT_LENGTH + 1];
+    for (size_t i = 0, size = values.size(); i != size; ++i)
+    {
+        char* first = (0 != i) ? buf : buf + 1;
+        buf[0] = ' ';
+        out.append(first, formatInt(values[i], buf + 1) - first);
+    }
+}
+
+template <typename Output>
+void AML::appendDoubleList(const std::vector<double>& values, Output& out)
+{
+    char buf[32];
+    for (size_t i = 0, size = values.size(); i != size; ++i)
+    {
+        if (0 != i)
+        {
+            out.push_back(' ');
+        }
+        out.append(buf, formatDouble(values[i], buf));
+    }
+}
+
+template <typename Output>
+void AML::appendBool(bool value, Output& out)
+{
+    out.append(value ? "true" : "false");
+}
+
+template <typename Output>
+void AML::appendBase64(const std::vector<uint8_t>& value, Output& out)
+{
+    static const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    size_t i = 0;
+    for (; i + 3 <= value.size(); i += 3)
+    {
+        uint32_t bits = (value[i] << 16) | (value[i + 1] << 8) | value[i + 2];
+        out.push_back(ALPHABET[(bits >> 18) & 0x3F]);
+        out.push_back(ALPHABET[(bits >> 12) & 0x3F]);
+        out.push_back(ALPHABET[(bits >> 6) & 0x3F]);
+        out.push_back(ALPHABET[bits & 0x3F]);
+    }
+
+    size_t rest = value.size() - i;
+    if (0 != rest)
+    {
+        uint32_t bits = (value[i] << 16) | ((2 == rest) ? (value[i + 1] << 8) : 0);
+        out.push_back(ALPHABET[(bits >> 18) & 0x3F]);
+        out.push_back(ALPHABET[(bits >> 12) & 0x3F]);
+        out.push_back((2 == rest) ? ALPHABET[(bits >> 6) & 0x3F] : '=');
+        out.push_back('=');
+    }
+}
+
+template <typename Output>
+void AML::appendHex(const std::vector<uint8_t>& value, Output& out)
+{
+    static const char DIGITS[] = "0123456789ABCDEF";
+
+    for (uint8_t byte : value)
+    {
+        out.push_back(DIGITS[byte >> 4]);
+        out.push_back(DIGITS[byte & 0x0F]);
+    }
+}
+
+#define INSTANTIATE_APPENDERS(Output) \
+    template void AML::appendScalar<Output>(const AMLData&, const AMLSymbol&, AMLValueType, ScalarType, Output&); \
+    template void AML::appendInt<Output>(int64_t, Output&); \
+    template void AML::appendDouble<Output>(double, Output&); \
+    template void AML::appendIntList<Output>(const std::vector<int64_t>&, Output&); \
+    template void AML::appendDoubleList<Output>(const std::vector<double>&, Output&); \
+    template void AML::appendBool<Output>(bool, Output&); \
+    template void AML::appendBase64<Output>(const std::vector<uint8_t>&, Output&); \
+    template void AML::appendHex<Output>(const std::vector<uint8_t>&, Output&);
+
+INSTANTIATE_APPENDERS(std::string)
+INSTANTIATE_APPENDERS(AMLVectorBuffer)
+INSTANTIATE_APPENDERS(AMLSinkBuffer)
+
+// Parses the integer from c to end.
+static bool parseIntRange(const char* c, const char* end, int64_t& value)
+{
+    bool isNegative = (c != end && '-' == *c);
+    if (c != end && ('-' == *c || '+' == *c))
+    {
+        ++c;
+    }
+    if (c == end)
+    {
+        return false;
+    }
+
+    // accumulated as negative, whose range includes INT64_MIN
+    int64_t result = 0;
+    for (; c != end; ++c)
+    {
+        if (*c < '0' || *c > '9')
+        {
+            return false;
+        }
+        int digit = *c - '0';
+        if (result < (INT64_MIN + digit) / 10)
+        {
+            return false;
+        }
+        result = result * 10 - digit;
+    }
+
+    if (false == isNegative)
+    {
+        if (INT64_MIN == result)
+        {
+            return false;
+        }
+        result = -result;
+    }
+    value = result;
+    return true;
+}
+
+bool AML::parseInt(const std::string& text, int64_t& value)
+{
+    return parseIntRange(text.c_str(), text.c_str() + text.size(), value);
+}
+
+bool AML::parseDouble(const std::string& text, double& value)
+{
+    if (text.empty() || isspace(static_cast<unsigned char>(text[0])))
+    {
+        return false;
+    }
+    else if ("INF" == text || "-INF" == text)
+    {
+        value = ('-' == text[0]) ? -HUGE_VAL : HUGE_VAL;
+        return true;
+    }
+
+    char* end = nullptr;
+    double result = strtod(text.c_str(), &end);
+    if (end != text.c_str() + text.size())
+    {
+        return false;
+    }
+    value = result;
+    return true;
+}
+
+bool AML::parseBool(const std::string& text, bool& value)
+{
+    if ("true" == text || "1" == text)
+    {
+        value = true;
+    }
+    else if ("false" == text || "0" == text)
+    {
+        value = false;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+// White spaces which separate the elements of a list in XML schema
+static inline bool isListSpace(char c)
+{
+    return ' ' == c || '\t' == c || '\n' == c || '\r' == c;
+}
+
+// Parses an element which is a decimal of up to 15 significant digits without exponent, as formatShortDecimal() does in reverse.
+// Returns the end of the element, or nullptr for the other elements, which are parsed by strtod().
+static const char* parseShortDecimal(const char* c, double& value)
+{
+    bool isNegative = ('-' == *c);
+    if ('-' == *c || '+' == *c)
+    {
+        ++c;
+    }
+
+    uint64_t digits = 0;
+    int count = 0, decimals = 0;    // count of significant digits, which follow leading zeros
+    bool hasDigit = false, hasPoint = false;
+    for (; ; ++c)
+    {
+        if (*c >= '0' && *c <= '9')
+        {
+            digits = digits * 10 + (*c - '0');
+            count += (0 != digits) ? 1 : 0;
+            decimals += hasPoint ? 1 : 0;
+            hasDigit = true;
+        }
+        else if ('.' == *c && false == hasPoint)
+        {
+            hasPoint = true;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (false == hasDigit || count > 15 || decimals > 22 || ('\0' != *c && false == isListSpace(*c)))
+    {
+        return nullptr;
+    }
+
+    double result = static_cast<double>(digits) / POWERS_OF_TEN[decimals];
+    value = isNegative ? -result : result;
+    return c;
+}
+
+static size_t countListElements(const char* c)
+{
+    size_t count = 0;
+    bool isSpace = true;
+    for (; '\0' != *c; ++c)
+    {
+        bool isNextSpace = isListSpace(*c);
+        count += (isSpace && false == isNextSpace) ? 1 : 0;
+        isSpace = isNextSpace;
+    }
+    return count;
+}
+
+bool AML::parseIntList(const std::string& text, std::vector<int64_t>& values)
+{
+    const char* c = text.c_str();
+    std::vector<int64_t> result;
+    result.reserve(countListElements(c));
+
+    while (true)
+    {
+        while (isListSpace(*c))
+        {
+            ++c;
+        }
+        if ('\0' == *c)
+        {
+            break;
+        }
+
+        const char* first = c;
+        while ('\0' != *c && false == isListSpace(*c))
+        {
+            ++c;
+        }
+
+        int64_t value = 0;
+        if (false == parseIntRange(first, c, value))
+        {
+            return false;
+        }
+        result.push_back(value);
+    }
+
+    if (result.empty())
+    {
+        return false;
+    }
+    values.swap(result);
+    return true;
+}
+
+bool AML::parseDoubleList(const std::string& text, std::vector<double>& values)
+{
+    const char* c = text.c_str();
+    std::vector<double> result;
+    result.reserve(countListElements(c));
+
+    while (true)
+    {
+        while (isListSpace(*c))
+        {
+            ++c;
+        }
+        if ('\0' == *c)
+        {
+            break;
+        }
+
+        double value = 0;
+        const char* end = parseShortDecimal(c, value);
+        if (nullptr == end)
+        {
+            // strtod() stops at the space after the element, which it does not skip unlike the spaces before
+            char* strtodEnd = nullptr;
+            value = strtod(c, &strtodEnd);
+            if (strtodEnd == c || ('\0' != *strtodEnd && false == isListSpace(*strtodEnd)))
+            {
+                return false;
+            }
+            end = strtodEnd;
+        }
+        result.push_back(value);
+        c = end;
+    }
+
+    if (result.empty())
+    {
+        return false;
+    }
+    values.swap(result);
+    return true;
+}
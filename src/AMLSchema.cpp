@@ -0,0 +1,457 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "pugixml.hpp"
+
+#include "AMLSchema.h"
+#include "AMLModelImage.h"
+#include "AMLException.h"
+#include "AMLLogger.h"
+
+#define TAG "AMLSchema"
+
+using namespace std;
+using namespace AML;
+
+static const char SYSTEM_UNIT_CLASS[]               = "SystemUnitClass";
+static const char ROLE_CLASS[]                      = "RoleClass";
+static const char INTERNAL_ELEMENT[]                = "InternalElement";
+static const char ATTRIBUTE[]                       = "Attribute";
+static const char REF_SEMANTIC[]                    = "RefSemantic";
+static const char SUPPORTED_ROLE_CLASS[]            = "SupportedRoleClass";
+
+static const char NAME[]                            = "Name";
+static const char VALUE[]                           = "Value";
+static const char ATTRIBUTE_DATA_TYPE[]             = "AttributeDataType";
+static const char DESCRIPTION[]                     = "Description";
+static const char REF_BASE_SYSTEM_UNIT_PATH[]       = "RefBaseSystemUnitPath";
+static const char REF_ROLE_CLASS_PATH[]             = "RefRoleClassPath";
+static const char CORRESPONDING_ATTRIBUTE_PATH[]    = "CorrespondingAttributePath";
+static const char ORDERED_LIST_TYPE[]               = "OrderedListType";
+
+#define IS_VALUE_TYPE_STRING_ARRAY(node)        ((NULL != (node).child(REF_SEMANTIC)) && \
+                                                 0 != strncmp((node).attribute(CORRESPONDING_ATTRIBUTE_PATH).value(), ORDERED_LIST_TYPE, strlen(ORDERED_LIST_TYPE)))
+#define IS_VALUE_TYPE_MAP(node)                 ((NULL == (node).child(REF_SEMANTIC)) && (NULL != (node).child(ATTRIBUTE)))
+
+// The kind is resolved with the same rule that has been applied to the copied SystemUnitClass on each conversion.
+static AttributeKind resolveKind(pugi::xml_node xml_attr)
+{
+    if (NULL != xml_attr.child(DESCRIPTION))
+    {
+        return (NULL == xml_attr.child(DESCRIPTION).next_sibling()) ? AttributeKind::String : AttributeKind::Static;
+    }
+    else if (NULL == xml_attr.first_child()) // If <Attribute> does not have any child like <Value> or <RefSemantic>, it has a single string value.
+    {
+        return AttributeKind::String;
+    }
+    else if (IS_VALUE_TYPE_STRING_ARRAY(xml_attr))
+    {
+        return AttributeKind::StringArray;
+    }
+    else if (IS_VALUE_TYPE_MAP(xml_attr))
+    {
+        return AttributeKind::AMLData;
+    }
+
+    return AttributeKind::Invalid;
+}
+
+AMLSymbol AMLSymbolTable::intern(const std::string& name)
+{
+    auto iter = m_symbols.find(name);
+    if (iter == m_symbols.end())
+    {
+        iter = m_symbols.insert(std::make_pair(name, AMLSymbol(name))).first;
+    }
+    return iter->second;
+}
+
+AMLSymbol AMLSymbolTable::find(const std::string& name, AMLArena* arena) const
+{
+    auto iter = m_symbols.find(name);
+    if (iter == m_symbols.end())
+    {
+        return AMLSymbol::uninterned(name, arena);
+    }
+    return iter->second;
+}
+
+static void compileAttribute(pugi::xml_node xml_attr, bool isStatic, AttributeSchema* attr, AMLSymbolTable* symbols)
+{
+    attr->name      = xml_attr.attribute(NAME).value();
+    attr->symbol    = symbols->intern(attr->name);
+    attr->dataType  = xml_attr.attribute(ATTRIBUTE_DATA_TYPE).value();
+    attr->scalarType = toScalarType(attr->dataType);
+    attr->kind      = isStatic ? AttributeKind::Static : resolveKind(xml_attr);
+
+    pugi::xml_node xml_value = xml_attr.child(VALUE);
+    if (NULL != xml_value)
+    {
+        attr->hasValue = true;
+        attr->value = xml_value.text().as_string();
+    }
+
+    pugi::xml_node xml_refSemantic = xml_attr.child(REF_SEMANTIC);
+    if (NULL != xml_refSemantic)
+    {
+        attr->hasRefSemantic = true;
+        attr->correspondingAttributePath = xml_refSemantic.attribute(CORRESPONDING_ATTRIBUTE_PATH).value();
+    }
+
+    // Only the children of map type get values from AMLData, the others are kept as they are in the model.
+    bool isStaticChild = (AttributeKind::AMLData != attr->kind);
+    for (pugi::xml_node xml_child = xml_attr.child(ATTRIBUTE); xml_child; xml_child = xml_child.next_sibling(ATTRIBUTE))
+    {
+        attr->attributes.push_back(AttributeSchema());
+        compileAttribute(xml_child, isStaticChild, &attr->attributes.back(), symbols);
+    }
+}
+
+static void compileInternalElement(pugi::xml_node xml_ie, bool isStatic, InternalElementSchema* ie, AMLSymbolTable* symbols)
+{
+    ie->node = xml_ie;
+    ie->name = xml_ie.attribute(NAME).value();
+    ie->symbol = symbols->intern(ie->name);
+    ie->refBaseSystemUnitPath = xml_ie.attribute(REF_BASE_SYSTEM_UNIT_PATH).value();
+
+    pugi::xml_node xml_src = xml_ie.child(SUPPORTED_ROLE_CLASS);
+    if (NULL != xml_src)
+    {
+        ie->hasSupportedRoleClass = true;
+        ie->refRoleClassPath = xml_src.attribute(REF_ROLE_CLASS_PATH).value();
+    }
+
+    for (pugi::xml_node xml_attr = xml_ie.child(ATTRIBUTE); xml_attr; xml_attr = xml_attr.next_sibling(ATTRIBUTE))
+    {
+        ie->attributes.push_back(AttributeSchema());
+        compileAttribute(xml_attr, isStatic, &ie->attributes.back(), symbols);
+    }
+
+    for (pugi::xml_node xml_child = xml_ie.child(INTERNAL_ELEMENT); xml_child; xml_child = xml_child.next_sibling(INTERNAL_ELEMENT))
+    {
+        ie->internalElements.push_back(InternalElementSchema());
+        compileInternalElement(xml_child, true, &ie->internalElements.back(), symbols);
+    }
+}
+
+AMLSchema::AMLSchema(pugi::xml_node systemUnitClassLib, pugi::xml_node roleClassLib)
+ : m_name(systemUnitClassLib.attribute(NAME).value()), m_roleClassLibName(roleClassLib.attribute(NAME).value())
+{
+    for (pugi::xml_node xml_suc = systemUnitClassLib.child(SYSTEM_UNIT_CLASS); xml_suc; xml_suc = xml_suc.next_sibling(SYSTEM_UNIT_CLASS))
+    {
+        m_systemUnitClassNames.push_back(xml_suc.attribute(NAME).value());
+    }
+
+    for (pugi::xml_node xml_rc = roleClassLib.child(ROLE_CLASS); xml_rc; xml_rc = xml_rc.next_sibling(ROLE_CLASS))
+    {
+        pugi::xml_attribute xml_name = xml_rc.attribute(NAME);
+        if (NULL == xml_name)
+        {
+            continue;
+        }
+
+        std::string rcName(xml_name.value());
+        if (m_roleClasses.find(rcName) != m_roleClasses.end())
+        {
+            AML_LOG_V(WARNING, TAG, "Duplicated RoleClass is ignored : %s", rcName.c_str());
+            continue;
+        }
+
+        RoleClassSchema& rc = m_roleClasses[rcName];
+        rc.name = rcName;
+        for (pugi::xml_node xml_attr = xml_rc.child(ATTRIBUTE); xml_attr; xml_attr = xml_attr.next_sibling(ATTRIBUTE))
+        {
+            rc.attributes.push_back(std::make_pair(std::string(xml_attr.attribute(NAME).value()), std::string(xml_attr.child_value(VALUE))));
+        }
+    }
+
+    for (pugi::xml_node xml_suc = systemUnitClassLib.first_child(); xml_suc; xml_suc = xml_suc.next_sibling())
+    {
+        pugi::xml_attribute xml_name = xml_suc.attribute(NAME);
+        if (NULL == xml_name)
+        {
+            continue;
+        }
+
+        // As lookup by name returns the first matched one, the later SystemUnitClass which has a duplicated name is ignored.
+        std::string sucName(xml_name.value());
+        if (m_systemUnitClasses.find(sucName) != m_systemUnitClasses.end())
+        {
+            AML_LOG_V(WARNING, TAG, "Duplicated SystemUnitClass is ignored : %s", sucName.c_str());
+            continue;
+        }
+
+        InternalElementSchema& suc = m_systemUnitClasses[sucName];
+        compileInternalElement(xml_suc, false, &suc, &m_symbols);
+
+        // RefBaseSystemUnitPath is appended to the instance of SystemUnitClass unless the model already has it.
+        if (NULL == xml_suc.attribute(REF_BASE_SYSTEM_UNIT_PATH))
+        {
+            suc.refBaseSystemUnitPath = m_name + "/" + sucName;
+        }
+    }
+}
+
+static void releaseNode(InternalElementSchema* ie)
+{
+    ie->node = pugi::xml_node();
+    for (InternalElementSchema& child : ie->internalElements)
+    {
+        releaseNode(&child);
+    }
+}
+
+void AMLSchema::releaseNodes()
+{
+    for (auto& iter : m_systemUnitClasses)
+    {
+        releaseNode(&iter.second);
+    }
+}
+
+// The image is written in the order of names, so that the same model is always compiled into the same image.
+template <typename Value>
+static std::vector<std::string> sortedKeys(const std::unordered_map<std::string, Value>& map)
+{
+    std::vector<std::string> keys;
+    keys.reserve(map.size());
+    for (const auto& iter : map)
+    {
+        keys.push_back(iter.first);
+    }
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+static void saveAttribute(const AttributeSchema& attr, AMLImageWriter& image)
+{
+    image.writeString(attr.name);
+    image.writeString(attr.dataType);
+    image.writeSize(static_cast<size_t>(attr.kind));
+    image.writeBool(attr.hasValue);
+    image.writeString(attr.value);
+    image.writeBool(attr.hasRefSemantic);
+    image.writeString(attr.correspondingAttributePath);
+
+    image.writeSize(attr.attributes.size());
+    for (const AttributeSchema& child : attr.attributes)
+    {
+        saveAttribute(child, image);
+    }
+}
+
+static void loadAttribute(AMLImageReader& image, AttributeSchema* attr, AMLSymbolTable* symbols)
+{
+    attr->name                          = image.readString();
+    attr->symbol                        = symbols->intern(attr->name);
+    attr->dataType                      = image.readString();
+    attr->scalarType                    = toScalarType(attr->dataType);    // derived, so not in the image
+    attr->kind                          = static_cast<AttributeKind>(image.readSize(static_cast<size_t>(AttributeKind::Invalid) + 1));
+    attr->hasValue                      = image.readBool();
+    attr->value                         = image.readString();
+    attr->hasRefSemantic                = image.readBool();
+    attr->correspondingAttributePath    = image.readString();
+
+    attr->attributes.resize(image.readCount());
+    for (AttributeSchema& child : attr->attributes)
+    {
+        loadAttribute(image, &child, symbols);
+    }
+}
+
+static void saveInternalElement(const InternalElementSchema& ie, AMLImageWriter& image)
+{
+    image.writeString(ie.name);
+    image.writeString(ie.refBaseSystemUnitPath);
+    image.writeBool(ie.hasSupportedRoleClass);
+    image.writeString(ie.refRoleClassPath);
+
+    image.writeSize(ie.attributes.size());
+    for (const AttributeSchema& attr : ie.attributes)
+    {
+        saveAttribute(attr, image);
+    }
+
+    image.writeSize(ie.internalElements.size());
+    for (const InternalElementSchema& child : ie.internalElements)
+    {
+        saveInternalElement(child, image);
+    }
+}
+
+static void loadInternalElement(AMLImageReader& image, InternalElementSchema* ie, AMLSymbolTable* symbols)
+{
+    ie->name                    = image.readString();
+    ie->symbol                  = symbols->intern(ie->name);
+    ie->refBaseSystemUnitPath   = image.readString();
+    ie->hasSupportedRoleClass   = image.readBool();
+    ie->refRoleClassPath        = image.readString();
+
+    ie->attributes.resize(image.readCount());
+    for (AttributeSchema& attr : ie->attributes)
+    {
+        loadAttribute(image, &attr, symbols);
+    }
+
+    ie->internalElements.resize(image.readCount());
+    for (InternalElementSchema& child : ie->internalElements)
+    {
+        loadInternalElement(image, &child, symbols);
+    }
+}
+
+static void collectAttributes(const std::vector<AttributeSchema>& attributes, std::vector<const AttributeSchema*>* all)
+{
+    for (const AttributeSchema& attr : attributes)
+    {
+        all->push_back(&attr);
+        collectAttributes(attr.attributes, all);
+    }
+}
+
+static void collectAttributes(const InternalElementSchema& ie, std::vector<const AttributeSchema*>* all)
+{
+    collectAttributes(ie.attributes, all);
+    for (const InternalElementSchema& child : ie.internalElements)
+    {
+        collectAttributes(child, all);
+    }
+}
+
+AMLSchema::AMLSchema(AMLImageReader& image)
+{
+    m_name = image.readString();
+    m_roleClassLibName = image.readString();
+
+    m_systemUnitClassNames.resize(image.readCount());
+    for (std::string& name : m_systemUnitClassNames)
+    {
+        name = image.readString();
+    }
+
+    size_t roleClassCount = image.readCount();
+    for (size_t i = 0; i < roleClassCount; ++i)
+    {
+        std::string rcName = image.readString();
+        RoleClassSchema& rc = m_roleClasses[rcName];
+        rc.name = rcName;
+        rc.attributes.resize(image.readCount());
+        for (auto& attr : rc.attributes)
+        {
+            attr.first = image.readString();
+            attr.second = image.readString();
+        }
+    }
+
+    size_t systemUnitClassCount = image.readCount();
+    for (size_t i = 0; i < systemUnitClassCount; ++i)
+    {
+        InternalElementSchema suc;
+        loadInternalElement(image, &suc, &m_symbols);
+        if (false == m_systemUnitClasses.insert(std::make_pair(suc.name, std::move(suc))).second)
+        {
+            AML_LOG(ERROR, TAG, "Invalid compiled model : duplicated SystemUnitClass");
+            throw AMLException(INVALID_BYTE_STR);
+        }
+    }
+}
+
+void AMLSchema::save(AMLImageWriter& image) const
+{
+    image.writeString(m_name);
+    image.writeString(m_roleClassLibName);
+
+    image.writeSize(m_systemUnitClassNames.size());
+    for (const std::string& name : m_systemUnitClassNames)
+    {
+        image.writeString(name);
+    }
+
+    image.writeSize(m_roleClasses.size());
+    for (const std::string& rcName : sortedKeys(m_roleClasses))
+    {
+        const RoleClassSchema& rc = m_roleClasses.at(rcName);
+        image.writeString(rcName);
+        image.writeSize(rc.attributes.size());
+        for (const auto& attr : rc.attributes)
+        {
+            image.writeString(attr.first);
+            image.writeString(attr.second);
+        }
+    }
+
+    image.writeSize(m_systemUnitClasses.size());
+    for (const std::string& sucName : sortedKeys(m_systemUnitClasses))
+    {
+        saveInternalElement(m_systemUnitClasses.at(sucName), image);
+    }
+}
+
+std::vector<const AttributeSchema*> AMLSchema::getAttributes() const
+{
+    std::vector<const AttributeSchema*> attributes;
+    for (const std::string& sucName : sortedKeys(m_systemUnitClasses))
+    {
+        collectAttributes(m_systemUnitClasses.at(sucName), &attributes);
+    }
+    return attributes;
+}
+
+const InternalElementSchema* AMLSchema::findSystemUnitClass(const std::string& name) const
+{
+    auto iter = m_systemUnitClasses.find(name);
+    if (iter == m_systemUnitClasses.end())
+    {
+        return nullptr;
+    }
+    return &iter->second;
+}
+
+const std::string& AMLSchema::getName() const
+{
+    return m_name;
+}
+
+const std::vector<std::string>& AMLSchema::getSystemUnitClassNames() const
+{
+    return m_systemUnitClassNames;
+}
+
+const RoleClassSchema* AMLSchema::findRoleClass(const std::string& name) const
+{
+    auto iter = m_roleClasses.find(name);
+    if (iter == m_roleClasses.end())
+    {
+        return nullptr;
+    }
+    return &iter->second;
+}
+
+const std::string& AMLSchema::getRoleClassLibName() const
+{
+    return m_roleClassLibName;
+}
+
+AMLSymbol AMLSchema::findSymbol(const std::string& name, AMLArena* arena) const
+{
+    return m_symbols.find(name, arena);
+}
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <string>
+#include <mutex>
+#include <unordered_set>
+
+#include "AMLSymbol.h"
+#include "AMLArena.h"
+
+using namespace std;
+using namespace AML;
+
+namespace
+{
+    struct SymbolTable
+    {
+        std::mutex                      mutex;
+        std::unordered_set<std::string> names;      // nodes are not moved on rehash, so names keep their address
+    };
+
+    // The table is never destroyed, as symbols may be used by destructors of static objects.
+    SymbolTable& getSymbolTable()
+    {
+        static SymbolTable* table = new SymbolTable();
+        return *table;
+    }
+
+    const std::string* intern(const std::string& name)
+    {
+        SymbolTable& table = getSymbolTable();
+
+        std::lock_guard<std::mutex> lock(table.mutex);
+        return &*table.names.insert(name).first;
+    }
+}
+
+AMLSymbol::AMLSymbol(void)
+ : m_arena(nullptr)
+{
+    static const std::string* emptyName = intern(std::string());
+    m_name = emptyName;
+}
+
+AMLSymbol::AMLSymbol(const std::string& name)
+ : m_name(intern(name)), m_arena(nullptr)
+{
+}
+
+AMLSymbol AMLSymbol::lookup(const std::string& name, AMLArena* arena)
+{
+    SymbolTable& table = getSymbolTable();
+    {
+        std::lock_guard<std::mutex> lock(table.mutex);
+        auto iter = table.names.find(name);
+        if (iter != table.names.end())
+        {
+            AMLSymbol symbol;
+            symbol.m_name = &*iter;
+            return symbol;
+        }
+    }
+    return uninterned(name, arena);
+}
+
+AMLSymbol AMLSymbol::uninterned(const std::string& name)
+{
+    AMLSymbol symbol;
+    symbol.m_copy = std::make_shared<const std::string>(name);
+    symbol.m_name = symbol.m_copy.get();
+    return symbol;
+}
+
+AMLSymbol AMLSymbol::uninterned(const std::string& name, AMLArena* arena)
+{
+    if (nullptr == arena)
+    {
+        return uninterned(name);
+    }
+
+    AMLSymbol symbol;
+    symbol.m_name = arena->create<std::string>(name);
+    symbol.m_arena = arena;
+    return symbol;
+}
+
+size_t AMLSymbol::internedCount()
+{
+    SymbolTable& table = getSymbolTable();
+
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return table.names.size();
+}
@@ -0,0 +1,314 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "AMLThreadPool.h"
+#include "AMLLogger.h"
+
+#define TAG "AMLThreadPool"
+
+using namespace std;
+using namespace AML;
+
+class AMLThreadPool::Impl
+{
+public:
+    typedef std::function<void()> Task;
+
+    explicit Impl(size_t concurrency) : m_pending(0), m_nextQueue(0), m_stop(false)
+    {
+        if (0 == concurrency)
+        {
+            concurrency = std::thread::hardware_concurrency();
+        }
+
+        // the calling thread of parallelFor() is one of the workers
+        for (size_t i = 1; i < concurrency; ++i)
+        {
+            m_queues.push_back(std::unique_ptr<Queue>(new Queue()));
+        }
+
+        try
+        {
+            for (size_t i = 0; i < m_queues.size(); ++i)
+            {
+                m_threads.push_back(std::thread(&Impl::work, this, i));
+            }
+        }
+        catch (const std::exception& e)
+        {
+            // the queues of the threads which are not started are emptied by stealing
+            AML_LOG_V(ERROR, TAG, "Failed to start thread : %s", e.what());
+        }
+    }
+
+    ~Impl()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cond.notify_all();
+
+        for (std::thread& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    size_t getConcurrency() const
+    {
+        return m_threads.size() + 1;
+    }
+
+    void submit(Task&& task)
+    {
+        // a worker pushes to its own queue, and the others spread tasks over the queues
+        size_t index = (this == t_pool) ? t_index : (m_nextQueue++ % m_queues.size());
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending++;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+            m_queues[index]->tasks.push_back(std::move(task));
+        }
+        m_cond.notify_one();
+    }
+
+    // Runs one task from the queues, if any. Returns false if all the queues are empty.
+    bool runPendingTask()
+    {
+        Task task;
+        if (false == take(task))
+        {
+            return false;
+        }
+
+        task();
+        return true;
+    }
+
+private:
+    struct Queue
+    {
+        std::mutex          mutex;
+        std::deque<Task>    tasks;
+    };
+
+    static thread_local Impl*       t_pool;
+    static thread_local size_t      t_index;
+
+    std::vector<std::unique_ptr<Queue>> m_queues;
+    std::vector<std::thread>        m_threads;
+    std::mutex                      m_mutex;
+    std::condition_variable         m_cond;
+    size_t                          m_pending;      // number of tasks in the queues
+    std::atomic<size_t>             m_nextQueue;
+    bool                            m_stop;
+
+    // The owner takes the newest task from the back of its queue, and the others steal the oldest one from the front.
+    bool take(Task& task)
+    {
+        size_t self = (this == t_pool) ? t_index : 0;
+        for (size_t i = 0; i < m_queues.size(); ++i)
+        {
+            size_t index = (self + i) % m_queues.size();
+            Queue& queue = *m_queues[index];
+
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty())
+            {
+                continue;
+            }
+
+            if (this == t_pool && index == self)
+            {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            }
+            else
+            {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+
+            std::lock_guard<std::mutex> pendingLock(m_mutex);
+            m_pending--;
+            return true;
+        }
+        return false;
+    }
+
+    void work(size_t index)
+    {
+        t_pool = this;
+        t_index = index;
+
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cond.wait(lock, [this]() { return m_stop || 0 < m_pending; });
+                if (m_stop)
+                {
+                    return;
+                }
+            }
+
+            runPendingTask();
+        }
+    }
+};
+
+thread_local AMLThreadPool::Impl* AMLThreadPool::Impl::t_pool = nullptr;
+thread_local size_t AMLThreadPool::Impl::t_index = 0;
+
+namespace
+{
+
+// State of a parallelFor() call, which is shared by the threads working on it.
+struct Batch
+{
+    Batch(size_t count, const std::function<void(size_t)>& fn)
+     : count(count), fn(fn), next(0), failedIndex(count), running(0)
+    {
+    }
+
+    void work()
+    {
+        for (size_t index = next++; index < count && index < failedIndex; index = next++)
+        {
+            try
+            {
+                fn(index);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (index < failedIndex)
+                {
+                    failedIndex = index;
+                    error = std::current_exception();
+                }
+            }
+        }
+    }
+
+    const size_t                        count;
+    const std::function<void(size_t)>&  fn;
+    std::atomic<size_t>                 next;
+    std::atomic<size_t>                 failedIndex;    // items after a failure are not started
+    std::exception_ptr                  error;
+    size_t                              running;        // number of submitted tasks which have not finished
+    std::mutex                          mutex;
+    std::condition_variable             done;
+};
+
+} // namespace
+
+AMLThreadPool::AMLThreadPool(size_t concurrency) : m_impl(new Impl(concurrency))
+{
+}
+
+AMLThreadPool::~AMLThreadPool(void)
+{
+    delete m_impl;
+}
+
+size_t AMLThreadPool::getConcurrency(void) const
+{
+    return m_impl->getConcurrency();
+}
+
+void AMLThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& fn, size_t concurrency)
+{
+    if (0 == concurrency || concurrency > m_impl->getConcurrency())
+    {
+        concurrency = m_impl->getConcurrency();
+    }
+    if (concurrency > count)
+    {
+        concurrency = count;
+    }
+
+    if (concurrency <= 1)
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            fn(index);
+        }
+        return;
+    }
+
+    Batch batch(count, fn);
+    batch.running = concurrency - 1;
+    for (size_t i = 1; i < concurrency; ++i)
+    {
+        m_impl->submit([&batch]()
+        {
+            batch.work();
+
+            std::lock_guard<std::mutex> lock(batch.mutex);
+            if (0 == --batch.running)
+            {
+                batch.done.notify_all();
+            }
+        });
+    }
+
+    batch.work();
+
+    // help the pool until the submitted tasks finish, which may still be waiting in the queues
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> lock(batch.mutex);
+            if (0 == batch.running)
+            {
+                break;
+            }
+        }
+
+        if (false == m_impl->runPendingTask())
+        {
+            // all the tasks of this batch are taken, so they are running on the other threads
+            std::unique_lock<std::mutex> lock(batch.mutex);
+            batch.done.wait(lock, [&batch]() { return 0 == batch.running; });
+            break;
+        }
+    }
+
+    if (batch.error)
+    {
+        std::rethrow_exception(batch.error);
+    }
+}
+
+AMLThreadPool& AMLThreadPool::getDefault(void)
+{
+    static AMLThreadPool* pool = new AMLThreadPool(0);
+    return *pool;
+}
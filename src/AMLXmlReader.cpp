@@ -0,0 +1,1086 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "AMLXmlReader.h"
+#include "AMLObjectViewSource.h"
+#include "AMLSchema.h"
+#include "AMLScalar.h"
+#include "AMLInterface.h"
+#include "AMLException.h"
+#include "AMLLogger.h"
+
+#define TAG "AMLXmlReader"
+
+using namespace std;
+using namespace AML;
+
+static const char CAEX_FILE[]                       = "CAEXFile";
+static const char INSTANCE_HIERARCHY[]              = "InstanceHierarchy";
+static const char INTERNAL_ELEMENT[]                = "InternalElement";
+static const char ATTRIBUTE[]                       = "Attribute";
+static const char REF_SEMANTIC[]                    = "RefSemantic";
+
+static const char NAME[]                            = "Name";
+static const char VALUE[]                           = "Value";
+static const char CORRESPONDING_ATTRIBUTE_PATH[]    = "CorrespondingAttributePath";
+static const char ORDERED_LIST_TYPE[]               = "OrderedListType";
+
+static const char EVENT[]                           = "Event";
+
+static const char KEY_DEVICE[]                      = "device";
+static const char KEY_ID[]                          = "id";
+static const char KEY_TIMESTAMP[]                   = "timestamp";
+
+static const size_t NO_ELEMENT = static_cast<size_t>(-1);
+
+// character classes of pugixml
+static inline bool isSpace(char c)
+{
+    return ' ' == c || '\t' == c || '\n' == c || '\r' == c;
+}
+
+// Returns the attribute of the model which has the name, or nullptr if it is not present.
+static const AttributeSchema* findAttributeSchema(const std::vector<AttributeSchema>* attributes, const std::string& name)
+{
+    if (nullptr != attributes)
+    {
+        for (const AttributeSchema& attr : *attributes)
+        {
+            if (attr.name == name)
+            {
+                return &attr;
+            }
+        }
+    }
+    return nullptr;
+}
+
+// Returns the index of array element from its name "1".."count", or 0 if the name is not one of them.
+static size_t toArrayIndex(const std::string& name, size_t count)
+{
+    if (name.empty() || '0' == name[0])
+    {
+        return 0;
+    }
+
+    size_t index = 0;
+    for (char c : name)
+    {
+        if (c < '0' || c > '9')
+        {
+            return 0;
+        }
+        index = index * 10 + (c - '0');
+        if (index > count)
+        {
+            return 0;
+        }
+    }
+    return index;
+}
+
+static void setNumericArray(const AttributeSchema& attr, const AMLSymbol& key, const std::string& text, AMLData* amlData)
+{
+    bool isParsed = false;
+    if (ScalarType::Integer == attr.scalarType)
+    {
+        std::vector<int64_t> values;
+        isParsed = parseIntList(text, values);
+        if (isParsed)
+        {
+            amlData->setIntArrayValue(key, std::move(values));
+        }
+    }
+    else
+    {
+        std::vector<double> values;
+        isParsed = parseDoubleList(text, values);
+        if (isParsed)
+        {
+            amlData->setDoubleArrayValue(key, std::move(values));
+        }
+    }
+
+    if (false == isParsed)
+    {
+        AML_LOG_V(ERROR, TAG, "Invalid AML : <%s> has an element which does not match AttributeDataType", attr.name.c_str());
+        throw AMLException(NOT_MATCH_TO_AML_MODEL);
+    }
+}
+
+static inline bool isStartSymbol(char c)
+{
+    return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || '_' == c || ':' == c || 0 != (c & 0x80);
+}
+
+static inline bool isSymbol(char c)
+{
+    return isStartSymbol(c) || ('0' <= c && c <= '9') || '-' == c || '.' == c;
+}
+
+static inline bool isName(const char* name, size_t size, const char* expected)
+{
+    return size == strlen(expected) && 0 == memcmp(name, expected, size);
+}
+
+// Returns the first position of 'pattern' in [begin, end), or nullptr.
+static const char* find(const char* begin, const char* end, const char* pattern)
+{
+    size_t size = strlen(pattern);
+    while (begin + size <= end)
+    {
+        const char* p = static_cast<const char*>(memchr(begin, pattern[0], end - begin - size + 1));
+        if (nullptr == p)
+        {
+            return nullptr;
+        }
+        if (0 == memcmp(p, pattern, size))
+        {
+            return p;
+        }
+        begin = p + 1;
+    }
+    return nullptr;
+}
+
+static void appendUtf8(unsigned int code, std::string& out)
+{
+    if (code < 0x80)
+    {
+        out += static_cast<char>(code);
+    }
+    else if (code < 0x800)
+    {
+        out += static_cast<char>(0xC0 | (code >> 6));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    }
+    else if (code < 0x10000)
+    {
+        out += static_cast<char>(0xE0 | (code >> 12));
+        out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    }
+    else
+    {
+        out += static_cast<char>(0xF0 | ((code >> 18) & 0x07));
+        out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    }
+}
+
+// Decodes the reference at p ('&'), as pugixml does. Returns the position after it, or p if it is not a valid reference.
+static const char* decodeReference(const char* p, const char* end, std::string& out)
+{
+    static const struct { const char* name; char value; } entities[] =
+    {
+        {"&amp;", '&'}, {"&lt;", '<'}, {"&gt;", '>'}, {"&quot;", '"'}, {"&apos;", '\''}
+    };
+
+    if (p + 2 < end && '#' == p[1])
+    {
+        bool hex = ('x' == p[2]);
+        const char* q = p + (hex ? 3 : 2);
+        unsigned int code = 0;
+        if (q < end && ';' == *q)
+        {
+            return p;
+        }
+        for (; q < end && ';' != *q; ++q)
+        {
+            unsigned int c = static_cast<unsigned char>(*q);
+            if (c - '0' <= 9)
+            {
+                code = code * (hex ? 16 : 10) + (c - '0');
+            }
+            else if (hex && (c | ' ') - 'a' <= 5)
+            {
+                code = code * 16 + ((c | ' ') - 'a' + 10);
+            }
+            else
+            {
+                return p;
+            }
+        }
+        if (q == end)
+        {
+            return p;
+        }
+        appendUtf8(code, out);
+        return q + 1;
+    }
+
+    for (const auto& entity : entities)
+    {
+        size_t size = strlen(entity.name);
+        if (static_cast<size_t>(end - p) >= size && 0 == memcmp(p, entity.name, size))
+        {
+            out += entity.value;
+            return p + size;
+        }
+    }
+    return p;
+}
+
+// Decodes text (parse_escapes | parse_eol) or attribute value (parse_escapes | parse_wconv_attribute) of pugixml.
+static std::string decode(const char* begin, const char* end, bool isAttribute, bool isCdata)
+{
+    std::string out;
+    out.reserve(end - begin);
+
+    for (const char* p = begin; p < end; )
+    {
+        char c = *p;
+        if ('&' == c && false == isCdata)
+        {
+            const char* next = decodeReference(p, end, out);
+            if (next != p)
+            {
+                if ('\0' == out.back())
+                {
+                    // pugixml returns the value as C string, which ends at the character of "&#0;"
+                    out.pop_back();
+                    break;
+                }
+                p = next;
+                continue;
+            }
+            out += c;
+            ++p;
+        }
+        else if ('\r' == c)
+        {
+            out += isAttribute ? ' ' : '\n';
+            p += (p + 1 < end && '\n' == p[1]) ? 2 : 1;
+        }
+        else if (isAttribute && ('\n' == c || '\t' == c))
+        {
+            out += ' ';
+            ++p;
+        }
+        else
+        {
+            // copy up to the next character which needs to be converted
+            const char* q = p + 1;
+            while (q < end && '&' != *q && '\r' != *q && (false == isAttribute || ('\n' != *q && '\t' != *q)))
+            {
+                ++q;
+            }
+            out.append(p, q);
+            p = q;
+        }
+    }
+    return out;
+}
+
+// Returns the value of the first attribute in the start tag which has the name, or empty string.
+// The attributes have been checked by XmlReader::scanStartTag().
+static std::string findAttribute(const char* p, const char* end, const char* name)
+{
+    while (p < end)
+    {
+        while (p < end && isSpace(*p))
+        {
+            ++p;
+        }
+        if (p >= end || false == isStartSymbol(*p))
+        {
+            break;
+        }
+
+        const char* attrName = p;
+        while (isSymbol(*p))
+        {
+            ++p;
+        }
+        size_t attrNameSize = p - attrName;
+
+        p = static_cast<const char*>(memchr(p, '=', end - p)) + 1;
+        while (isSpace(*p))
+        {
+            ++p;
+        }
+        const char* value = p + 1;
+        const char* valueEnd = static_cast<const char*>(memchr(value, *p, end - value));
+        p = valueEnd + 1;
+
+        if (isName(attrName, attrNameSize, name))
+        {
+            return decode(value, valueEnd, true, false);
+        }
+    }
+    return std::string();
+}
+
+namespace
+{
+
+// Element in <InternalElement Name="Event">, which points into the XML string
+struct Element
+{
+    const char*     name;
+    size_t          nameSize;
+    const char*     attrs;          // attributes in the start tag
+    const char*     attrsEnd;
+    const char*     text;           // first text or CDATA in the element, which is the value of pugixml child_value()
+    const char*     textEnd;
+    bool            isCdata;
+    size_t          firstChild;
+    size_t          lastChild;
+    size_t          nextSibling;
+};
+
+class XmlReader
+{
+public:
+    XmlReader(const AMLSchema& schema, const char* begin, const char* end, const AMLProjection* projection)
+     : m_schema(schema), m_begin(begin), m_end(end), m_projection(projection),
+       m_hasRoot(false), m_hasCaexFile(false), m_hasInstanceHierarchy(false)
+    {
+    }
+
+    // Scans the whole document to check that it is well-formed, and keeps the elements of the first event.
+    bool scan()
+    {
+        const char* p = m_begin;
+        if (m_end - p >= 3 && 0 == memcmp(p, "\xEF\xBB\xBF", 3))
+        {
+            p += 3;
+        }
+
+        while (p < m_end)
+        {
+            if ('<' != *p)
+            {
+                const char* next = static_cast<const char*>(memchr(p, '<', m_end - p));
+                if (nullptr == next)
+                {
+                    next = m_end;
+                }
+                addText(p, next, false);
+                p = next;
+                continue;
+            }
+
+            if (p + 1 >= m_end)
+            {
+                return false;
+            }
+
+            char c = p[1];
+            if ('/' == c)               p = scanEndTag(p);
+            else if ('!' == c)          p = scanExclamation(p);
+            else if ('?' == c)          p = scanQuestion(p);
+            else if (isStartSymbol(c))  p = scanStartTag(p);
+            else                        p = nullptr;
+
+            if (nullptr == p)
+            {
+                return false;
+            }
+        }
+
+        return m_stack.empty() && m_hasRoot;
+    }
+
+    AMLObject* construct(AMLArena* arena) const
+    {
+        size_t event = findEvent();
+
+        std::string deviceId, timeStamp, id;
+        readEvent(event, deviceId, timeStamp, id);
+
+        AMLObject* amlObj = new AMLObject(deviceId, timeStamp, id, arena);
+
+        try
+        {
+            for (size_t ie = child(event, INTERNAL_ELEMENT); NO_ELEMENT != ie; ie = nextSibling(ie, INTERNAL_ELEMENT))
+            {
+                AMLSymbol name = dataName(ie, arena);
+
+                // the data which is not selected has not been kept by scan()
+                const AMLProjection* keys = nullptr;
+                if (nullptr != m_projection && false == m_projection->select(name.str(), &keys))
+                {
+                    continue;
+                }
+
+                AMLData amlData(arena);
+                constructAmlData(ie, keys, attributesOf(name), arena, &amlData);
+
+                amlObj->addData(name, std::move(amlData));
+            }
+        }
+        catch (...)
+        {
+            delete amlObj;
+            throw;
+        }
+
+        return amlObj;
+    }
+
+    // Returns the event after checking that the document has the elements up to it.
+    size_t findEvent() const
+    {
+        if (false == m_hasInstanceHierarchy)
+        {
+            AML_LOG(ERROR, TAG, "<CAEXFile> or <InstanceHierarchy> does not exist");
+            throw AMLException(INVALID_AML_SCHEMA);
+        }
+        if (m_elements.empty())
+        {
+            AML_LOG(ERROR, TAG, "<Event> does not exist");
+            throw AMLException(INVALID_AML_SCHEMA);
+        }
+        return 0;
+    }
+
+    void readEvent(size_t event, std::string& deviceId, std::string& timeStamp, std::string& id) const
+    {
+        for (size_t attr = child(event, ATTRIBUTE); NO_ELEMENT != attr; attr = nextSibling(attr, ATTRIBUTE))
+        {
+            std::string name = attribute(attr, NAME);
+            if      (name == KEY_DEVICE)    deviceId = childValue(attr, VALUE);
+            else if (name == KEY_TIMESTAMP) timeStamp = childValue(attr, VALUE);
+            else if (name == KEY_ID)        id = childValue(attr, VALUE);
+        }
+    }
+
+    // Returns the <InternalElement>s of the event, which are the data of AMLObject.
+    std::vector<size_t> findData(size_t event) const
+    {
+        std::vector<size_t> ies;
+        for (size_t ie = child(event, INTERNAL_ELEMENT); NO_ELEMENT != ie; ie = nextSibling(ie, INTERNAL_ELEMENT))
+        {
+            ies.push_back(ie);
+        }
+        return ies;
+    }
+
+    AMLSymbol dataName(size_t ie, AMLArena* arena) const
+    {
+        return m_schema.findSymbol(attribute(ie, NAME), arena);
+    }
+
+    // Returns the attributes of SystemUnitClass of the data, or nullptr if it is not present in the model.
+    const std::vector<AttributeSchema>* attributesOf(const AMLSymbol& name) const
+    {
+        const InternalElementSchema* suc = m_schema.findSystemUnitClass(name.str());
+        return (nullptr == suc) ? nullptr : &suc->attributes;
+    }
+
+private:
+    friend class XmlViewSource;
+
+    enum Role
+    {
+        OTHER,
+        CAEX_FILE_ROLE,
+        INSTANCE_HIERARCHY_ROLE,
+        EVENT_ROLE              // the event or an element in it
+    };
+
+    struct OpenElement
+    {
+        const char*     name;
+        size_t          nameSize;
+        Role            role;
+        size_t          element;
+    };
+
+    const AMLSchema&            m_schema;
+    const char*                 m_begin;
+    const char*                 m_end;
+    const AMLProjection*        m_projection;   // data and keys to be constructed, or nullptr for all
+    bool                        m_hasRoot;
+    bool                        m_hasCaexFile;
+    bool                        m_hasInstanceHierarchy;
+    std::vector<OpenElement>    m_stack;
+    std::vector<Element>        m_elements;
+
+    void addText(const char* begin, const char* end, bool isCdata)
+    {
+        if (m_stack.empty() || EVENT_ROLE != m_stack.back().role)
+        {
+            return;
+        }
+
+        Element& element = m_elements[m_stack.back().element];
+        if (nullptr != element.text)
+        {
+            return;
+        }
+
+        // pugixml does not keep the text which has only whitespaces
+        if (false == isCdata)
+        {
+            const char* p = begin;
+            while (p < end && isSpace(*p))
+            {
+                ++p;
+            }
+            if (p == end)
+            {
+                return;
+            }
+        }
+
+        element.text = begin;
+        element.textEnd = end;
+        element.isCdata = isCdata;
+    }
+
+    const char* scanStartTag(const char* p)
+    {
+        const char* name = p + 1;
+        const char* q = name;
+        while (q < m_end && isSymbol(*q))
+        {
+            ++q;
+        }
+        size_t nameSize = q - name;
+        const char* attrs = q;
+
+        bool isEmpty = false;
+        if (q >= m_end)
+        {
+            return nullptr;
+        }
+        else if ('>' == *q)
+        {
+            ++q;
+        }
+        else if ('/' == *q)
+        {
+            if (q + 1 >= m_end || '>' != q[1])
+            {
+                return nullptr;
+            }
+            q += 2;
+            isEmpty = true;
+        }
+        else if (isSpace(*q))
+        {
+            while (true)
+            {
+                while (q < m_end && isSpace(*q))
+                {
+                    ++q;
+                }
+                if (q >= m_end)
+                {
+                    return nullptr;
+                }
+
+                if (isStartSymbol(*q))
+                {
+                    while (q < m_end && isSymbol(*q))
+                    {
+                        ++q;
+                    }
+                    while (q < m_end && isSpace(*q))
+                    {
+                        ++q;
+                    }
+                    if (q >= m_end || '=' != *q)
+                    {
+                        return nullptr;
+                    }
+                    ++q;
+                    while (q < m_end && isSpace(*q))
+                    {
+                        ++q;
+                    }
+                    if (q >= m_end || ('"' != *q && '\'' != *q))
+                    {
+                        return nullptr;
+                    }
+                    const char* close = static_cast<const char*>(memchr(q + 1, *q, m_end - q - 1));
+                    if (nullptr == close)
+                    {
+                        return nullptr;
+                    }
+                    q = close + 1;
+                    if (q < m_end && isStartSymbol(*q))
+                    {
+                        return nullptr;
+                    }
+                }
+                else if ('/' == *q)
+                {
+                    if (q + 1 >= m_end || '>' != q[1])
+                    {
+                        return nullptr;
+                    }
+                    q += 2;
+                    isEmpty = true;
+                    break;
+                }
+                else if ('>' == *q)
+                {
+                    ++q;
+                    break;
+                }
+                else
+                {
+                    return nullptr;
+                }
+            }
+        }
+        else
+        {
+            return nullptr;
+        }
+
+        OpenElement open = {name, nameSize, OTHER, NO_ELEMENT};
+        Role parent = m_stack.empty() ? OTHER : m_stack.back().role;
+
+        if (m_stack.empty())
+        {
+            m_hasRoot = true;
+            if (false == m_hasCaexFile && isName(name, nameSize, CAEX_FILE))
+            {
+                m_hasCaexFile = true;
+                open.role = CAEX_FILE_ROLE;
+            }
+        }
+        else if (CAEX_FILE_ROLE == parent)
+        {
+            if (false == m_hasInstanceHierarchy && isName(name, nameSize, INSTANCE_HIERARCHY))
+            {
+                m_hasInstanceHierarchy = true;
+                open.role = INSTANCE_HIERARCHY_ROLE;
+            }
+        }
+        else if (INSTANCE_HIERARCHY_ROLE == parent)
+        {
+            if (m_elements.empty() && isName(name, nameSize, INTERNAL_ELEMENT))
+            {
+                open.element = addElement(name, nameSize, attrs, q, NO_ELEMENT);
+                if (attribute(open.element, NAME) == EVENT)
+                {
+                    open.role = EVENT_ROLE;
+                }
+                else
+                {
+                    m_elements.clear();
+                    open.element = NO_ELEMENT;
+                }
+            }
+        }
+        else if (EVENT_ROLE == parent)
+        {
+            // the data which is not selected is skipped with its subtree, as the other elements out of the event
+            const AMLProjection* keys = nullptr;
+            if (nullptr == m_projection || 0 != m_stack.back().element || false == isName(name, nameSize, INTERNAL_ELEMENT) ||
+                m_projection->select(findAttribute(attrs, q, NAME), &keys))
+            {
+                open.element = addElement(name, nameSize, attrs, q, m_stack.back().element);
+                open.role = EVENT_ROLE;
+            }
+        }
+
+        if (false == isEmpty)
+        {
+            m_stack.push_back(open);
+        }
+        return q;
+    }
+
+    const char* scanEndTag(const char* p)
+    {
+        const char* name = p + 2;
+        const char* q = name;
+        while (q < m_end && isSymbol(*q))
+        {
+            ++q;
+        }
+
+        if (m_stack.empty() ||
+            static_cast<size_t>(q - name) != m_stack.back().nameSize || 0 != memcmp(name, m_stack.back().name, q - name))
+        {
+            return nullptr;
+        }
+
+        while (q < m_end && isSpace(*q))
+        {
+            ++q;
+        }
+        if (q >= m_end || '>' != *q)
+        {
+            return nullptr;
+        }
+
+        m_stack.pop_back();
+        return q + 1;
+    }
+
+    const char* scanExclamation(const char* p)
+    {
+        static const char COMMENT[] = "<!--";
+        static const char CDATA[] = "<![CDATA[";
+        static const char DOCTYPE[] = "<!DOCTYPE";
+
+        size_t size = m_end - p;
+        if (size >= 3 && '-' == p[2])
+        {
+            if (size < strlen(COMMENT) || '-' != p[3])
+            {
+                return nullptr;
+            }
+            const char* close = find(p + strlen(COMMENT), m_end, "-->");
+            return (nullptr == close) ? nullptr : close + 3;
+        }
+        else if (size >= 3 && '[' == p[2])
+        {
+            if (size < strlen(CDATA) || 0 != memcmp(p, CDATA, strlen(CDATA)))
+            {
+                return nullptr;
+            }
+            const char* close = find(p + strlen(CDATA), m_end, "]]>");
+            if (nullptr == close)
+            {
+                return nullptr;
+            }
+            addText(p + strlen(CDATA), close, true);
+            return close + 3;
+        }
+        else if (size > strlen(DOCTYPE) && 0 == memcmp(p, DOCTYPE, strlen(DOCTYPE)) && isSpace(p[strlen(DOCTYPE)]))
+        {
+            // DOCTYPE is only allowed out of the elements
+            return m_stack.empty() ? scanDoctype(p) : nullptr;
+        }
+        return nullptr;
+    }
+
+    // Skips processing instruction, including XML declaration.
+    const char* scanQuestion(const char* p)
+    {
+        if (p + 2 >= m_end || false == isStartSymbol(p[2]))
+        {
+            return nullptr;
+        }
+        const char* close = find(p + 2, m_end, "?>");
+        return (nullptr == close) ? nullptr : close + 2;
+    }
+
+    // Skips DOCTYPE with its internal subset, as parse_doctype_group() of pugixml.
+    const char* scanDoctype(const char* p)
+    {
+        size_t depth = 0;
+        for (const char* q = p + 2; q < m_end; )
+        {
+            size_t size = m_end - q;
+            if ('<' == q[0] && size >= 2 && '!' == q[1] && (size < 3 || '-' != q[2]))
+            {
+                if (size >= 3 && '[' == q[2])
+                {
+                    q = skipDoctypeIgnore(q);
+                    if (nullptr == q)
+                    {
+                        return nullptr;
+                    }
+                }
+                else
+                {
+                    depth++;
+                    q += 2;
+                }
+            }
+            else if ('"' == q[0] || '\'' == q[0])
+            {
+                const char* close = static_cast<const char*>(memchr(q + 1, q[0], size - 1));
+                if (nullptr == close)
+                {
+                    return nullptr;
+                }
+                q = close + 1;
+            }
+            else if ('<' == q[0])
+            {
+                const char* close = nullptr;
+                if (size >= 2 && '?' == q[1])
+                {
+                    close = find(q + 2, m_end, "?>");
+                    q = (nullptr == close) ? nullptr : close + 2;
+                }
+                else if (size >= 4 && '!' == q[1] && '-' == q[2] && '-' == q[3])
+                {
+                    close = find(q + 4, m_end, "-->");
+                    q = (nullptr == close) ? nullptr : close + 3;
+                }
+                if (nullptr == close)
+                {
+                    return nullptr;
+                }
+            }
+            else if ('>' == q[0])
+            {
+                if (0 == depth)
+                {
+                    return q + 1;
+                }
+                depth--;
+                q++;
+            }
+            else
+            {
+                q++;
+            }
+        }
+        return nullptr;
+    }
+
+    const char* skipDoctypeIgnore(const char* p)
+    {
+        size_t depth = 0;
+        for (const char* q = p + 3; q < m_end; )
+        {
+            if (m_end - q >= 3 && 0 == memcmp(q, "<![", 3))
+            {
+                depth++;
+                q += 3;
+            }
+            else if (m_end - q >= 3 && 0 == memcmp(q, "]]>", 3))
+            {
+                q += 3;
+                if (0 == depth)
+                {
+                    return q;
+                }
+                depth--;
+            }
+            else
+            {
+                q++;
+            }
+        }
+        return nullptr;
+    }
+
+    size_t addElement(const char* name, size_t nameSize, const char* attrs, const char* attrsEnd, size_t parent)
+    {
+        Element element = {name, nameSize, attrs, attrsEnd, nullptr, nullptr, false, NO_ELEMENT, NO_ELEMENT, NO_ELEMENT};
+        size_t index = m_elements.size();
+        m_elements.push_back(element);
+
+        if (NO_ELEMENT != parent)
+        {
+            if (NO_ELEMENT == m_elements[parent].lastChild)
+            {
+                m_elements[parent].firstChild = index;
+            }
+            else
+            {
+                m_elements[m_elements[parent].lastChild].nextSibling = index;
+            }
+            m_elements[parent].lastChild = index;
+        }
+        return index;
+    }
+
+    // Returns the first element from 'element' and its next siblings which has the name.
+    size_t findElement(size_t element, const char* name) const
+    {
+        while (NO_ELEMENT != element && false == isName(m_elements[element].name, m_elements[element].nameSize, name))
+        {
+            element = m_elements[element].nextSibling;
+        }
+        return element;
+    }
+
+    size_t child(size_t element, const char* name) const
+    {
+        return findElement(m_elements[element].firstChild, name);
+    }
+
+    size_t nextSibling(size_t element, const char* name) const
+    {
+        return findElement(m_elements[element].nextSibling, name);
+    }
+
+    // Returns the value of the first attribute which has the name, or empty string.
+    std::string attribute(size_t element, const char* name) const
+    {
+        return findAttribute(m_elements[element].attrs, m_elements[element].attrsEnd, name);
+    }
+
+    // Returns the first text of the first child which has the name, as pugixml child_value(name).
+    std::string childValue(size_t element, const char* name) const
+    {
+        size_t found = child(element, name);
+        if (NO_ELEMENT == found || nullptr == m_elements[found].text)
+        {
+            return std::string();
+        }
+
+        const Element& value = m_elements[found];
+        return decode(value.text, value.textEnd, false, value.isCdata);
+    }
+
+    // Constructs the keys of the element which are selected by the projection, or all of them if it is nullptr.
+    // The attributes of the model, if any, give the type of the elements of numeric arrays.
+    void constructAmlData(size_t ie, const AMLProjection* projection, const std::vector<AttributeSchema>* attributes,
+                          AMLArena* arena, AMLData* amlData) const
+    {
+        for (size_t attr = child(ie, ATTRIBUTE); NO_ELEMENT != attr; attr = nextSibling(attr, ATTRIBUTE))
+        {
+            std::string name = attribute(attr, NAME);
+
+            const AMLProjection* keys = nullptr;
+            if (nullptr != projection && false == projection->select(name, &keys))
+            {
+                continue;
+            }
+
+            AMLSymbol key = m_schema.findSymbol(name, arena);
+
+            bool hasRefSemantic = (NO_ELEMENT != child(attr, REF_SEMANTIC));
+            if (NO_ELEMENT != child(attr, VALUE))
+            {
+                // A numeric array is a single <Value> of the elements, instead of an <Attribute> for each of them.
+                const AttributeSchema* schema = hasRefSemantic ? findAttributeSchema(attributes, name) : nullptr;
+                if (nullptr != schema && AttributeKind::StringArray == schema->kind &&
+                    (ScalarType::Integer == schema->scalarType || ScalarType::Double == schema->scalarType))
+                {
+                    setNumericArray(*schema, key, childValue(attr, VALUE), amlData);
+                }
+                else
+                {
+                    amlData->setValue(key, childValue(attr, VALUE));
+                }
+            }
+            else if (hasRefSemantic &&
+                     0 != attribute(attr, CORRESPONDING_ATTRIBUTE_PATH).compare(0, strlen(ORDERED_LIST_TYPE), ORDERED_LIST_TYPE))
+            {
+                size_t sizeOfArray = 0;
+                for (size_t item = child(attr, ATTRIBUTE); NO_ELEMENT != item; item = nextSibling(item, ATTRIBUTE))
+                {
+                    sizeOfArray++;
+                }
+
+                // Each element gets the value of the first child which has its index as name, or "" if there is none.
+                vector<string> values(sizeOfArray);
+                vector<bool> found(sizeOfArray, false);
+                for (size_t item = m_elements[attr].firstChild; NO_ELEMENT != item; item = m_elements[item].nextSibling)
+                {
+                    size_t index = toArrayIndex(attribute(item, NAME), sizeOfArray);
+                    if (0 != index && false == found[index - 1])
+                    {
+                        found[index - 1] = true;
+                        values[index - 1] = childValue(item, VALUE);
+                    }
+                }
+
+                amlData->setValue(key, std::move(values));
+            }
+            else if (false == hasRefSemantic && NO_ELEMENT != child(attr, ATTRIBUTE))
+            {
+                const AttributeSchema* schema = findAttributeSchema(attributes, name);
+
+                AMLData value(arena);
+                constructAmlData(attr, keys, (nullptr == schema) ? nullptr : &schema->attributes, arena, &value);
+
+                amlData->setValue(key, std::move(value));
+            }
+            else
+            {
+                AML_LOG_V(ERROR, TAG, "Invalid AML : <%s> has value of invalid type", key.str().c_str());
+                throw AMLException(INVALID_AML_SCHEMA);
+            }
+        }
+    }
+};
+
+} // namespace
+
+// the string ends at the first '\0' as the one which is loaded by pugixml
+static size_t textSize(const char* xml, size_t size)
+{
+    const void* nul = (0 != size) ? memchr(xml, '\0', size) : nullptr;
+    return (nullptr == nul) ? size : static_cast<size_t>(static_cast<const char*>(nul) - xml);
+}
+
+static void scanXml(XmlReader& reader)
+{
+    if (false == reader.scan())
+    {
+        AML_LOG(ERROR, TAG, "Failed to load string : Invalid XML");
+        throw AMLException(INVALID_XML_STR);
+    }
+}
+
+namespace
+{
+
+// AML(XML) string of AMLObjectView, whose elements of the event are kept after scan
+class XmlViewSource : public AMLObjectView::Source
+{
+public:
+    XmlViewSource(const AMLSchema& schema, std::string&& xml)
+     : m_xml(std::move(xml)), m_reader(schema, m_xml.data(), m_xml.data() + textSize(m_xml.data(), m_xml.size()), nullptr)
+    {
+        scanXml(m_reader);
+    }
+
+    void index(std::string& deviceId, std::string& timeStamp, std::string& id, std::vector<AMLSymbol>& names) override
+    {
+        size_t event = m_reader.findEvent();
+        m_reader.readEvent(event, deviceId, timeStamp, id);
+
+        m_ies = m_reader.findData(event);
+        for (size_t ie : m_ies)
+        {
+            names.push_back(m_reader.dataName(ie, nullptr));
+        }
+    }
+
+    void decodeData(size_t position, AMLArena* arena, AMLData* amlData) const override
+    {
+        size_t ie = m_ies[position];
+        m_reader.constructAmlData(ie, nullptr, m_reader.attributesOf(m_reader.dataName(ie, nullptr)), arena, amlData);
+    }
+
+private:
+    XmlViewSource(const XmlViewSource&);
+    XmlViewSource& operator=(const XmlViewSource&);
+
+    const std::string       m_xml;      // the elements of m_reader point into this string
+    XmlReader               m_reader;
+    std::vector<size_t>     m_ies;
+};
+
+} // namespace
+
+AMLObject* AML::parseFromXml(const AMLSchema& schema, const char* xml, size_t size, const AMLProjection* projection, AMLArena* arena)
+{
+    XmlReader reader(schema, xml, xml + textSize(xml, size), projection);
+    scanXml(reader);
+
+    return reader.construct(arena);
+}
+
+AMLObjectView::Source* AML::newXmlViewSource(const AMLSchema& schema, std::string&& xml)
+{
+    return new XmlViewSource(schema, std::move(xml));
+}
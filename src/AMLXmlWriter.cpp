@@ -0,0 +1,840 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+
+#include "pugixml.hpp"
+
+#include "AMLXmlWriter.h"
+#include "AMLSchema.h"
+#include "AMLScalar.h"
+#include "AMLOutputBuffer.h"
+#include "AMLModelImage.h"
+#include "AMLInterface.h"
+#include "AMLException.h"
+#include "AMLLogger.h"
+
+#define TAG "AMLXmlWriter"
+
+using namespace std;
+using namespace AML;
+
+static const char INTERNAL_ELEMENT[]                = "InternalElement";
+static const char ATTRIBUTE[]                       = "Attribute";
+
+static const char NAME[]                            = "Name";
+static const char ATTRIBUTE_DATA_TYPE[]             = "AttributeDataType";
+static const char REF_BASE_SYSTEM_UNIT_PATH[]       = "RefBaseSystemUnitPath";
+
+static const char EVENT[]                           = "Event";
+
+static const char KEY_DEVICE[]                      = "device";
+static const char KEY_ID[]                          = "id";
+static const char KEY_TIMESTAMP[]                   = "timestamp";
+
+// Every AML(XML) document starts with the same declaration and CAEXFile attributes.
+static const char AML_HEADER[]                      = "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+                                                      "<CAEXFile FileName=\"\" SchemaVersion=\"2.15\" "
+                                                      "xsi:noNamespaceSchemaLocation=\"CAEX_ClassModel_V2.15.xsd\" "
+                                                      "xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\">";
+
+// Depth of nodes in AML(XML) document : <CAEXFile>/<InstanceHierarchy>/<InternalElement Name="Event">/<InternalElement>
+static const unsigned int DEPTH_MODEL               = 1;
+static const unsigned int DEPTH_EVENT               = 2;
+static const unsigned int DEPTH_DATA                = 3;
+
+// Formatting state between nodes, which is the same as pugixml 'format_indent' with "\t".
+// No new line and indent are written after text, so that the text stays as it is.
+static const unsigned int INDENT_NEWLINE            = 1;
+static const unsigned int INDENT_INDENT             = 2;
+
+template <typename Output>
+static void writeEscaped(const char* s, bool isAttribute, Output& xml)
+{
+    for (; '\0' != *s; ++s)
+    {
+        unsigned char c = static_cast<unsigned char>(*s);
+        switch (c)
+        {
+            case '&':   xml.append("&amp;");    break;
+            case '<':   xml.append("&lt;");     break;
+            case '>':   xml.append("&gt;");     break;
+            case '"':
+                if (isAttribute)    xml.append("&quot;");
+                else                xml.push_back('"');
+                break;
+            default:
+                // control characters are written as character references, except the ones which are kept as whitespace
+                if (c < 32 && '\t' != c && (isAttribute || ('\r' != c && '\n' != c)))
+                {
+                    xml.append("&#");
+                    xml.push_back(static_cast<char>('0' + c / 10));
+                    xml.push_back(static_cast<char>('0' + c % 10));
+                    xml.push_back(';');
+                }
+                else
+                {
+                    xml.push_back(static_cast<char>(c));
+                }
+                break;
+        }
+    }
+}
+
+template <typename Output>
+static void writeAttribute(const char* name, const char* value, Output& xml)
+{
+    xml.push_back(' ');
+    xml.append(name);
+    xml.append("=\"");
+    writeEscaped(value, true, xml);
+    xml.push_back('"');
+}
+
+static void writeAttributes(pugi::xml_node xml_node, std::string& xml)
+{
+    for (pugi::xml_attribute xml_attr = xml_node.first_attribute(); xml_attr; xml_attr = xml_attr.next_attribute())
+    {
+        writeAttribute(xml_attr.name(), xml_attr.value(), xml);
+    }
+}
+
+template <typename Output>
+static void writeIndent(unsigned int depth, unsigned int flags, Output& xml)
+{
+    if (flags & INDENT_NEWLINE)     xml.push_back('\n');
+    if (flags & INDENT_INDENT)      xml.append(depth, '\t');
+}
+
+// Serializes a node of the model as it is.
+// As the model is loaded with 'parse_default', it does not have nodes other than element, pcdata and cdata.
+static void writeStatic(pugi::xml_node xml_node, unsigned int depth, unsigned int* flags, std::string& xml)
+{
+    switch (xml_node.type())
+    {
+        case pugi::node_pcdata:
+            writeEscaped(xml_node.value(), false, xml);
+            *flags = 0;
+            break;
+
+        case pugi::node_cdata:
+            xml.append("<![CDATA[");
+            xml.append(xml_node.value());
+            xml.append("]]>");
+            *flags = 0;
+            break;
+
+        case pugi::node_element:
+            writeIndent(depth, *flags, xml);
+            xml.push_back('<');
+            xml.append(xml_node.name());
+            writeAttributes(xml_node, xml);
+
+            if (NULL == xml_node.first_child())
+            {
+                xml.append(" />");
+            }
+            else
+            {
+                xml.push_back('>');
+                *flags = INDENT_NEWLINE | INDENT_INDENT;
+                for (pugi::xml_node xml_child = xml_node.first_child(); xml_child; xml_child = xml_child.next_sibling())
+                {
+                    writeStatic(xml_child, depth + 1, flags, xml);
+                }
+                writeIndent(depth, *flags, xml);
+                xml.append("</");
+                xml.append(xml_node.name());
+                xml.push_back('>');
+            }
+            *flags = INDENT_NEWLINE | INDENT_INDENT;
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void compileStatic(pugi::xml_node xml_node, unsigned int depth, XmlTemplateNode* node)
+{
+    // The text of a static element starts with '<', the new line and indent before it depend on the previous node.
+    unsigned int flags = 0;
+    node->type = (pugi::node_element == xml_node.type()) ? XmlTemplateNode::Type::Static : XmlTemplateNode::Type::Text;
+    node->depth = depth;
+    writeStatic(xml_node, depth, &flags, node->text);
+}
+
+static void compileElement(pugi::xml_node xml_node, unsigned int depth, XmlTemplateNode* node)
+{
+    node->type = XmlTemplateNode::Type::Element;
+    node->depth = depth;
+
+    node->text.push_back('<');
+    node->text.append(xml_node.name());
+    writeAttributes(xml_node, node->text);
+
+    node->endText.append("</");
+    node->endText.append(xml_node.name());
+    node->endText.push_back('>');
+
+    node->hasStaticChild = (NULL != xml_node.first_child());
+}
+
+static void compileChildren(pugi::xml_node xml_node, XmlTemplateNode* node)
+{
+    for (pugi::xml_node xml_child = xml_node.first_child(); xml_child; xml_child = xml_child.next_sibling())
+    {
+        node->children.push_back(XmlTemplateNode());
+        compileStatic(xml_child, node->depth + 1, &node->children.back());
+    }
+}
+
+static void addValue(XmlTemplateNode* node, XmlTemplateNode::Source source, const AttributeSchema* attr)
+{
+    node->children.push_back(XmlTemplateNode());
+
+    node->hasStaticChild = true;
+
+    XmlTemplateNode& value = node->children.back();
+    value.type = XmlTemplateNode::Type::Value;
+    value.source = source;
+    value.depth = node->depth + 1;
+    value.attr = attr;
+}
+
+static void addStringArray(pugi::xml_node xml_attr, const AttributeSchema* attr, XmlTemplateNode* node)
+{
+    node->children.push_back(XmlTemplateNode());
+
+    XmlTemplateNode& array = node->children.back();
+    array.type = XmlTemplateNode::Type::StringArray;
+    array.depth = node->depth + 1;
+    array.attr = attr;
+
+    // Each element has a copy of attributes of the parent whose Name is replaced with "1", "2", "3"...
+    pugi::xml_attribute xml_name = xml_attr.attribute(NAME);
+    array.hasName = (NULL != xml_name);
+
+    std::string* text = &array.text;
+    text->push_back('<');
+    text->append(ATTRIBUTE);
+    for (pugi::xml_attribute xml_attribute = xml_attr.first_attribute(); xml_attribute; xml_attribute = xml_attribute.next_attribute())
+    {
+        if (xml_attribute == xml_name)
+        {
+            text->push_back(' ');
+            text->append(NAME);
+            text->append("=\"");
+            text = &array.endText;
+            text->push_back('"');
+        }
+        else
+        {
+            writeAttribute(xml_attribute.name(), xml_attribute.value(), *text);
+        }
+    }
+    text->push_back('>');
+    writeIndent(array.depth + 1, INDENT_NEWLINE | INDENT_INDENT, *text);
+    text->append("<Value>");
+
+    array.closeText.append("</Value>");
+    writeIndent(array.depth, INDENT_NEWLINE | INDENT_INDENT, array.closeText);
+    array.closeText.append("</");
+    array.closeText.append(ATTRIBUTE);
+    array.closeText.push_back('>');
+}
+
+static void compileAttributes(pugi::xml_node xml_node, const std::vector<AttributeSchema>& attributes, XmlTemplateNode* node);
+
+static void compileAttribute(pugi::xml_node xml_attr, const AttributeSchema& attr, unsigned int depth, XmlTemplateNode* node)
+{
+    switch (attr.kind)
+    {
+        case AttributeKind::String:
+            compileElement(xml_attr, depth, node);
+            compileChildren(xml_attr, node);
+            addValue(node, XmlTemplateNode::Source::AMLData, &attr);
+            break;
+
+        case AttributeKind::StringArray:
+        {
+            // As AML Document(BPR MLA, V 1.0.0), 'AttributeDataType' of the parent attribute node should be kept empty.
+            pugi::xml_attribute xml_dataType = xml_attr.attribute(ATTRIBUTE_DATA_TYPE);
+
+            node->type = XmlTemplateNode::Type::Element;
+            node->depth = depth;
+            node->text.push_back('<');
+            node->text.append(xml_attr.name());
+            for (pugi::xml_attribute xml_attribute = xml_attr.first_attribute(); xml_attribute; xml_attribute = xml_attribute.next_attribute())
+            {
+                writeAttribute(xml_attribute.name(), (xml_attribute == xml_dataType) ? "" : xml_attribute.value(), node->text);
+            }
+            node->endText.append("</");
+            node->endText.append(xml_attr.name());
+            node->endText.push_back('>');
+            node->hasStaticChild = true; // <RefSemantic>
+
+            compileChildren(xml_attr, node);
+            addStringArray(xml_attr, &attr, node);
+            break;
+        }
+
+        case AttributeKind::AMLData:
+            compileElement(xml_attr, depth, node);
+            node->attr = &attr;
+            compileAttributes(xml_attr, attr.attributes, node);
+            break;
+
+        case AttributeKind::Static:
+            compileStatic(xml_attr, depth, node);
+            break;
+
+        case AttributeKind::Invalid:
+            node->type = XmlTemplateNode::Type::Invalid;
+            node->depth = depth;
+            node->attr = &attr;
+            break;
+    }
+}
+
+// The <Attribute> children are in the same order as the compiled attributes.
+static void compileAttributes(pugi::xml_node xml_node, const std::vector<AttributeSchema>& attributes, XmlTemplateNode* node)
+{
+    std::vector<AttributeSchema>::const_iterator attr = attributes.begin();
+
+    for (pugi::xml_node xml_child = xml_node.first_child(); xml_child; xml_child = xml_child.next_sibling())
+    {
+        node->children.push_back(XmlTemplateNode());
+
+        if (pugi::node_element == xml_child.type() && 0 == strcmp(xml_child.name(), ATTRIBUTE))
+        {
+            compileAttribute(xml_child, *attr++, node->depth + 1, &node->children.back());
+        }
+        else
+        {
+            compileStatic(xml_child, node->depth + 1, &node->children.back());
+        }
+    }
+}
+
+static void compileInternalElement(const AMLSchema& schema, const InternalElementSchema& suc, unsigned int depth, XmlTemplateNode* node)
+{
+    pugi::xml_node xml_suc = suc.node;
+
+    // SystemUnitClass -> InternalElement, with RefBaseSystemUnitPath
+    node->type = XmlTemplateNode::Type::Element;
+    node->depth = depth;
+    node->text.push_back('<');
+    node->text.append(INTERNAL_ELEMENT);
+    writeAttributes(xml_suc, node->text);
+    writeAttribute(REF_BASE_SYSTEM_UNIT_PATH, (schema.getName() + "/" + suc.name).c_str(), node->text);
+
+    node->endText.append("</");
+    node->endText.append(INTERNAL_ELEMENT);
+    node->endText.push_back('>');
+
+    node->hasStaticChild = (NULL != xml_suc.first_child());
+}
+
+static void compileEvent(const AMLSchema& schema, const InternalElementSchema& event, XmlTemplateNode* node)
+{
+    compileInternalElement(schema, event, DEPTH_EVENT, node);
+
+    // default attributes of Event get values from AMLObject, the others are kept as they are.
+    for (pugi::xml_node xml_child = event.node.first_child(); xml_child; xml_child = xml_child.next_sibling())
+    {
+        node->children.push_back(XmlTemplateNode());
+        XmlTemplateNode& child = node->children.back();
+
+        std::string name(xml_child.attribute(NAME).value());
+        bool isAttribute = (pugi::node_element == xml_child.type() && 0 == strcmp(xml_child.name(), ATTRIBUTE));
+
+        XmlTemplateNode::Source source;
+        if      (isAttribute && name == KEY_DEVICE)     source = XmlTemplateNode::Source::DeviceId;
+        else if (isAttribute && name == KEY_TIMESTAMP)  source = XmlTemplateNode::Source::TimeStamp;
+        else if (isAttribute && name == KEY_ID)         source = XmlTemplateNode::Source::Id;
+        else
+        {
+            compileStatic(xml_child, DEPTH_EVENT + 1, &child);
+            continue;
+        }
+
+        compileElement(xml_child, DEPTH_EVENT + 1, &child);
+        compileChildren(xml_child, &child);
+        addValue(&child, source, nullptr);
+    }
+
+    // add AMLDatas into Event
+    node->children.push_back(XmlTemplateNode());
+    node->children.back().type = XmlTemplateNode::Type::Data;
+    node->children.back().depth = DEPTH_DATA;
+}
+
+AMLXmlWriter::AMLXmlWriter(const AMLSchema& schema, pugi::xml_node roleClassLib, pugi::xml_node systemUnitClassLib)
+{
+    m_header.append(AML_HEADER);
+
+    writeIndent(DEPTH_MODEL, INDENT_NEWLINE | INDENT_INDENT, m_ihHeader);
+    m_ihHeader.append("<InstanceHierarchy");
+    writeAttribute(NAME, schema.getName().c_str(), m_ihHeader); // set IH name to be the same as SUCL name
+    m_ihHeader.push_back('>');
+
+    // The model is the same on every document, so it is serialized only once.
+    unsigned int flags = INDENT_NEWLINE | INDENT_INDENT;
+    writeStatic(roleClassLib, DEPTH_MODEL, &flags, m_model);
+    writeStatic(systemUnitClassLib, DEPTH_MODEL, &flags, m_model);
+
+    const InternalElementSchema* event = schema.findSystemUnitClass(EVENT);
+    if (nullptr != event)
+    {
+        compileEvent(schema, *event, &m_event);
+    }
+    else
+    {
+        m_event.type = XmlTemplateNode::Type::Invalid;
+    }
+
+    for (pugi::xml_node xml_suc = systemUnitClassLib.first_child(); xml_suc; xml_suc = xml_suc.next_sibling())
+    {
+        std::string sucName(xml_suc.attribute(NAME).value());
+        const InternalElementSchema* suc = schema.findSystemUnitClass(sucName);
+        if (nullptr == suc || m_internalElements.find(sucName) != m_internalElements.end())
+        {
+            continue;
+        }
+
+        XmlTemplateNode& node = m_internalElements[sucName];
+        compileInternalElement(schema, *suc, DEPTH_DATA, &node);
+        compileAttributes(suc->node, suc->attributes, &node);
+    }
+}
+
+// Attributes are referred to by their index in AMLSchema::getAttributes(), 0 for none.
+static void saveNode(const XmlTemplateNode& node, const std::unordered_map<const AttributeSchema*, size_t>& indices, AMLImageWriter& image)
+{
+    image.writeSize(static_cast<size_t>(node.type));
+    image.writeSize(static_cast<size_t>(node.source));
+    image.writeSize(node.depth);
+    image.writeString(node.text);
+    image.writeString(node.endText);
+    image.writeString(node.closeText);
+    image.writeSize((nullptr == node.attr) ? 0 : indices.at(node.attr) + 1);
+    image.writeBool(node.hasName);
+    image.writeBool(node.hasStaticChild);
+
+    image.writeSize(node.children.size());
+    for (const XmlTemplateNode& child : node.children)
+    {
+        saveNode(child, indices, image);
+    }
+}
+
+static void loadNode(AMLImageReader& image, const std::vector<const AttributeSchema*>& attributes, XmlTemplateNode* node)
+{
+    node->type              = static_cast<XmlTemplateNode::Type>(image.readSize(static_cast<size_t>(XmlTemplateNode::Type::Data) + 1));
+    node->source            = static_cast<XmlTemplateNode::Source>(image.readSize(static_cast<size_t>(XmlTemplateNode::Source::Id) + 1));
+    node->depth             = static_cast<unsigned int>(image.readSize());
+    node->text              = image.readString();
+    node->endText           = image.readString();
+    node->closeText         = image.readString();
+
+    size_t attr             = image.readSize(attributes.size() + 1);
+    node->attr              = (0 == attr) ? nullptr : attributes[attr - 1];
+    node->hasName           = image.readBool();
+    node->hasStaticChild    = image.readBool();
+
+    // writeNode() reads the key of these nodes
+    bool needsAttr = (XmlTemplateNode::Type::Invalid == node->type || XmlTemplateNode::Type::StringArray == node->type ||
+                      (XmlTemplateNode::Type::Value == node->type && XmlTemplateNode::Source::AMLData == node->source));
+    if (needsAttr && nullptr == node->attr)
+    {
+        AML_LOG(ERROR, TAG, "Invalid compiled model : template has no attribute");
+        throw AMLException(INVALID_BYTE_STR);
+    }
+
+    node->children.resize(image.readCount());
+    for (XmlTemplateNode& child : node->children)
+    {
+        loadNode(image, attributes, &child);
+    }
+}
+
+AMLXmlWriter::AMLXmlWriter(const AMLSchema& schema, AMLImageReader& image)
+{
+    std::vector<const AttributeSchema*> attributes = schema.getAttributes();
+
+    m_header = image.readString();
+    m_ihHeader = image.readString();
+    m_model = image.readString();
+    loadNode(image, attributes, &m_event);
+
+    size_t count = image.readCount();
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::string sucName = image.readString();
+        loadNode(image, attributes, &m_internalElements[sucName]);
+    }
+}
+
+void AMLXmlWriter::save(const AMLSchema& schema, AMLImageWriter& image) const
+{
+    std::vector<const AttributeSchema*> attributes = schema.getAttributes();
+    std::unordered_map<const AttributeSchema*, size_t> indices;
+    for (size_t i = 0; i < attributes.size(); ++i)
+    {
+        indices[attributes[i]] = i;
+    }
+
+    image.writeString(m_header);
+    image.writeString(m_ihHeader);
+    image.writeString(m_model);
+    saveNode(m_event, indices, image);
+
+    std::vector<std::string> sucNames;
+    for (const auto& iter : m_internalElements)
+    {
+        sucNames.push_back(iter.first);
+    }
+    std::sort(sucNames.begin(), sucNames.end());
+
+    image.writeSize(sucNames.size());
+    for (const std::string& sucName : sucNames)
+    {
+        image.writeString(sucName);
+        saveNode(m_internalElements.at(sucName), indices, image);
+    }
+}
+
+template <typename Output>
+void AMLXmlWriter::write(const AMLObject& amlObject, bool includeModel, Output& xml) const
+{
+    writeHeader(xml);
+    writeInstanceHierarchy(amlObject, xml);
+    writeFooter(includeModel, xml);
+}
+
+template <typename Output>
+void AMLXmlWriter::writeHeader(Output& xml) const
+{
+    xml.append(m_header);
+}
+
+template <typename Output>
+void AMLXmlWriter::writeInstanceHierarchy(const AMLObject& amlObject, Output& xml) const
+{
+    if (XmlTemplateNode::Type::Invalid == m_event.type)
+    {
+        AML_LOG_V(ERROR, TAG, "Invalid Data : <%s> is not present in SystemUnitClassLib", EVENT);
+        throw AMLException(NOT_MATCH_TO_AML_MODEL);
+    }
+
+    xml.append(m_ihHeader);
+
+    unsigned int flags = INDENT_NEWLINE | INDENT_INDENT;
+    writeNode(m_event, amlObject, nullptr, &flags, xml);
+
+    writeIndent(DEPTH_MODEL, flags, xml);
+    xml.append("</InstanceHierarchy>");
+}
+
+template <typename Output>
+void AMLXmlWriter::writeFooter(bool includeModel, Output& xml) const
+{
+    if (includeModel)
+    {
+        xml.append(m_model);
+    }
+
+    xml.append("\n</CAEXFile>\n");
+}
+
+// Returns the total length of "1", "2", ... "count".
+static size_t lengthOfIndices(size_t count)
+{
+    size_t length = 0;
+    for (size_t low = 1, digits = 1; low <= count; low *= 10, ++digits)
+    {
+        size_t high = (count / 10 < low) ? count : low * 10 - 1;
+        length += (high - low + 1) * digits;
+    }
+    return length;
+}
+
+size_t AMLXmlWriter::estimate(const AMLObject& amlObject, bool includeModel) const
+{
+    if (XmlTemplateNode::Type::Invalid == m_event.type)
+    {
+        AML_LOG_V(ERROR, TAG, "Invalid Data : <%s> is not present in SystemUnitClassLib", EVENT);
+        throw AMLException(NOT_MATCH_TO_AML_MODEL);
+    }
+
+    size_t size = m_header.size() + m_ihHeader.size() + estimateNode(m_event, amlObject, nullptr) + sizeof("\n\t</InstanceHierarchy>\n</CAEXFile>\n") - 1;
+    if (includeModel)
+    {
+        size += m_model.size();
+    }
+    return size;
+}
+
+size_t AMLXmlWriter::estimateNode(const XmlTemplateNode& node, const AMLObject& amlObject, const AMLData* amlData) const
+{
+    // Same walk as writeNode() without writing, which throws the same exceptions. Escaping of values is not counted.
+    size_t indent = node.depth + 1;
+    switch (node.type)
+    {
+        case XmlTemplateNode::Type::Text:
+            return node.text.size();
+
+        case XmlTemplateNode::Type::Static:
+            return indent + node.text.size();
+
+        case XmlTemplateNode::Type::Element:
+        {
+            const AMLData* data = (nullptr != node.attr) ? &amlData->getValueToAMLData(node.attr->symbol) : amlData;
+
+            bool hasChild = node.hasStaticChild ||
+                            (false == node.children.empty() && XmlTemplateNode::Type::Data == node.children.back().type &&
+                             false == amlObject.getDataNames().empty());
+            if (false == hasChild)
+            {
+                return indent + node.text.size() + sizeof(" />") - 1;
+            }
+
+            size_t size = 2 * indent + node.text.size() + 1 + node.endText.size();
+            for (const XmlTemplateNode& child : node.children)
+            {
+                size += estimateNode(child, amlObject, data);
+            }
+            return size;
+        }
+
+        case XmlTemplateNode::Type::Value:
+        {
+            size_t size = indent + sizeof("<Value></Value>") - 1;
+            switch (node.source)
+            {
+                case XmlTemplateNode::Source::AMLData:
+                {
+                    AMLValueType type = getScalarValueType(*amlData, node.attr->symbol, node.attr->scalarType);
+                    if (AMLValueType::String == type)
+                    {
+                        size += amlData->getValueToStr(node.attr->symbol).size();
+                    }
+                    else
+                    {
+                        std::string text;
+                        appendScalar(*amlData, node.attr->symbol, type, node.attr->scalarType, text);
+                        size += text.size();
+                    }
+                    break;
+                }
+                case XmlTemplateNode::Source::DeviceId:     size += amlObject.getDeviceId().size();                    break;
+                case XmlTemplateNode::Source::TimeStamp:    size += amlObject.getTimeStamp().size();                   break;
+                case XmlTemplateNode::Source::Id:           size += amlObject.getId().size();                          break;
+            }
+            return size;
+        }
+
+        case XmlTemplateNode::Type::StringArray:
+        {
+            AMLValueType type = getArrayValueType(*amlData, node.attr->symbol, node.attr->scalarType);
+            if (AMLValueType::StringArray != type)
+            {
+                std::string text;
+                appendScalar(*amlData, node.attr->symbol, type, node.attr->scalarType, text);
+                return indent + sizeof("<Value></Value>") - 1 + text.size();
+            }
+
+            const std::vector<std::string>& values = amlData->getValueToStrArr(node.attr->symbol);
+
+            size_t size = values.size() * (indent + node.text.size() + node.closeText.size());
+            if (node.hasName)
+            {
+                size += values.size() * node.endText.size() + lengthOfIndices(values.size());
+            }
+            for (const std::string& value : values)
+            {
+                size += value.size();
+            }
+            return size;
+        }
+
+        case XmlTemplateNode::Type::Invalid:
+            AML_LOG_V(ERROR, TAG, "Invalid AML : <%s> has value of invalid type", node.attr->name.c_str());
+            throw AMLException(INVALID_AML_SCHEMA);
+
+        case XmlTemplateNode::Type::Data:
+        {
+            size_t size = 0;
+            for (const std::string& name : amlObject.getDataNames())
+            {
+                auto iter = m_internalElements.find(name);
+                if (iter == m_internalElements.end())
+                {
+                    AML_LOG_V(ERROR, TAG, "Invalid Data : <%s> is not present in SystemUnitClassLib", name.c_str());
+                    throw AMLException(NOT_MATCH_TO_AML_MODEL);
+                }
+
+                size += estimateNode(iter->second, amlObject, &amlObject.getData(name));
+            }
+            return size;
+        }
+    }
+    return 0;
+}
+
+template <typename Output>
+void AMLXmlWriter::writeNode(const XmlTemplateNode& node, const AMLObject& amlObject, const AMLData* amlData, unsigned int* flags, Output& xml) const
+{
+    switch (node.type)
+    {
+        case XmlTemplateNode::Type::Text:
+            xml.append(node.text);
+            *flags = 0;
+            break;
+
+        case XmlTemplateNode::Type::Static:
+            writeIndent(node.depth, *flags, xml);
+            xml.append(node.text);
+            *flags = INDENT_NEWLINE | INDENT_INDENT;
+            break;
+
+        case XmlTemplateNode::Type::Element:
+        {
+            const AMLData* data = (nullptr != node.attr) ? &amlData->getValueToAMLData(node.attr->symbol) : amlData;
+
+            writeIndent(node.depth, *flags, xml);
+            xml.append(node.text);
+
+            // Only "Event" can be empty or not depending on AMLObject.
+            bool hasChild = node.hasStaticChild ||
+                            (false == node.children.empty() && XmlTemplateNode::Type::Data == node.children.back().type &&
+                             false == amlObject.getDataNames().empty());
+            if (false == hasChild)
+            {
+                xml.append(" />");
+            }
+            else
+            {
+                xml.push_back('>');
+                *flags = INDENT_NEWLINE | INDENT_INDENT;
+                for (const XmlTemplateNode& child : node.children)
+                {
+                    writeNode(child, amlObject, data, flags, xml);
+                }
+                writeIndent(node.depth, *flags, xml);
+                xml.append(node.endText);
+            }
+            *flags = INDENT_NEWLINE | INDENT_INDENT;
+            break;
+        }
+
+        case XmlTemplateNode::Type::Value:
+        {
+            const std::string* value = nullptr;
+            AMLValueType type = AMLValueType::String;
+            switch (node.source)
+            {
+                case XmlTemplateNode::Source::AMLData:
+                    type = getScalarValueType(*amlData, node.attr->symbol, node.attr->scalarType);
+                    if (AMLValueType::String == type)
+                    {
+                        value = &amlData->getValueToStr(node.attr->symbol);
+                    }
+                    break;
+                case XmlTemplateNode::Source::DeviceId:     value = &amlObject.getDeviceId();                  break;
+                case XmlTemplateNode::Source::TimeStamp:    value = &amlObject.getTimeStamp();                 break;
+                case XmlTemplateNode::Source::Id:           value = &amlObject.getId();                        break;
+            }
+
+            writeIndent(node.depth, *flags, xml);
+            xml.append("<Value>");
+            if (nullptr != value)
+            {
+                writeEscaped(value->c_str(), false, xml);
+            }
+            else
+            {
+                appendScalar(*amlData, node.attr->symbol, type, node.attr->scalarType, xml);
+            }
+            xml.append("</Value>");
+            *flags = INDENT_NEWLINE | INDENT_INDENT;
+            break;
+        }
+
+        case XmlTemplateNode::Type::StringArray:
+        {
+            // A numeric array is a single <Value> of the elements, instead of an <Attribute> for each of them.
+            AMLValueType type = getArrayValueType(*amlData, node.attr->symbol, node.attr->scalarType);
+            if (AMLValueType::StringArray != type)
+            {
+                writeIndent(node.depth, *flags, xml);
+                xml.append("<Value>");
+                appendScalar(*amlData, node.attr->symbol, type, node.attr->scalarType, xml);
+                xml.append("</Value>");
+                *flags = INDENT_NEWLINE | INDENT_INDENT;
+                break;
+            }
+
+            const std::vector<std::string>& values = amlData->getValueToStrArr(node.attr->symbol);
+            for (std::size_t i = 0, size = values.size(); i != size; ++i)
+            {
+                writeIndent(node.depth, *flags, xml);
+                xml.append(node.text);
+                if (node.hasName)
+                {
+                    // The names of child attribute are "1", "2", "3"...
+                    xml.append(std::to_string(i + 1));
+                    xml.append(node.endText);
+                }
+                writeEscaped(values[i].c_str(), false, xml);
+                xml.append(node.closeText);
+                *flags = INDENT_NEWLINE | INDENT_INDENT;
+            }
+            break;
+        }
+
+        case XmlTemplateNode::Type::Invalid:
+            AML_LOG_V(ERROR, TAG, "Invalid AML : <%s> has value of invalid type", node.attr->name.c_str());
+            throw AMLException(INVALID_AML_SCHEMA);
+
+        case XmlTemplateNode::Type::Data:
+            for (const std::string& name : amlObject.getDataNames())
+            {
+                auto iter = m_internalElements.find(name);
+                if (iter == m_internalElements.end())
+                {
+                    AML_LOG_V(ERROR, TAG, "Invalid Data : <%s> is not present in SystemUnitClassLib", name.c_str());
+                    throw AMLException(NOT_MATCH_TO_AML_MODEL);
+                }
+
+                writeNode(iter->second, amlObject, &amlObject.getData(name), flags, xml);
+            }
+            break;
+    }
+}
+
+template void AMLXmlWriter::write<std::string>(const AMLObject& amlObject, bool includeModel, std::string& xml) const;
+template void AMLXmlWriter::write<AMLVectorBuffer>(const AMLObject& amlObject, bool includeModel, AMLVectorBuffer& xml) const;
+template void AMLXmlWriter::write<AMLSinkBuffer>(const AMLObject& amlObject, bool includeModel, AMLSinkBuffer& xml) const;
+template void AMLXmlWriter::writeHeader<std::string>(std::string& xml) const;
+template void AMLXmlWriter::writeInstanceHierarchy<std::string>(const AMLObject& amlObject, std::string& xml) const;
+template void AMLXmlWriter::writeFooter<std::string>(bool includeModel, std::string& xml) const;
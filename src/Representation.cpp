@@ -15,11 +15,15 @@
  *
  *******************************************************************************/
 
-#include <string.h>
 #include <string>
-#include <sstream>
 #include <vector>
+#include <utility>
 #include <cassert>
+#include <new>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <iterator>
 
 #include "pugixml.hpp"
 
@@ -27,9 +31,17 @@
 #include "AMLInterface.h"
 #include "AMLException.h"
 #include "AMLLogger.h"
+#include "AMLSchema.h"
+#include "AMLXmlWriter.h"
+#include "AMLOutputBuffer.h"
+#include "AMLXmlReader.h"
+#include "AMLObjectViewSource.h"
+#include "AMLMappedFile.h"
+#include "AMLModelImage.h"
+#include "AMLCompactCodec.h"
 
 #ifndef _DISABLE_PROTOBUF_
-#include "AML.pb.h"
+#include "AMLProtoCodec.h"
 #endif
 
 #define TAG "Representation"
@@ -38,43 +50,21 @@ using namespace std;
 using namespace AML;
 
 static const char CAEX_FILE[]                       = "CAEXFile";
-static const char INSTANCE_HIERARCHY[]              = "InstanceHierarchy";
 static const char ROLE_CLASS_LIB[]                  = "RoleClassLib";
 static const char ROLE_CLASS[]                      = "RoleClass";
 static const char SYSTEM_UNIT_CLASS_LIB[]           = "SystemUnitClassLib";
 static const char SYSTEM_UNIT_CLASS[]               = "SystemUnitClass";
-static const char INTERNAL_ELEMENT[]                = "InternalElement";
-static const char ATTRIBUTE[]                       = "Attribute";
-static const char ADDITIONAL_INFORMATION[]          = "AdditionalInformation";
-static const char REF_SEMANTIC[]                    = "RefSemantic";
 static const char VERSION[]                         = "Version";
 
 static const char NAME[]                            = "Name";
-static const char VALUE[]                           = "Value";
 static const char ATTRIBUTE_DATA_TYPE[]             = "AttributeDataType";
 static const char DESCRIPTION[]                     = "Description";
 static const char REF_BASE_SYSTEM_UNIT_PATH[]       = "RefBaseSystemUnitPath";
 static const char REF_ROLE_CLASS_PATH[]             = "RefRoleClassPath";
 static const char SUPPORTED_ROLE_CLASS[]            = "SupportedRoleClass";
-static const char CORRESPONDING_ATTRIBUTE_PATH[]    = "CorrespondingAttributePath";
-static const char ORDERED_LIST_TYPE[]               = "OrderedListType";
 
 static const char EVENT[]                           = "Event";
 
-static const char KEY_DEVICE[]                      = "device";
-static const char KEY_ID[]                          = "id";
-static const char KEY_TIMESTAMP[]                   = "timestamp";
-
-#define IS_NAME(node, name)                     (std::string((node).attribute(NAME).value()) == (name))
-#define ADD_VALUE(node, value)                  ((node).append_child(VALUE).text().set((value).c_str())) //#TODO: verify non-null after append_child()
-
-#define VERIFY_NON_NULL_THROW_EXCEPTION(var)    if (NULL == (var)) throw AMLException(NO_MEMORY); 
-
-#define IS_VALUE_TYPE_STRING(node)              (NULL != (node).child(VALUE))
-#define IS_VALUE_TYPE_STRING_ARRAY(node)        ((NULL != (node).child(REF_SEMANTIC)) && \
-                                                 0 != strncmp((node).attribute(CORRESPONDING_ATTRIBUTE_PATH).value(), ORDERED_LIST_TYPE, strlen(ORDERED_LIST_TYPE)))
-#define IS_VALUE_TYPE_MAP(node)                 ((NULL == (node).child(REF_SEMANTIC)) && (NULL != (node).child(ATTRIBUTE)))
-
 // for test ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #define PRINT_NODE(node)    for (pugi::xml_node tool = (node).first_child(); tool; tool = tool.next_sibling()) \
                             {\
@@ -88,619 +78,749 @@ static const char KEY_TIMESTAMP[]                   = "timestamp";
                             std::cout<<std::endl;
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-#ifndef _DISABLE_PROTOBUF_
-template <typename T>
-static void extractAttribute(T* attr, pugi::xml_node xmlNode);
-
-template <typename T>
-static void extractInternalElement(T* ie, pugi::xml_node xmlNode);
-
-template <typename T>
-static void extractProtoAttribute(pugi::xml_node xmlNode, T* attr);
-
-template <typename T>
-static void extractProtoInternalElement(pugi::xml_node xmlNode, T* ie);
-#endif // _DISABLE_PROTOBUF_
-
-template <typename T>
-static std::string toString(const T& t)
+static void verifyAmlObjects(const std::vector<const AMLObject*>& amlObjects)
 {
-    std::ostringstream ss;
-    ss << t;
-    return ss.str();
+    for (const AMLObject* amlObject : amlObjects)
+    {
+        if (nullptr == amlObject)
+        {
+            AML_LOG(ERROR, TAG, "Invalid parameter : AMLObject is null");
+            throw AMLException(INVALID_PARAM);
+        }
+    }
 }
 
-class Representation::AMLModel
+// Converts 'count' inputs by decode(index) on the pool. A failed input gets nullptr and its error code, and does not stop the others.
+template <typename Decode>
+static void decodeBatch(size_t count, std::vector<AMLObject*>& amlObjects, std::vector<ResultCode>& results, AMLThreadPool& pool, Decode decode)
 {
-public:
-    AMLModel (const std::string& amlFilePath)
+    std::vector<AMLObject*> objects(count, nullptr);
+    std::vector<ResultCode> codes(count, NO_ERROR);
+    try
     {
-        m_doc = new pugi::xml_document();
-
-        pugi::xml_parse_result result = m_doc->load_file(amlFilePath.c_str());
-        if (pugi::status_ok != result.status) 
+        pool.parallelFor(count, [&](size_t index)
         {
-            AML_LOG_V(ERROR, TAG, "Failed to load file : %s", amlFilePath.c_str());
-            delete m_doc;
-            throw AMLException(INVALID_FILE_PATH);
+            try
+            {
+                objects[index] = decode(index);
+            }
+            catch (const AMLException& e)
+            {
+                codes[index] = e.code();
+            }
+            catch (const std::bad_alloc&)
+            {
+                codes[index] = NO_MEMORY;
+            }
+        });
+    }
+    catch (...)
+    {
+        for (AMLObject* amlObject : objects)
+        {
+            delete amlObject;
         }
+        throw;
+    }
+
+    amlObjects.swap(objects);
+    results.swap(codes);
+}
 
-        pugi::xml_node xmlCaexFile = m_doc->child(CAEX_FILE);
+// AMLModel is not changed after construction : the conversions only read the schema and the writer which are compiled from the model,
+// and keep their scratch state on the stack of each call. So one instance can be used by many threads at once,
+// and is shared by the Representations of the same model file.
+class Representation::AMLModel
+{
+public:
+    // Compiles the model in the document. The document is not used after construction.
+    explicit AMLModel(const pugi::xml_document& doc) : m_schema(nullptr), m_xmlWriter(nullptr)
+    {
+        pugi::xml_node xmlCaexFile = doc.child(CAEX_FILE);
         if (NULL == xmlCaexFile)
         {
             AML_LOG(ERROR, TAG, "Invalid AML File : <CAEXFile> does not exist");
-            delete m_doc;
             throw AMLException(INVALID_AML_SCHEMA);
         }
 
-        m_systemUnitClassLib = xmlCaexFile.child(SYSTEM_UNIT_CLASS_LIB);
-        if (NULL == m_systemUnitClassLib) 
+        pugi::xml_node systemUnitClassLib = xmlCaexFile.child(SYSTEM_UNIT_CLASS_LIB);
+        if (NULL == systemUnitClassLib) 
         {
             AML_LOG(ERROR, TAG, "Invalid AML File : <SystemUnitClassLib> does not exist");
-            delete m_doc;
             throw AMLException(INVALID_AML_SCHEMA);
         }
 
-        m_roleClassLib = xmlCaexFile.child(ROLE_CLASS_LIB);
-        if (NULL == m_roleClassLib) 
+        pugi::xml_node roleClassLib = xmlCaexFile.child(ROLE_CLASS_LIB);
+        if (NULL == roleClassLib) 
         {
             AML_LOG(ERROR, TAG, "Invalid AML File : <RoleClassLib> does not exist");
-            delete m_doc;
             throw AMLException(INVALID_AML_SCHEMA);
         }
 
-        // remove "AdditionalInformation" and "InstanceHierarchy" data
-        while (xmlCaexFile.child(ADDITIONAL_INFORMATION))   xmlCaexFile.remove_child(ADDITIONAL_INFORMATION);
-        while (xmlCaexFile.child(INSTANCE_HIERARCHY))       xmlCaexFile.remove_child(INSTANCE_HIERARCHY);
+        m_modelId = std::string(systemUnitClassLib.attribute(NAME).value()) + "_" + systemUnitClassLib.child_value(VERSION);
+
+        m_schema = new AMLSchema(systemUnitClassLib, roleClassLib);
+        try
+        {
+            m_compactHash = hashCompactModel(*m_schema);
+            m_xmlWriter = new AMLXmlWriter(*m_schema, roleClassLib, systemUnitClassLib);
+        }
+        catch (...)
+        {
+            delete m_schema;
+            throw;
+        }
+
+        // the document is destroyed after construction, so no node of it is kept
+        m_schema->releaseNodes();
+    }
+
+    // Loads the model which save() has compiled into the image, without parsing XML.
+    explicit AMLModel(AMLImageReader& image) : m_schema(nullptr), m_xmlWriter(nullptr)
+    {
+        m_modelId = image.readString();
+        m_schema = new AMLSchema(image);
+        try
+        {
+            m_compactHash = hashCompactModel(*m_schema);
+            m_xmlWriter = new AMLXmlWriter(*m_schema, image);
+            image.finish();
+        }
+        catch (...)
+        {
+            delete m_xmlWriter;
+            delete m_schema;
+            throw;
+        }
     }
 
     ~AMLModel()
     {
-        delete m_doc;
+        delete m_xmlWriter;
+        delete m_schema;
     }
 
-    AMLObject* constructConfigAmlObject()
+    std::string save() const
     {
-        std::string deviceName(m_roleClassLib.attribute(NAME).value());
+        AMLImageWriter image;
+        image.writeString(m_modelId);
+        m_schema->save(image);
+        m_xmlWriter->save(*m_schema, image);
+        return image.finish();
+    }
 
-        AMLObject* amlObj = new AMLObject(deviceName, "0");
+    // Returns the model of the file, which is shared while a Representation of the same version of the file is alive.
+    static std::shared_ptr<const AMLModel> loadFile(const std::string& amlFilePath)
+    {
+        AMLMappedFile file(amlFilePath);
+        return loadFile(file, amlFilePath);
+    }
 
-        for (pugi::xml_node xml_suc = m_systemUnitClassLib.child(SYSTEM_UNIT_CLASS); xml_suc; xml_suc = xml_suc.next_sibling(SYSTEM_UNIT_CLASS))
+    // The stamp is of the mapped contents, which are compiled on a miss. No page of the mapping is read on a hit.
+    static std::shared_ptr<const AMLModel> loadFile(AMLMappedFile& file, const std::string& amlFilePath)
+    {
+        const std::string& stamp = file.stamp();
+        if (stamp.empty())
         {
-            std::string className = xml_suc.attribute(NAME).value();
-            if (0 == className.compare(EVENT)) // Skip "Event"
-            {
-                continue;
-            }
+            return compileFile(file, amlFilePath);
+        }
 
-            pugi::xml_node xml_rc = m_roleClassLib.find_child_by_attribute(ROLE_CLASS, NAME, className.c_str());
-            if (NULL == xml_rc) 
+        ModelCache& cache = getCache();
+        {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            auto iter = cache.models.find(stamp);
+            if (iter != cache.models.end())
             {
-                AML_LOG_V(ERROR, TAG, "Invalid AML File : <RoleClass NAME=\"%s\"> does not exist", className.c_str());
-                throw AMLException(KEY_NOT_EXIST); //@TODO: need to be more specific
+                std::shared_ptr<const AMLModel> model = iter->second.lock();
+                if (nullptr != model)
+                {
+                    return model;
+                }
             }
+        }
 
-            AMLData amlData;
-            for (pugi::xml_node xml_attr = xml_rc.child(ATTRIBUTE); xml_attr; xml_attr = xml_attr.next_sibling(ATTRIBUTE))
-            {
-                amlData.setValue(xml_attr.attribute(NAME).value(), xml_attr.child_value(VALUE));
-            }
+        // compiled without the lock, so that the models of different files are loaded at the same time
+        std::shared_ptr<const AMLModel> model = compileFile(file, amlFilePath);
 
-            amlObj->addData(className, amlData);
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        for (auto iter = cache.models.begin(); iter != cache.models.end(); )
+        {
+            iter = iter->second.expired() ? cache.models.erase(iter) : std::next(iter);
         }
+        cache.models[stamp] = model;
 
-        return amlObj;
+        return model;
     }
 
-    AMLObject* constructAmlObject(pugi::xml_document* xml_doc)
+    static std::shared_ptr<const AMLModel> loadBuffer(const char* amlModel, size_t size)
     {
-        assert(nullptr != xml_doc);
-
-        if (NULL == xml_doc->child(CAEX_FILE) ||
-            NULL == xml_doc->child(CAEX_FILE).child(INSTANCE_HIERARCHY))
+        if (nullptr == amlModel && 0 != size)
         {
-            AML_LOG(ERROR, TAG, "<CAEXFile> or <InstanceHierarchy> does not exist");
-            throw AMLException(INVALID_AML_SCHEMA);
+            AML_LOG(ERROR, TAG, "Invalid parameter : buffer is null");
+            throw AMLException(INVALID_PARAM);
         }
 
-        pugi::xml_node xml_event = xml_doc->child(CAEX_FILE).child(INSTANCE_HIERARCHY).find_child_by_attribute(INTERNAL_ELEMENT, NAME, EVENT);
-        if (NULL == xml_event) 
+        if (AMLImageReader::isImage(amlModel, size))
         {
-            AML_LOG(ERROR, TAG, "<Event> does not exist");
-            throw AMLException(INVALID_AML_SCHEMA);
+            AMLImageReader image(amlModel, size);
+            return std::shared_ptr<const AMLModel>(new AMLModel(image));
         }
 
-        std::string deviceId, timeStamp, id;
-        for (pugi::xml_node xml_attr = xml_event.child(ATTRIBUTE); xml_attr; xml_attr = xml_attr.next_sibling(ATTRIBUTE))
+        pugi::xml_document doc;
+        pugi::xml_parse_result result = doc.load_buffer(amlModel, size);
+        if (pugi::status_ok != result.status)
         {
-            if      (IS_NAME(xml_attr, KEY_DEVICE))     deviceId = xml_attr.child_value(VALUE);
-            else if (IS_NAME(xml_attr, KEY_TIMESTAMP))  timeStamp = xml_attr.child_value(VALUE);
-            else if (IS_NAME(xml_attr, KEY_ID))         id = xml_attr.child_value(VALUE);
+            AML_LOG(ERROR, TAG, "Failed to load buffer : Invalid XML");
+            throw AMLException(INVALID_XML_STR);
         }
 
-        AMLObject* amlObj = new AMLObject(deviceId, timeStamp, id);
+        return std::shared_ptr<const AMLModel>(new AMLModel(doc));
+    }
+
+    AMLObject* constructConfigAmlObject() const
+    {
+        AMLObject* amlObj = new AMLObject(m_schema->getRoleClassLibName(), "0");
 
-        for (pugi::xml_node xml_ie = xml_event.child(INTERNAL_ELEMENT); xml_ie; xml_ie = xml_ie.next_sibling(INTERNAL_ELEMENT))
+        for (const std::string& className : m_schema->getSystemUnitClassNames())
         {
-            AMLData amlData = constructAmlData(xml_ie);
-            std::string name = xml_ie.attribute(NAME).value();
+            if (0 == className.compare(EVENT)) // Skip "Event"
+            {
+                continue;
+            }
+
+            const RoleClassSchema* rc = m_schema->findRoleClass(className);
+            if (nullptr == rc)
+            {
+                AML_LOG_V(ERROR, TAG, "Invalid AML File : <RoleClass NAME=\"%s\"> does not exist", className.c_str());
+                throw AMLException(KEY_NOT_EXIST); //@TODO: need to be more specific
+            }
+
+            AMLData amlData;
+            for (const auto& attr : rc->attributes)
+            {
+                amlData.setValue(attr.first, attr.second);
+            }
 
-            amlObj->addData(name, amlData);
+            amlObj->addData(className, amlData);
         }
 
         return amlObj;
     }
 
-    pugi::xml_document* constructXmlDoc()
+    const std::string& getModelId() const
     {
-        pugi::xml_document* xml_doc = new pugi::xml_document();
+        return m_modelId;
+    }
 
-        initializeAML(xml_doc);
+    const AMLSchema& getSchema() const
+    {
+        return *m_schema;
+    }
 
-        return xml_doc;
+    const AMLXmlWriter& getXmlWriter() const
+    {
+        return *m_xmlWriter;
     }
 
-    pugi::xml_document* constructXmlDoc(const AMLObject& amlObject)
+    uint64_t getCompactHash() const
     {
-        pugi::xml_document* xml_doc = constructXmlDoc();
-        // add InstanceHierarchy
-        pugi::xml_node xml_ih = xml_doc->child(CAEX_FILE).append_child(INSTANCE_HIERARCHY);
-        VERIFY_NON_NULL_THROW_EXCEPTION(xml_ih);
+        return m_compactHash;
+    }
 
-        xml_ih.append_attribute(NAME) = m_systemUnitClassLib.attribute(NAME).value(); // set IH name to be the same as SUCL name
+private:
+    struct ModelCache
+    {
+        std::mutex                                                          mutex;
+        std::unordered_map<std::string, std::weak_ptr<const AMLModel>>      models;     // by the stamp of the file
+    };
 
-        // add Event as InternalElement
-        pugi::xml_node xml_event = addInternalElement(xml_ih, EVENT);
-        assert(NULL != xml_event);
+    static ModelCache& getCache()
+    {
+        // never destroyed, as Representations may be released after the static objects
+        static ModelCache* cache = new ModelCache();
+        return *cache;
+    }
 
-        // set default attributes of Event (This has a dependency on AMLObject class..)
-        for (pugi::xml_node xml_attr = xml_event.child(ATTRIBUTE); xml_attr; xml_attr = xml_attr.next_sibling(ATTRIBUTE))
+    // The file is mapped and parsed in place, instead of being read into a buffer. A compiled model is read from the mapping.
+    static std::shared_ptr<const AMLModel> compileFile(AMLMappedFile& file, const std::string& amlFilePath)
+    {
+        if (AMLImageReader::isImage(file.data(), file.size()))
         {
-            if      (IS_NAME(xml_attr, KEY_DEVICE))     ADD_VALUE(xml_attr, amlObject.getDeviceId());
-            else if (IS_NAME(xml_attr, KEY_TIMESTAMP))  ADD_VALUE(xml_attr, amlObject.getTimeStamp());
-            else if (IS_NAME(xml_attr, KEY_ID))         ADD_VALUE(xml_attr, amlObject.getId());
+            try
+            {
+                AMLImageReader image(file.data(), file.size());
+                return std::shared_ptr<const AMLModel>(new AMLModel(image));
+            }
+            catch (const AMLException&)
+            {
+                AML_LOG_V(ERROR, TAG, "Failed to load file : %s is not a valid compiled model", amlFilePath.c_str());
+                throw AMLException(INVALID_FILE_PATH);
+            }
         }
 
-        // add AMLDatas into Event
-        vector<string> dataNames = amlObject.getDataNames();
-
-        for (string name : dataNames)
+        pugi::xml_document doc;
+        pugi::xml_parse_result result = doc.load_buffer_inplace(file.data(), file.size());
+        if (pugi::status_ok != result.status) 
         {
-            AMLData data = amlObject.getData(name);
-
-            pugi::xml_node xml_ie = addInternalElement(xml_event, name);
-
-            setAttributeValue(xml_ie, &data);
+            AML_LOG_V(ERROR, TAG, "Failed to load file : %s", amlFilePath.c_str());
+            throw AMLException(INVALID_FILE_PATH);
         }
-        return xml_doc;
-    }
 
-    void appendModel(pugi::xml_document* xml_doc)
-    {
-        assert(nullptr != xml_doc);
-        xml_doc->child(CAEX_FILE).append_copy(m_roleClassLib);
-        xml_doc->child(CAEX_FILE).append_copy(m_systemUnitClassLib);
+        return std::shared_ptr<const AMLModel>(new AMLModel(doc));
     }
 
-    std::string constructModelId()
-    {
-        std::string suclName(m_systemUnitClassLib.attribute(NAME).value());
-        std::string suclVersion(m_systemUnitClassLib.child_value(VERSION));
+    std::string m_modelId;
+    AMLSchema* m_schema;
+    AMLXmlWriter* m_xmlWriter;
+    uint64_t m_compactHash;     // of the structure of m_schema, which compact byte data depends on
+};
 
-        std::string modelId = suclName + "_" + suclVersion;
+Representation::Representation(const std::string amlFilePath) : m_amlModel(AMLModel::loadFile(amlFilePath))
+{
+}
 
-        return modelId;
-    }
+Representation::Representation(const char* amlModel, size_t size) : m_amlModel(AMLModel::loadBuffer(amlModel, size))
+{
+}
 
-private:
-    pugi::xml_document* m_doc;
-    pugi::xml_node m_systemUnitClassLib;
-    pugi::xml_node m_roleClassLib;
+Representation::Representation(AMLMappedFile& file, const std::string& amlFilePath) : m_amlModel(AMLModel::loadFile(file, amlFilePath))
+{
+}
 
-    void initializeAML(pugi::xml_document* xml_doc)
-    {
-        pugi::xml_node xml_decl = xml_doc->prepend_child(pugi::node_declaration);
-        xml_decl.append_attribute("version") = "1.0";
-        xml_decl.append_attribute("encoding") = "utf-8";
-        //xml_decl.append_attribute("standalone") = "yes";
-
-        pugi::xml_node xml_caexFile = xml_doc->append_child(CAEX_FILE);
-        VERIFY_NON_NULL_THROW_EXCEPTION(xml_caexFile);
-        xml_caexFile.append_attribute("FileName") = "";
-        xml_caexFile.append_attribute("SchemaVersion") = "2.15";
-        xml_caexFile.append_attribute("xsi:noNamespaceSchemaLocation") = "CAEX_ClassModel_V2.15.xsd";
-        xml_caexFile.append_attribute("xmlns:xsi") = "http://www.w3.org/2001/XMLSchema-instance";
-    }
+Representation::~Representation(void)
+{
+}
 
-    AMLData constructAmlData(pugi::xml_node xml_ie)
-    {
-        AMLData amlData;
+std::string Representation::getRepresentationId() const
+{
+    return m_amlModel->getModelId();
+}
 
-        for (pugi::xml_node xml_attr = xml_ie.child(ATTRIBUTE); xml_attr; xml_attr = xml_attr.next_sibling(ATTRIBUTE))
-        {
-            std::string key = xml_attr.attribute(NAME).value();
+AMLObject* Representation::getConfigInfo() const
+{
+    return m_amlModel->constructConfigAmlObject();
+}
 
-            if (IS_VALUE_TYPE_STRING(xml_attr))
-            {
-                std::string value(xml_attr.child_value(VALUE));
+std::string Representation::getCompiledModel() const
+{
+    return m_amlModel->save();
+}
 
-                amlData.setValue(key, value);
-            }
-            else if (IS_VALUE_TYPE_STRING_ARRAY(xml_attr))
-            {
-                vector<string> values;
-                pugi::xml_node xml_child;
-                size_t sizeOfArray = 0;
+std::string Representation::DataToAml(const AMLObject& amlObject) const
+{
+    return DataToAml(amlObject, true);
+}
 
-                for (xml_child = xml_attr.child(ATTRIBUTE); xml_child; xml_child = xml_child.next_sibling(ATTRIBUTE))
-                {
-                    sizeOfArray++;
-                }
+std::string Representation::DataToAml(const AMLObject& amlObject, bool includeModel) const
+{
+    std::string xml;
+    DataToAml(amlObject, includeModel, xml);
 
-                for (size_t index = 1; index <= sizeOfArray; ++index)
-                {
-                    xml_child = xml_attr.find_child_by_attribute(NAME, toString(index).c_str());
-                    std::string value(xml_child.child_value(VALUE));
-                    values.push_back(value);
-                }
+    return xml;
+}
 
-                amlData.setValue(key, values);
-            }
-            else if (IS_VALUE_TYPE_MAP(xml_attr))
-            {
-                AMLData value = constructAmlData(xml_attr);
+size_t Representation::DataToAml(const AMLObject& amlObject, bool includeModel, std::string& out) const
+{
+    // write AML(XML) string from the compiled templates of the model without constructing XML document
+    size_t offset = out.size();
+    try
+    {
+        m_amlModel->getXmlWriter().write(amlObject, includeModel, out);
+    }
+    catch (...)
+    {
+        out.resize(offset);
+        throw;
+    }
 
-                amlData.setValue(key, value);
-            }
-            else
-            {
-                AML_LOG_V(ERROR, TAG, "Invalid AML : <%s> has value of invalid type", key.c_str());
-                throw AMLException(INVALID_AML_SCHEMA);
-            }
-        }
+    return out.size() - offset;
+}
 
-        return amlData;
+size_t Representation::DataToAml(const AMLObject& amlObject, bool includeModel, std::vector<char>& out) const
+{
+    size_t offset = out.size();
+    try
+    {
+        AMLVectorBuffer buffer(out);
+        m_amlModel->getXmlWriter().write(amlObject, includeModel, buffer);
     }
-
-    pugi::xml_node addInternalElement(pugi::xml_node xml_parent, const std::string suc_name)
+    catch (...)
     {
-        pugi::xml_node xml_suc = m_systemUnitClassLib.find_child_by_attribute(NAME, suc_name.c_str());
-        if (!xml_suc)
-        {
-            AML_LOG_V(ERROR, TAG, "Invalid Data : <%s> is not present in SystemUnitClassLib", suc_name.c_str());
-            throw AMLException(NOT_MATCH_TO_AML_MODEL);
-        }
+        out.resize(offset);
+        throw;
+    }
 
-        pugi::xml_node xml_ie = xml_parent.append_copy(xml_suc);
+    return out.size() - offset;
+}
 
-        // reset Name (SystemUnitClass -> InternalElement)
-        xml_ie.set_name(INTERNAL_ELEMENT);
+size_t Representation::DataToAml(const AMLObject& amlObject, bool includeModel, AMLOutputSink& sink) const
+{
+    const AMLXmlWriter& writer = m_amlModel->getXmlWriter();
 
-        // set RefBaseSystemUnitPath
-        std::string refBaseSystemUnitPath;
-        refBaseSystemUnitPath.append(m_systemUnitClassLib.attribute(NAME).value());
-        refBaseSystemUnitPath.append("/");
-        refBaseSystemUnitPath.append(suc_name);
-        xml_ie.append_attribute(REF_BASE_SYSTEM_UNIT_PATH) = refBaseSystemUnitPath.c_str();
+    // amlObject is checked before the first chunk is written.
+    // The chunk is owned by the call, so that a sink can convert again while it is written to.
+    writer.estimate(amlObject, includeModel);
 
-        // // set SupportedRoleClass
-        // xml_ie.append_copy(xml_suc.child(SUPPORTED_ROLE_CLASS));
+    AMLSinkBuffer buffer(sink);
+    writer.write(amlObject, includeModel, buffer);
+    buffer.flush();
 
-        return xml_ie;
-    }
+    return buffer.size();
+}
 
-    void setAttributeValue(pugi::xml_node xml_ie, AMLData* amlData)
+size_t Representation::estimateAmlSize(const AMLObject& amlObject, bool includeModel) const
+{
+    return m_amlModel->getXmlWriter().estimate(amlObject, includeModel);
+}
+
+size_t Representation::DataToAml(const std::vector<const AMLObject*>& amlObjects, bool includeModel, std::string& out, size_t concurrency) const
+{
+    verifyAmlObjects(amlObjects);
+
+    const AMLXmlWriter& writer = m_amlModel->getXmlWriter();
+    size_t offset = out.size();
+    try
     {
-        for (pugi::xml_node xml_attr = xml_ie.child(ATTRIBUTE); xml_attr; xml_attr = xml_attr.next_sibling(ATTRIBUTE))
-        {
-            std::string attributeName(xml_attr.attribute(NAME).value());
+        writer.writeHeader(out);
 
-            if(NULL != xml_attr.child(DESCRIPTION))
-            {
-                if(NULL == xml_attr.child(DESCRIPTION).next_sibling())
-                    ADD_VALUE(xml_attr, amlData->getValueToStr(attributeName));
-            }
-            else if (NULL == xml_attr.first_child()) // If <Attribute> does not have any child like <Value> or <RefSemantic>, it has a single string value.
+        if (1 == concurrency || 1 >= amlObjects.size())
+        {
+            for (const AMLObject* amlObject : amlObjects)
             {
-                ADD_VALUE(xml_attr, amlData->getValueToStr(attributeName));
+                writer.writeInstanceHierarchy(*amlObject, out);
             }
-            else if (IS_VALUE_TYPE_STRING_ARRAY(xml_attr))
+        }
+        else
+        {
+            // each <InstanceHierarchy> is written on its own, then they are put together in order
+            std::vector<std::string> parts(amlObjects.size());
+            AMLThreadPool::getDefault().parallelFor(amlObjects.size(), [&](size_t index)
             {
-                addStringArrayValue(xml_attr, amlData->getValueToStrArr(attributeName));
-            }
-            else if (IS_VALUE_TYPE_MAP(xml_attr))
+                writer.writeInstanceHierarchy(*amlObjects[index], parts[index]);
+            }, concurrency);
+
+            size_t size = 0;
+            for (const std::string& part : parts)
             {
-                AMLData data = amlData->getValueToAMLData(attributeName);
-                setAttributeValue(xml_attr, &data);
+                size += part.size();
             }
-            else
+            out.reserve(out.size() + size);
+
+            for (const std::string& part : parts)
             {
-                AML_LOG_V(ERROR, TAG, "Invalid AML : <%s> has value of invalid type", attributeName.c_str());
-                throw AMLException(INVALID_AML_SCHEMA);
+                out.append(part);
             }
         }
 
-        return;
+        writer.writeFooter(includeModel, out);
     }
-
-    void addStringArrayValue(pugi::xml_node xml_ie, const std::vector<std::string> valueArray)
+    catch (...)
     {
-        for (std::size_t i = 0, size = valueArray.size(); i != size; ++i)
-        {
-            pugi::xml_node xml_child_attr = xml_ie.append_child(ATTRIBUTE);
+        out.resize(offset);
+        throw;
+    }
 
-            //xml_child_attr.append_attribute(NAME) = toString(i);
-            //xml_child_attr.append_attribute(ATTRIBUTE_DATA_TYPE) = xml_ie.attribute(ATTRIBUTE_DATA_TYPE).value());
-            // Copy attributes from parent node to child node
-            for (pugi::xml_attribute_iterator attrIter = xml_ie.attributes_begin(), end = xml_ie.attributes_end(); attrIter != end; ++attrIter)
-            {
-                xml_child_attr.append_attribute(attrIter->name()) = attrIter->value();
-            }
+    return out.size() - offset;
+}
 
-            // The names of child attribute are "1", "2", "3"...
-            xml_child_attr.attribute(NAME).set_value(i + 1);
+void Representation::DataToAml(const std::vector<const AMLObject*>& amlObjects, bool includeModel, std::vector<std::string>& amls, size_t concurrency) const
+{
+    verifyAmlObjects(amlObjects);
 
-            ADD_VALUE(xml_child_attr, valueArray[i]);
-        }
+    const AMLXmlWriter& writer = m_amlModel->getXmlWriter();
+    std::vector<std::string> results(amlObjects.size());
+    AMLThreadPool::getDefault().parallelFor(amlObjects.size(), [&](size_t index)
+    {
+        writer.write(*amlObjects[index], includeModel, results[index]);
+    }, concurrency);
 
-        // As AML Document(BPR MLA, V 1.0.0), 'AttributeDataType' of the parent attribute node should be kept empty.
-        xml_ie.attribute(ATTRIBUTE_DATA_TYPE).set_value("");
-    }
-};
+    amls.swap(results);
+}
 
-Representation::Representation(const std::string amlFilePath) : m_amlModel (new AMLModel(amlFilePath))
+AMLObject* Representation::AmlToData(const std::string& xmlStr) const
 {
+    return AmlToData(xmlStr, nullptr);
 }
 
-Representation::~Representation(void)
+AMLObject* Representation::AmlToData(const std::string& xmlStr, AMLArena* arena) const
 {
-    delete m_amlModel;
+    // read AMLObject from the string in one pass without constructing XML document
+    AMLObject* amlObj = parseFromXml(m_amlModel->getSchema(), xmlStr.data(), xmlStr.size(), nullptr, arena);
+    assert(nullptr != amlObj);
+    return amlObj;
 }
 
-std::string Representation::getRepresentationId() const
+AMLObject* Representation::AmlToData(const char* xmlStr, size_t size) const
 {
-    return m_amlModel->constructModelId();
+    return AmlToData(xmlStr, size, nullptr);
 }
 
-AMLObject* Representation::getConfigInfo() const
+AMLObject* Representation::AmlToData(const char* xmlStr, size_t size, AMLArena* arena) const
 {
-    return m_amlModel->constructConfigAmlObject();
+    if (nullptr == xmlStr && 0 != size)
+    {
+        AML_LOG(ERROR, TAG, "Invalid parameter : buffer is null");
+        throw AMLException(INVALID_PARAM);
+    }
+
+    AMLObject* amlObj = parseFromXml(m_amlModel->getSchema(), xmlStr, size, nullptr, arena);
+    assert(nullptr != amlObj);
+    return amlObj;
 }
 
-std::string Representation::DataToAml(const AMLObject& amlObject) const
+AMLObject* Representation::AmlToData(const std::string& xmlStr, const AMLProjection& projection) const
 {
-    pugi::xml_document* xml_doc = m_amlModel->constructXmlDoc(amlObject);
-    assert(nullptr != xml_doc);
-
-    m_amlModel->appendModel(xml_doc);
+    return AmlToData(xmlStr, projection, nullptr);
+}
 
-    std::ostringstream stream;
-    xml_doc->save(stream);
+AMLObject* Representation::AmlToData(const std::string& xmlStr, const AMLProjection& projection, AMLArena* arena) const
+{
+    AMLObject* amlObj = parseFromXml(m_amlModel->getSchema(), xmlStr.data(), xmlStr.size(), &projection, arena);
+    assert(nullptr != amlObj);
+    return amlObj;
+}
 
-    delete xml_doc;
+void Representation::AmlToData(const std::vector<std::string>& xmlStrs, std::vector<AMLObject*>& amlObjects, std::vector<ResultCode>& results, AMLThreadPool& pool) const
+{
+    decodeBatch(xmlStrs.size(), amlObjects, results, pool, [&](size_t index)
+    {
+        return AmlToData(xmlStrs[index]);
+    });
+}
 
-    return stream.str();
+void Representation::AmlToData(const std::vector<std::string>& xmlStrs, std::vector<AMLObject*>& amlObjects, std::vector<ResultCode>& results) const
+{
+    AmlToData(xmlStrs, amlObjects, results, AMLThreadPool::getDefault());
 }
 
-AMLObject* Representation::AmlToData(const std::string& xmlStr) const
+AMLObjectView* Representation::AmlToDataView(const std::string& xmlStr) const
 {
-    pugi::xml_document dataXml;
-    pugi::xml_parse_result result = dataXml.load_string(xmlStr.c_str());
-    if (pugi::status_ok != result.status)
-    {
-        AML_LOG(ERROR, TAG, "Failed to load string : Invalid XML");
-        throw AMLException(INVALID_XML_STR);
-    }
+    return AmlToDataView(std::string(xmlStr));
+}
 
-    AMLObject *amlObj = m_amlModel->constructAmlObject(&dataXml);
-    assert(nullptr != amlObj);
-    return amlObj;
+AMLObjectView* Representation::AmlToDataView(std::string&& xmlStr) const
+{
+    return new AMLObjectView(newXmlViewSource(m_amlModel->getSchema(), std::move(xmlStr)));
 }
 
 AMLObject* Representation::ByteToData(const std::string& byte) const
+{
+    return ByteToData(byte.data(), byte.size(), nullptr);
+}
+
+AMLObject* Representation::ByteToData(const std::string& byte, AMLArena* arena) const
+{
+    return ByteToData(byte.data(), byte.size(), arena);
+}
+
+AMLObject* Representation::ByteToData(const char* byte, size_t size) const
+{
+    return ByteToData(byte, size, nullptr);
+}
+
+AMLObject* Representation::ByteToData(const char* byte, size_t size, AMLArena* arena) const
 {
 #ifdef _DISABLE_PROTOBUF_
     (void)byte;
+    (void)size;
+    (void)arena;
     AML_LOG(ERROR, TAG, "ByteToData() is not supported. ('disable_protobuf' build option is enabled)");
     throw AMLException(API_NOT_ENABLED);
 #else
-    datamodel::CAEXFile* caex = new datamodel::CAEXFile();
-
-    if (false == caex->ParseFromString(byte))
+    if (nullptr == byte && 0 != size)
     {
-        AML_LOG(ERROR, TAG, "Failed to parse from string : Invalid byte");
-        delete caex;
-        throw AMLException(INVALID_BYTE_STR);
+        AML_LOG(ERROR, TAG, "Invalid parameter : buffer is null");
+        throw AMLException(INVALID_PARAM);
     }
 
-    pugi::xml_document* xml_doc = m_amlModel->constructXmlDoc();
-    assert(nullptr != xml_doc);
-
-    // update CAEX attributes
-    pugi::xml_node xml_caex = xml_doc->child(CAEX_FILE);
-    xml_caex.attribute("FileName")                      = caex->filename().c_str();
-    xml_caex.attribute("SchemaVersion")                 = caex->schemaversion().c_str();
-    xml_caex.attribute("xsi:noNamespaceSchemaLocation") = caex->xsi().c_str();
-    xml_caex.attribute("xmlns:xsi")                     = caex->xmlns().c_str();
-
-    for (datamodel::InstanceHierarchy ih : caex->instancehierarchy())
-    {
-        pugi::xml_node xml_ih = xml_caex.append_child(INSTANCE_HIERARCHY);
-        VERIFY_NON_NULL_THROW_EXCEPTION(xml_ih);
-
-        xml_ih.append_attribute(NAME) = ih.name().c_str();
+    // read AMLObject from AML proto bytes directly without constructing AML(XML) document
+    AMLObject* amlObj = parseFromProto(m_amlModel->getSchema(), byte, size, nullptr, arena);
+    assert(nullptr != amlObj);
 
-        extractProtoInternalElement(xml_ih, &ih);
-    }
+    return amlObj;
+#endif // _DISABLE_PROTOBUF_
+}
 
-    caex->clear_instancehierarchy();
-    delete caex;
+AMLObject* Representation::ByteToData(const std::string& byte, const AMLProjection& projection) const
+{
+    return ByteToData(byte, projection, nullptr);
+}
 
-    AMLObject* amlObj = m_amlModel->constructAmlObject(xml_doc);
+AMLObject* Representation::ByteToData(const std::string& byte, const AMLProjection& projection, AMLArena* arena) const
+{
+#ifdef _DISABLE_PROTOBUF_
+    (void)byte;
+    (void)projection;
+    (void)arena;
+    AML_LOG(ERROR, TAG, "ByteToData() is not supported. ('disable_protobuf' build option is enabled)");
+    throw AMLException(API_NOT_ENABLED);
+#else
+    AMLObject* amlObj = parseFromProto(m_amlModel->getSchema(), byte.data(), byte.size(), &projection, arena);
     assert(nullptr != amlObj);
 
-    delete xml_doc;
-
     return amlObj;
 #endif // _DISABLE_PROTOBUF_
 }
 
-std::string Representation::DataToByte(const AMLObject& amlObject) const
+void Representation::ByteToData(const std::vector<std::string>& bytes, std::vector<AMLObject*>& amlObjects, std::vector<ResultCode>& results, AMLThreadPool& pool) const
 {
 #ifdef _DISABLE_PROTOBUF_
-    (void)amlObject;
-    AML_LOG(ERROR, TAG, "DataToByte() is not supported. ('disable_protobuf' build option is enabled)");
+    (void)bytes;
+    (void)amlObjects;
+    (void)results;
+    (void)pool;
+    AML_LOG(ERROR, TAG, "ByteToData() is not supported. ('disable_protobuf' build option is enabled)");
     throw AMLException(API_NOT_ENABLED);
 #else
-    // convert AMLObject to XML object
-    pugi::xml_document* xml_doc = m_amlModel->constructXmlDoc(amlObject);
-    assert(nullptr != xml_doc);
-
-    // convert XML object to AML proto object
-    pugi::xml_node xml_caex = xml_doc->child(CAEX_FILE);
-    
-    datamodel::CAEXFile* caex = new datamodel::CAEXFile();
-
-    caex->set_filename(xml_caex.attribute("FileName").value());
-    caex->set_schemaversion(xml_caex.attribute("SchemaVersion").value());
-    caex->set_xsi(xml_caex.attribute("xsi:noNamespaceSchemaLocation").value());
-    caex->set_xmlns(xml_caex.attribute("xmlns:xsi").value());
-
-    for (pugi::xml_node xml_ih = xml_caex.child(INSTANCE_HIERARCHY); xml_ih; xml_ih = xml_ih.next_sibling(INSTANCE_HIERARCHY))
+    decodeBatch(bytes.size(), amlObjects, results, pool, [&](size_t index)
     {
-        datamodel::InstanceHierarchy* ih = caex->add_instancehierarchy();
+        return ByteToData(bytes[index]);
+    });
+#endif // _DISABLE_PROTOBUF_
+}
 
-        ih->set_name    (xml_ih.attribute(NAME).value());
-      //ih->set_version (xml_ih.child_value(VERSION)); // @TODO: required?
+void Representation::ByteToData(const std::vector<std::string>& bytes, std::vector<AMLObject*>& amlObjects, std::vector<ResultCode>& results) const
+{
+    ByteToData(bytes, amlObjects, results, AMLThreadPool::getDefault());
+}
 
-        extractInternalElement<datamodel::InstanceHierarchy>(ih, xml_ih);
-    }
+AMLObjectView* Representation::ByteToDataView(const std::string& byte) const
+{
+    return ByteToDataView(std::string(byte));
+}
 
-    delete xml_doc;
+AMLObjectView* Representation::ByteToDataView(std::string&& byte) const
+{
+#ifdef _DISABLE_PROTOBUF_
+    (void)byte;
+    AML_LOG(ERROR, TAG, "ByteToDataView() is not supported. ('disable_protobuf' build option is enabled)");
+    throw AMLException(API_NOT_ENABLED);
+#else
+    return new AMLObjectView(newProtoViewSource(m_amlModel->getSchema(), std::move(byte)));
+#endif // _DISABLE_PROTOBUF_
+}
 
+std::string Representation::DataToByte(const AMLObject& amlObject, ByteLayout layout) const
+{
+#ifdef _DISABLE_PROTOBUF_
+    (void)amlObject;
+    (void)layout;
+    AML_LOG(ERROR, TAG, "DataToByte() is not supported. ('disable_protobuf' build option is enabled)");
+    throw AMLException(API_NOT_ENABLED);
+#else
     std::string binary;
-    bool isSuccess = caex->SerializeToString(&binary);
+    DataToByte(amlObject, binary, layout);
 
-    caex->clear_instancehierarchy();
-    delete caex;
-
-    if (false == isSuccess)
-    {
-        throw AMLException(SERIALIZE_FAIL);
-    }
     return binary;
 #endif // _DISABLE_PROTOBUF_
 }
 
-#ifndef _DISABLE_PROTOBUF_
-template <typename T>
-static void extractProtoAttribute(pugi::xml_node xmlNode, T* attr)
+size_t Representation::DataToByte(const AMLObject& amlObject, std::string& out, ByteLayout layout) const
 {
-    for (datamodel::Attribute att : attr->attribute())
-    {
-        pugi::xml_node xml_attr = xmlNode.append_child(ATTRIBUTE);
-        VERIFY_NON_NULL_THROW_EXCEPTION(xml_attr);
-
-        xml_attr.append_attribute(NAME) = att.name().c_str();
-        xml_attr.append_attribute(ATTRIBUTE_DATA_TYPE) = att.attributedatatype().c_str();
-
-        extractProtoAttribute(xml_attr, &att);
-
-        if (att.has_value())
-        {
-            xml_attr.append_child(VALUE).text().set(att.value().c_str());
-        }
-        if (att.has_refsemantic())
-        {
-            pugi::xml_node xml_refsemantic = xml_attr.append_child(REF_SEMANTIC);
-            xml_refsemantic.append_attribute(CORRESPONDING_ATTRIBUTE_PATH) = att.refsemantic().correspondingattributepath().c_str();
-        }
-    }
-
-    return;
+#ifdef _DISABLE_PROTOBUF_
+    (void)amlObject;
+    (void)out;
+    (void)layout;
+    AML_LOG(ERROR, TAG, "DataToByte() is not supported. ('disable_protobuf' build option is enabled)");
+    throw AMLException(API_NOT_ENABLED);
+#else
+    // convert AMLObject to AML proto bytes directly from the compiled model
+    return serializeToProto(m_amlModel->getSchema(), amlObject, layout, out);
+#endif // _DISABLE_PROTOBUF_
 }
 
-template <typename T>
-static void extractProtoInternalElement(pugi::xml_node xmlNode, T* ie)
+size_t Representation::DataToByte(const AMLObject& amlObject, std::vector<char>& out, ByteLayout layout) const
 {
-    for (datamodel::InternalElement sie : ie->internalelement())
-    {
-        pugi::xml_node xml_ie = xmlNode.append_child(INTERNAL_ELEMENT);
-        VERIFY_NON_NULL_THROW_EXCEPTION(xml_ie);
+#ifdef _DISABLE_PROTOBUF_
+    (void)amlObject;
+    (void)out;
+    (void)layout;
+    AML_LOG(ERROR, TAG, "DataToByte() is not supported. ('disable_protobuf' build option is enabled)");
+    throw AMLException(API_NOT_ENABLED);
+#else
+    return serializeToProto(m_amlModel->getSchema(), amlObject, layout, out);
+#endif // _DISABLE_PROTOBUF_
+}
 
-        xml_ie.append_attribute(NAME) = sie.name().c_str();
-        xml_ie.append_attribute(REF_BASE_SYSTEM_UNIT_PATH) = sie.refbasesystemunitpath().c_str();
+size_t Representation::DataToByte(const AMLObject& amlObject, AMLOutputSink& sink, ByteLayout layout) const
+{
+#ifdef _DISABLE_PROTOBUF_
+    (void)amlObject;
+    (void)sink;
+    (void)layout;
+    AML_LOG(ERROR, TAG, "DataToByte() is not supported. ('disable_protobuf' build option is enabled)");
+    throw AMLException(API_NOT_ENABLED);
+#else
+    return serializeToProto(m_amlModel->getSchema(), amlObject, layout, sink);
+#endif // _DISABLE_PROTOBUF_
+}
 
-        extractProtoAttribute(xml_ie, &sie);
-        extractProtoInternalElement(xml_ie, &sie);
+size_t Representation::estimateByteSize(const AMLObject& amlObject, ByteLayout layout) const
+{
+#ifdef _DISABLE_PROTOBUF_
+    (void)amlObject;
+    (void)layout;
+    AML_LOG(ERROR, TAG, "estimateByteSize() is not supported. ('disable_protobuf' build option is enabled)");
+    throw AMLException(API_NOT_ENABLED);
+#else
+    return measureProto(m_amlModel->getSchema(), amlObject, layout);
+#endif // _DISABLE_PROTOBUF_
+}
 
-        if (nullptr != &sie.supportedroleclass() && 
-            nullptr != &sie.supportedroleclass().refroleclasspath())
-        {
-            pugi::xml_node xml_src = xml_ie.append_child(SUPPORTED_ROLE_CLASS);
-            VERIFY_NON_NULL_THROW_EXCEPTION(xml_src);
+void Representation::DataToByte(const std::vector<const AMLObject*>& amlObjects, std::vector<std::string>& bytes, size_t concurrency,
+                                ByteLayout layout) const
+{
+#ifdef _DISABLE_PROTOBUF_
+    (void)amlObjects;
+    (void)bytes;
+    (void)concurrency;
+    (void)layout;
+    AML_LOG(ERROR, TAG, "DataToByte() is not supported. ('disable_protobuf' build option is enabled)");
+    throw AMLException(API_NOT_ENABLED);
+#else
+    verifyAmlObjects(amlObjects);
 
-            xml_src.append_attribute(REF_ROLE_CLASS_PATH) = sie.supportedroleclass().refroleclasspath().c_str();
-        }
-    }
+    const AMLSchema& schema = m_amlModel->getSchema();
+    std::vector<std::string> results(amlObjects.size());
+    AMLThreadPool::getDefault().parallelFor(amlObjects.size(), [&](size_t index)
+    {
+        serializeToProto(schema, *amlObjects[index], layout, results[index]);
+    }, concurrency);
 
-    return;
+    bytes.swap(results);
+#endif // _DISABLE_PROTOBUF_
 }
 
-template <typename T>
-static void extractAttribute(T* attr, pugi::xml_node xmlNode)
+std::string Representation::DataToCompactByte(const AMLObject& amlObject) const
 {
-    for (pugi::xml_node xmlAttr = xmlNode.child(ATTRIBUTE); xmlAttr; xmlAttr = xmlAttr.next_sibling(ATTRIBUTE))
-    {
-        datamodel::Attribute* attr_child = attr->add_attribute();
-
-        attr_child->set_name              (xmlAttr.attribute(NAME).value());
-        attr_child->set_attributedatatype (xmlAttr.attribute(ATTRIBUTE_DATA_TYPE).value());
-        //attr->set_description       (xmlAttr.child_value(DESCRIPTION)); //@TODO: required?
+    std::string binary;
+    DataToCompactByte(amlObject, binary);
 
-        extractAttribute<datamodel::Attribute>(attr_child, xmlAttr);
+    return binary;
+}
 
-        pugi::xml_node xmlValue = xmlAttr.child(VALUE);
-        if (NULL != xmlValue)
-        {
-            attr_child->set_value(xmlValue.text().as_string());
-        }
+size_t Representation::DataToCompactByte(const AMLObject& amlObject, std::string& out) const
+{
+    return serializeToCompact(m_amlModel->getSchema(), m_amlModel->getCompactHash(), amlObject, out);
+}
 
-        pugi::xml_node xmlRefSemantic = xmlAttr.child(REF_SEMANTIC);
-        if (NULL != xmlRefSemantic)
-        {
-            datamodel::RefSemantic* refSemantic = new datamodel::RefSemantic();
-            refSemantic->set_correspondingattributepath(xmlRefSemantic.attribute(CORRESPONDING_ATTRIBUTE_PATH).value());
-            attr_child->set_allocated_refsemantic(refSemantic);
-        }
-    }
+AMLObject* Representation::CompactByteToData(const std::string& byte) const
+{
+    return CompactByteToData(byte.data(), byte.size(), nullptr);
+}
 
-    return;
+AMLObject* Representation::CompactByteToData(const char* byte, size_t size) const
+{
+    return CompactByteToData(byte, size, nullptr);
 }
 
-template <typename T>
-static void extractInternalElement(T* ie, pugi::xml_node xmlNode)
+AMLObject* Representation::CompactByteToData(const char* byte, size_t size, AMLArena* arena) const
 {
-    for (pugi::xml_node xmlIe = xmlNode.child(INTERNAL_ELEMENT); xmlIe; xmlIe = xmlIe.next_sibling(INTERNAL_ELEMENT))    
+    if (nullptr == byte)
     {
-        datamodel::InternalElement* ie_child = ie->add_internalelement();
-
-        ie_child->set_name                    (xmlIe.attribute(NAME).value());
-        ie_child->set_refbasesystemunitpath   (xmlIe.attribute(REF_BASE_SYSTEM_UNIT_PATH).value());
-        
-        extractAttribute<datamodel::InternalElement>(ie_child, xmlIe);
-        extractInternalElement<datamodel::InternalElement>(ie_child, xmlIe);
-
-        pugi::xml_node xmlSrc = xmlIe.child(SUPPORTED_ROLE_CLASS);
-        if (NULL != xmlSrc)
-        {
-            datamodel::SupportedRoleClass* src = new datamodel::SupportedRoleClass();
-            src->set_refroleclasspath(xmlSrc.attribute(REF_ROLE_CLASS_PATH).value());
-
-            ie_child->set_allocated_supportedroleclass(src);
-        }
+        AML_LOG(ERROR, TAG, "Invalid parameter : buffer is null");
+        throw AMLException(INVALID_PARAM);
     }
 
-    return;
+    return parseFromCompact(m_amlModel->getSchema(), m_amlModel->getCompactHash(), byte, size, arena);
 }
-#endif // _DISABLE_PROTOBUF_
@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+
+#include "RepresentationRegistry.h"
+#include "AMLMappedFile.h"
+#include "AMLHasher.h"
+#include "AMLException.h"
+#include "AMLLogger.h"
+
+#define TAG "RepresentationRegistry"
+
+using namespace std;
+using namespace AML;
+
+static uint64_t hashContents(AMLMappedFile& file)
+{
+    AMLHasher hasher;
+    hasher.addBytes(file.data(), file.size());
+    return hasher.hash();
+}
+
+namespace
+{
+
+struct Entry
+{
+    std::string                             stamp;      // of the file, which is checked before the contents are hashed
+    uint64_t                                hash;
+    uint64_t                                sequence;   // order of registration, for find()
+    std::shared_ptr<const Representation>   representation;
+};
+
+} // namespace
+
+class RepresentationRegistry::Impl
+{
+public:
+    Impl() : m_sequence(0)
+    {
+    }
+
+    mutable std::mutex                      m_mutex;
+    std::map<std::string, Entry>            m_entries;  // by the path of the file
+    uint64_t                                m_sequence;
+};
+
+RepresentationRegistry::RepresentationRegistry(void) : m_impl(new Impl())
+{
+}
+
+RepresentationRegistry::~RepresentationRegistry(void)
+{
+    delete m_impl;
+}
+
+std::shared_ptr<const Representation> RepresentationRegistry::acquire(const std::string& amlFilePath)
+{
+    // the model is compiled from the same mapping which is stamped and hashed, so that the entry always matches them.
+    // No page of the mapping is read if the stamp has not changed.
+    AMLMappedFile file(amlFilePath);
+    const std::string& stamp = file.stamp();
+
+    {
+        std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+        auto iter = m_impl->m_entries.find(amlFilePath);
+        if (iter != m_impl->m_entries.end() && false == stamp.empty() && iter->second.stamp == stamp)
+        {
+            return iter->second.representation;
+        }
+    }
+
+    // the file is touched or modified, so the contents tell whether it is loaded again
+    uint64_t hash = hashContents(file);
+    {
+        std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+        auto iter = m_impl->m_entries.find(amlFilePath);
+        if (iter != m_impl->m_entries.end() && iter->second.hash == hash)
+        {
+            iter->second.stamp = stamp;
+            return iter->second.representation;
+        }
+    }
+
+    // loaded without the lock, so that different files are loaded at the same time.
+    // The model is shared with Representation(amlFilePath) of the same version of the file.
+    std::shared_ptr<const Representation> representation(new Representation(file, amlFilePath));
+
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    Entry& entry = m_impl->m_entries[amlFilePath];
+    if (entry.representation && entry.hash == hash)
+    {
+        // registered by another thread meanwhile
+        entry.stamp = stamp;
+        return entry.representation;
+    }
+    entry.stamp = stamp;
+    entry.hash = hash;
+    entry.sequence = ++m_impl->m_sequence;
+    entry.representation = representation;
+
+    return representation;
+}
+
+std::shared_ptr<const Representation> RepresentationRegistry::find(const std::string& representationId) const
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    const Entry* found = nullptr;
+    for (const auto& iter : m_impl->m_entries)
+    {
+        const Entry& entry = iter.second;
+        if (entry.representation->getRepresentationId() == representationId &&
+            (nullptr == found || found->sequence < entry.sequence))
+        {
+            found = &entry;
+        }
+    }
+    return (nullptr == found) ? nullptr : found->representation;
+}
+
+size_t RepresentationRegistry::getUseCount(const std::string& representationId) const
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    size_t count = 0;
+    for (const auto& iter : m_impl->m_entries)
+    {
+        const Entry& entry = iter.second;
+        if (entry.representation->getRepresentationId() == representationId)
+        {
+            // except the one of the registry
+            count += static_cast<size_t>(entry.representation.use_count() - 1);
+        }
+    }
+    return count;
+}
+
+bool RepresentationRegistry::evict(const std::string& representationId)
+{
+    std::vector<std::shared_ptr<const Representation>> evicted;     // released after unlock
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    for (auto iter = m_impl->m_entries.begin(); iter != m_impl->m_entries.end(); )
+    {
+        if (iter->second.representation->getRepresentationId() == representationId)
+        {
+            evicted.push_back(iter->second.representation);
+            iter = m_impl->m_entries.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+    return false == evicted.empty();
+}
+
+size_t RepresentationRegistry::evictUnused(void)
+{
+    std::vector<std::shared_ptr<const Representation>> evicted;
+    std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+    for (auto iter = m_impl->m_entries.begin(); iter != m_impl->m_entries.end(); )
+    {
+        if (1 == iter->second.representation.use_count())
+        {
+            evicted.push_back(iter->second.representation);
+            iter = m_impl->m_entries.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+    return evicted.size();
+}
+
+std::vector<std::string> RepresentationRegistry::getRepresentationIds(void) const
+{
+    std::set<std::string> ids;
+    {
+        std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+        for (const auto& iter : m_impl->m_entries)
+        {
+            ids.insert(iter.second.representation->getRepresentationId());
+        }
+    }
+    return std::vector<std::string>(ids.begin(), ids.end());
+}
+
+RepresentationRegistry& RepresentationRegistry::getDefault(void)
+{
+    // never destroyed, as the consumers may use it after the static objects are destroyed
+    static RepresentationRegistry* registry = new RepresentationRegistry();
+    return *registry;
+}
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+// Compiles AML model file into the binary image which Representation loads without parsing XML.
+//
+//   aml_compiler <AML model file> <output file>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "Representation.h"
+#include "AMLException.h"
+
+using namespace std;
+using namespace AML;
+
+int main(int argc, char* argv[])
+{
+    if (3 != argc)
+    {
+        cerr << "Usage: " << argv[0] << " <AML model file> <output file>" << endl;
+        return 2;
+    }
+
+    string amlFilePath(argv[1]);
+    string outputPath(argv[2]);
+
+    try
+    {
+        Representation rep(amlFilePath);
+        string image = rep.getCompiledModel();
+
+        // the image should be loaded back into the same model
+        Representation compiled(image.data(), image.size());
+        if (compiled.getRepresentationId() != rep.getRepresentationId() || compiled.getCompiledModel() != image)
+        {
+            cerr << "Failed to verify the compiled model of " << amlFilePath << endl;
+            return 1;
+        }
+
+        ofstream output(outputPath.c_str(), ios::binary | ios::trunc);
+        output.write(image.data(), image.size());
+        output.close();
+        if (false == output.good())
+        {
+            cerr << "Failed to write " << outputPath << endl;
+            return 1;
+        }
+
+        cout << rep.getRepresentationId() << " : " << amlFilePath << " -> " << outputPath << " (" << image.size() << " bytes)" << endl;
+    }
+    catch (const AMLException& e)
+    {
+        cerr << "Failed to compile " << amlFilePath << " : " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
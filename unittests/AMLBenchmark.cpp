@@ -0,0 +1,809 @@
+/*******************************************************************************
+ * Copyright 2018 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *******************************************************************************/
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdio>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include "Representation.h"
+#include "RepresentationRegistry.h"
+#include "AMLInterface.h"
+#include "AMLException.h"
+
+#ifndef _DISABLE_PROTOBUF_
+#include "AML.pb.h"
+#endif
+
+using namespace std;
+using namespace AML;
+
+namespace AMLBenchmark
+{
+    std::string amlModelFile    = "./TEST_DataModel.aml";
+    std::string dataBinaryFile  = "./TEST_DataBinary";
+
+    // Helper method
+    AMLObject TestAMLObject(size_t sizeOfAppendix)
+    {
+        AMLObject amlObj("SAMPLE001", "123456789");
+
+        AMLData model;
+        model.setValue("a", "Model_107.113.97.248");
+        model.setValue("b", "SR-P7-970");
+
+        AMLData axis;
+        axis.setValue("x", "20");
+        axis.setValue("y", "110");
+        axis.setValue("z", "80");
+
+        AMLData info;
+        info.setValue("id", "f437da3b");
+        info.setValue("axis", axis);
+
+        vector<string> appendix;
+        for (size_t i = 0; i < sizeOfAppendix; ++i)
+        {
+            appendix.push_back(std::to_string(52303 + i));
+        }
+
+        AMLData sample;
+        sample.setValue("info", info);
+        sample.setValue("appendix", appendix);
+
+        amlObj.addData("Model", model);
+        amlObj.addData("Sample", sample);
+
+        return amlObj;
+    }
+
+    std::string TestBinary()
+    {
+        std::ifstream t(dataBinaryFile);
+        std::string str((std::istreambuf_iterator<char>(t)), std::istreambuf_iterator<char>());
+        return str;
+    }
+
+    // Runs fn for at least 'minTime' and returns the average time of a call in microseconds.
+    double measure(const std::function<void()>& fn)
+    {
+        const std::chrono::milliseconds minTime(200);
+
+        fn(); // warm up
+
+        size_t iterations = 0;
+        auto start = std::chrono::steady_clock::now();
+        auto elapsed = std::chrono::steady_clock::duration::zero();
+        do
+        {
+            fn();
+            ++iterations;
+            elapsed = std::chrono::steady_clock::now() - start;
+        } while (elapsed < minTime);
+
+        return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+    }
+
+    void report(const std::string& name, const std::string& payload, double usec)
+    {
+        cout << left << setw(40) << name << setw(24) << payload << right << setw(14) << fixed << setprecision(3) << usec << " us" << endl;
+    }
+
+    // Keys are added in a shuffled order, as they are not sorted in AML documents either.
+    std::vector<std::string> TestKeys(size_t sizeOfKeys)
+    {
+        std::vector<std::string> keys;
+        for (size_t i = 0; i < sizeOfKeys; ++i)
+        {
+            keys.push_back("attribute_" + std::to_string((i * 7) % sizeOfKeys));
+        }
+        return keys;
+    }
+
+    AMLData TestAMLData(const std::vector<std::string>& keys)
+    {
+        AMLData amlData;
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            if (i % 5 == 4)
+            {
+                AMLData nested;
+                nested.setValue("x", "20");
+                nested.setValue("y", "110");
+                amlData.setValue(keys[i], nested);
+            }
+            else
+            {
+                amlData.setValue(keys[i], "value_" + std::to_string(i));
+            }
+        }
+        return amlData;
+    }
+
+    void benchAMLData(const std::string& payload, size_t sizeOfKeys)
+    {
+        std::vector<std::string> keys = TestKeys(sizeOfKeys);
+        AMLData amlData = TestAMLData(keys);
+
+        report("AMLData build", payload, measure([&]()
+        {
+            TestAMLData(keys);
+        }));
+
+        // all keys are looked up once per call
+        report("AMLData lookup", payload, measure([&]()
+        {
+            size_t found = 0;
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                found += (AMLValueType::String == amlData.getValueType(keys[i])) ? amlData.getValueToStr(keys[i]).size() : 1;
+            }
+            if (0 == found)
+            {
+                cout << "unexpected" << endl;
+            }
+        }));
+
+        std::vector<AMLSymbol> symbols;
+        for (const std::string& key : keys)
+        {
+            symbols.push_back(AMLSymbol::lookup(key));
+        }
+        report("AMLData lookup (symbol)", payload, measure([&]()
+        {
+            size_t found = 0;
+            for (size_t i = 0; i < symbols.size(); ++i)
+            {
+                found += (AMLValueType::String == amlData.getValueType(symbols[i])) ? amlData.getValueToStr(symbols[i]).size() : 1;
+            }
+            if (0 == found)
+            {
+                cout << "unexpected" << endl;
+            }
+        }));
+
+        report("AMLData copy", payload, measure([&]()
+        {
+            AMLData copied(amlData);
+        }));
+    }
+
+    void benchDataToAml(const Representation& rep, const std::string& payload, const AMLObject& amlObj)
+    {
+        report("DataToAml", payload, measure([&]()
+        {
+            rep.DataToAml(amlObj);
+        }));
+
+        report("DataToAml (data-only)", payload, measure([&]()
+        {
+            rep.DataToAml(amlObj, false);
+        }));
+
+        std::string buffer;
+        report("DataToAml (reused buffer)", payload, measure([&]()
+        {
+            buffer.clear();
+            rep.DataToAml(amlObj, true, buffer);
+        }));
+    }
+
+    // A batch of 'sizeOfBatch' AMLObjects, compared with as many single calls.
+    void benchBatch(const Representation& rep, const std::string& payload, const AMLObject& amlObj, size_t sizeOfBatch)
+    {
+        std::vector<const AMLObject*> amlObjs(sizeOfBatch, &amlObj);
+
+        report("DataToAml x" + std::to_string(sizeOfBatch), payload, measure([&]()
+        {
+            for (const AMLObject* obj : amlObjs)
+            {
+                rep.DataToAml(*obj, false);
+            }
+        }));
+
+        for (size_t concurrency : {1, 0})
+        {
+            std::string suffix = (0 == concurrency) ? " (all cores)" : "";
+
+            std::string buffer;
+            report("DataToAml batch document" + suffix, payload, measure([&]()
+            {
+                buffer.clear();
+                rep.DataToAml(amlObjs, false, buffer, concurrency);
+            }));
+
+            std::vector<std::string> amls;
+            report("DataToAml batch" + suffix, payload, measure([&]()
+            {
+                rep.DataToAml(amlObjs, false, amls, concurrency);
+            }));
+
+#ifndef _DISABLE_PROTOBUF_
+            std::vector<std::string> bytes;
+            report("DataToByte batch" + suffix, payload, measure([&]()
+            {
+                rep.DataToByte(amlObjs, bytes, concurrency);
+            }));
+#endif
+        }
+    }
+
+    // Decoding a backlog of 'sizeOfBatch' payloads, one by one and on the default pool.
+    void benchBatchDecode(const Representation& rep, const std::string& payload, const AMLObject& amlObj, size_t sizeOfBatch)
+    {
+        std::vector<std::string> amls(sizeOfBatch, rep.DataToAml(amlObj, false));
+        std::vector<AMLObject*> amlObjs;
+        std::vector<ResultCode> results;
+
+        report("AmlToData x" + std::to_string(sizeOfBatch), payload, measure([&]()
+        {
+            for (const std::string& aml : amls)
+            {
+                delete rep.AmlToData(aml);
+            }
+        }));
+
+        report("AmlToData batch (all cores)", payload, measure([&]()
+        {
+            rep.AmlToData(amls, amlObjs, results);
+            for (AMLObject* obj : amlObjs)
+            {
+                delete obj;
+            }
+        }));
+
+#ifndef _DISABLE_PROTOBUF_
+        std::vector<std::string> bytes(sizeOfBatch, rep.DataToByte(amlObj));
+
+        report("ByteToData x" + std::to_string(sizeOfBatch), payload, measure([&]()
+        {
+            for (const std::string& byte : bytes)
+            {
+                delete rep.ByteToData(byte);
+            }
+        }));
+
+        report("ByteToData batch (all cores)", payload, measure([&]()
+        {
+            rep.ByteToData(bytes, amlObjs, results);
+            for (AMLObject* obj : amlObjs)
+            {
+                delete obj;
+            }
+        }));
+#endif
+    }
+
+    // Many threads share one Representation. The result is the time of a round trip divided by the number of round trips,
+    // so it goes down as the threads scale.
+    void benchConcurrentUse(const Representation& rep, const std::string& payload, const AMLObject& amlObj)
+    {
+        const size_t sizeOfIterations = 50;
+
+        for (size_t sizeOfThreads : {1, 2, 4, 8})
+        {
+            double usec = measure([&]()
+            {
+                std::vector<std::thread> threads;
+                for (size_t t = 0; t < sizeOfThreads; ++t)
+                {
+                    threads.push_back(std::thread([&]()
+                    {
+                        for (size_t i = 0; i < sizeOfIterations; ++i)
+                        {
+                            delete rep.AmlToData(rep.DataToAml(amlObj, false));
+                        }
+                    }));
+                }
+
+                for (std::thread& thread : threads)
+                {
+                    thread.join();
+                }
+            });
+
+            report("DataToAml + AmlToData, " + std::to_string(sizeOfThreads) + " threads", payload, usec / (sizeOfThreads * sizeOfIterations));
+        }
+    }
+
+    void benchAmlToData(const Representation& rep, const std::string& payload, const AMLObject& amlObj)
+    {
+        std::string aml = rep.DataToAml(amlObj);
+
+        report("AmlToData", payload, measure([&]()
+        {
+            delete rep.AmlToData(aml);
+        }));
+
+        report("AmlToData (buffer)", payload, measure([&]()
+        {
+            delete rep.AmlToData(aml.data(), aml.size());
+        }));
+    }
+
+    // A consumer which reads one value of the small data, while the large one is not needed.
+    void benchDataView(const Representation& rep, const std::string& payload, const AMLObject& amlObj)
+    {
+        std::string aml = rep.DataToAml(amlObj);
+
+        report("AmlToData + getData(Model)", payload, measure([&]()
+        {
+            std::unique_ptr<AMLObject> obj(rep.AmlToData(aml));
+            obj->getData("Model").getValueToStr("b");
+        }));
+
+        report("AmlToDataView + getData(Model)", payload, measure([&]()
+        {
+            std::unique_ptr<AMLObjectView> view(rep.AmlToDataView(aml));
+            view->getData("Model").getValueToStr("b");
+        }));
+
+#ifndef _DISABLE_PROTOBUF_
+        std::string binary = rep.DataToByte(amlObj);
+
+        report("ByteToData + getData(Model)", payload, measure([&]()
+        {
+            std::unique_ptr<AMLObject> obj(rep.ByteToData(binary));
+            obj->getData("Model").getValueToStr("b");
+        }));
+
+        report("ByteToDataView + getData(Model)", payload, measure([&]()
+        {
+            std::unique_ptr<AMLObjectView> view(rep.ByteToDataView(binary));
+            view->getData("Model").getValueToStr("b");
+        }));
+#endif
+    }
+
+    // A consumer which needs only a subset of the data, e.g. the axis of the sample.
+    void benchProjection(const Representation& rep, const std::string& payload, const AMLObject& amlObj)
+    {
+        std::string aml = rep.DataToAml(amlObj);
+        AMLProjection projection(std::vector<std::string>{"Model", "Sample/info/axis"});
+
+        report("AmlToData (projection)", payload, measure([&]()
+        {
+            delete rep.AmlToData(aml, projection);
+        }));
+
+#ifndef _DISABLE_PROTOBUF_
+        std::string binary = rep.DataToByte(amlObj);
+
+        report("ByteToData (projection)", payload, measure([&]()
+        {
+            delete rep.ByteToData(binary, projection);
+        }));
+#endif
+    }
+
+    // Construction of a Representation, which loads the model file unless another Representation of the file is alive.
+    void benchConstruct()
+    {
+        report("Representation (load)", amlModelFile, measure([&]()
+        {
+            Representation rep(amlModelFile);
+        }));
+
+        Representation loaded(amlModelFile);
+        report("Representation (shared)", amlModelFile, measure([&]()
+        {
+            Representation rep(amlModelFile);
+        }));
+
+        std::ifstream t(amlModelFile);
+        std::string model((std::istreambuf_iterator<char>(t)), std::istreambuf_iterator<char>());
+        report("Representation (buffer)", amlModelFile, measure([&]()
+        {
+            Representation rep(model.data(), model.size());
+        }));
+
+        const std::string compiledFile = "./TEST_DataModel.amlc";
+        std::string image = loaded.getCompiledModel();
+        std::ofstream(compiledFile, std::ios::binary | std::ios::trunc) << image;
+        report("Representation (compiled load)", compiledFile, measure([&]()
+        {
+            Representation rep(compiledFile);
+        }));
+        report("Representation (compiled buffer)", compiledFile, measure([&]()
+        {
+            Representation rep(image.data(), image.size());
+        }));
+        std::remove(compiledFile.c_str());
+
+        RepresentationRegistry registry;
+        registry.acquire(amlModelFile);
+        report("RepresentationRegistry (acquire)", amlModelFile, measure([&]()
+        {
+            std::shared_ptr<const Representation> rep = registry.acquire(amlModelFile);
+        }));
+    }
+
+    // Decode-and-discard : every AMLObject is destroyed right after it is decoded.
+    void benchArena(const Representation& rep, const std::string& payload, const AMLObject& amlObj)
+    {
+        std::string aml = rep.DataToAml(amlObj);
+        AMLArena arena;
+
+        report("AmlToData (arena)", payload, measure([&]()
+        {
+            delete rep.AmlToData(aml, &arena);
+            arena.reset();
+        }));
+
+#ifndef _DISABLE_PROTOBUF_
+        std::string binary = rep.DataToByte(amlObj);
+
+        report("ByteToData (heap)", payload, measure([&]()
+        {
+            delete rep.ByteToData(binary);
+        }));
+
+        report("ByteToData (arena)", payload, measure([&]()
+        {
+            delete rep.ByteToData(binary, &arena);
+            arena.reset();
+        }));
+#endif
+    }
+
+#ifndef _DISABLE_PROTOBUF_
+    void benchDataToByte(const Representation& rep, const std::string& payload, const AMLObject& amlObj)
+    {
+        report("DataToByte", payload, measure([&]()
+        {
+            rep.DataToByte(amlObj);
+        }));
+
+        std::string buffer;
+        report("DataToByte (reused buffer)", payload, measure([&]()
+        {
+            buffer.clear();
+            rep.DataToByte(amlObj, buffer);
+        }));
+    }
+#endif
+
+#ifndef _DISABLE_PROTOBUF_
+    // An ordered list of strings in the standard layout (an 'Attribute' message for each element) and in the compact layout.
+    void benchByteLayout(const Representation& rep, const std::string& payload, const AMLObject& amlObj)
+    {
+        for (ByteLayout layout : {ByteLayout::Standard, ByteLayout::Compact})
+        {
+            std::string binary = rep.DataToByte(amlObj, layout);
+            std::string name = std::string((ByteLayout::Compact == layout) ? "compact" : "standard") + ", " + payload;
+            cout << left << setw(40) << "Byte size (" + name + ")" << right << setw(38) << binary.size() << " bytes" << endl;
+
+            std::string buffer;
+            report("DataToByte (reused buffer)", name, measure([&]()
+            {
+                buffer.clear();
+                rep.DataToByte(amlObj, buffer, layout);
+            }));
+            report("ByteToData", name, measure([&]()
+            {
+                delete rep.ByteToData(binary);
+            }));
+        }
+    }
+#endif
+
+#ifndef _DISABLE_PROTOBUF_
+    // ByteToData() reads AMLObject from proto bytes directly.
+    // The previous implementation parsed 'datamodel::CAEXFile', rebuilt AML(XML) document from it and converted the document,
+    // so parsing the message plus AmlToData() of the same data is its lower bound.
+    void benchByteToData(const Representation& rep, const std::string& payload, const std::string& binary)
+    {
+        std::string aml = rep.DataToAml(*std::unique_ptr<AMLObject>(rep.ByteToData(binary)));
+
+        report("ByteToData", payload, measure([&]()
+        {
+            delete rep.ByteToData(binary);
+        }));
+
+        report("CAEXFile::ParseFromString", payload, measure([&]()
+        {
+            datamodel::CAEXFile caex;
+            caex.ParseFromString(binary);
+        }));
+
+        report("CAEXFile::ParseFromString + AmlToData", payload, measure([&]()
+        {
+            datamodel::CAEXFile caex;
+            caex.ParseFromString(binary);
+            delete rep.AmlToData(aml);
+        }));
+    }
+
+    // Sensor values sent as numbers, compared with the same values formatted to strings by the producer and parsed by the consumer.
+    void benchTypedValue()
+    {
+        std::ifstream t(amlModelFile);
+        std::string model((std::istreambuf_iterator<char>(t)), std::istreambuf_iterator<char>());
+        for (const char* name : {"\"x\"", "\"y\"", "\"z\""})
+        {
+            std::string from = std::string("Name=") + name + " AttributeDataType=\"xs:string\"";
+            model.replace(model.find(from), from.size(), std::string("Name=") + name + " AttributeDataType=\"xs:double\"");
+        }
+        Representation rep(model.data(), model.size());
+
+        const double values[] = {20.123456789, -110.5, 80.000001};
+        const char* keys[] = {"x", "y", "z"};
+        for (bool isTyped : {false, true})
+        {
+            AMLObject amlObj("SAMPLE001", "123456789");
+            AMLData& modelData = amlObj.emplaceData("Model");
+            modelData.setValue("a", "Model_107.113.97.248");
+            modelData.setValue("b", "SR-P7-970");
+            AMLData& sample = amlObj.emplaceData("Sample");
+            sample.setValue("appendix", vector<string>{"52303", "52304", "52305"});
+            AMLData& info = sample.emplaceData("info");
+            info.setValue("id", "f437da3b");
+            AMLData& axis = info.emplaceData("axis");
+
+            auto produce = [&]()
+            {
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    if (isTyped)    axis.setDoubleValue(keys[i], values[i]);
+                    else            axis.setValue(keys[i], std::to_string(values[i]));
+                }
+            };
+            produce();
+            std::string binary = rep.DataToByte(amlObj);
+            std::string payload = std::string(isTyped ? "typed" : "string") + ", " + std::to_string(binary.size()) + " bytes";
+
+            report("DataToByte (set values)", payload, measure([&]()
+            {
+                axis = AMLData();
+                produce();
+                rep.DataToByte(amlObj);
+            }));
+
+            double sum = 0;
+            report("ByteToData (get values)", payload, measure([&]()
+            {
+                std::unique_ptr<AMLObject> result(rep.ByteToData(binary));
+                const AMLData& decoded = result->getData("Sample").getValueToAMLData("info").getValueToAMLData("axis");
+                for (const char* key : keys)
+                {
+                    sum += decoded.getValueToDouble(key);
+                }
+            }));
+        }
+    }
+#endif
+
+    // Compact byte data has the values only, while Protobuf byte data has the whole structure of CAEX.
+    void benchCompactByte(const Representation& rep, const std::string& payload, const AMLObject& amlObj)
+    {
+        std::string compact = rep.DataToCompactByte(amlObj);
+        cout << left << setw(40) << "Compact byte size (" + payload + ")" << right << setw(24) << compact.size() << " bytes";
+#ifndef _DISABLE_PROTOBUF_
+        cout << " (protobuf " << rep.DataToByte(amlObj).size() << " bytes)";
+#endif
+        cout << endl;
+
+        std::string buffer;
+        report("DataToCompactByte (reused buffer)", payload, measure([&]()
+        {
+            buffer.clear();
+            rep.DataToCompactByte(amlObj, buffer);
+        }));
+        report("CompactByteToData", payload, measure([&]()
+        {
+            delete rep.CompactByteToData(compact);
+        }));
+    }
+
+    // The time per element should not grow with the size of the ordered list, as the elements are decoded in a single pass.
+    void benchOrderedList(const Representation& rep, const std::string& payload, const AMLObject& amlObj, size_t sizeOfArray)
+    {
+        std::string aml = rep.DataToAml(amlObj, false);
+        double usec = measure([&]()
+        {
+            delete rep.AmlToData(aml);
+        });
+        report("AmlToData (ordered list)", payload, usec);
+        report("AmlToData (per element)", payload, usec / sizeOfArray);
+    }
+
+    // Waveform of doubles as a string array (<Attribute> for each sample) and as a numeric array (a single <Value> or packed field)
+    void benchNumericArray(size_t sizeOfArray)
+    {
+        std::ifstream t(amlModelFile);
+        std::string model((std::istreambuf_iterator<char>(t)), std::istreambuf_iterator<char>());
+        std::string from = "Name=\"appendix\" AttributeDataType=\"xs:string\"";
+        model.replace(model.find(from), from.size(), "Name=\"appendix\" AttributeDataType=\"xs:double\"");
+        Representation rep(model.data(), model.size());
+
+        // samples of a sensor whose resolution is 0.001
+        std::vector<double> samples(sizeOfArray);
+        for (size_t i = 0; i < sizeOfArray; ++i)
+        {
+            samples[i] = (static_cast<double>((i * 7919) % 100003) - 50000.0) / 1000.0;
+        }
+
+        for (bool isNumeric : {false, true})
+        {
+            AMLObject waveform("SAMPLE001", "123456789");
+            AMLData& modelData = waveform.emplaceData("Model");
+            modelData.setValue("a", "Model_107.113.97.248");
+            modelData.setValue("b", "SR-P7-970");
+            AMLData& sample = waveform.emplaceData("Sample");
+            AMLData& info = sample.emplaceData("info");
+            info.setValue("id", "f437da3b");
+            AMLData& axis = info.emplaceData("axis");
+            axis.setValue("x", "20");
+            axis.setValue("y", "110");
+            axis.setValue("z", "80");
+
+            if (isNumeric)
+            {
+                sample.setDoubleArrayValue("appendix", samples);
+            }
+            else
+            {
+                std::vector<std::string> texts;
+                for (double value : samples)
+                {
+                    texts.push_back(std::to_string(value));
+                }
+                sample.setValue("appendix", std::move(texts));
+            }
+
+            std::string kind = std::string(isNumeric ? "double" : "string") + "[" + std::to_string(sizeOfArray) + "]";
+
+            std::string aml = rep.DataToAml(waveform, false);
+            std::string payload = kind + ", " + std::to_string(aml.size() / 1024) + " KB";
+            std::string buffer;
+            report("DataToAml (waveform, data-only)", payload, measure([&]()
+            {
+                buffer.clear();
+                rep.DataToAml(waveform, false, buffer);
+            }));
+            report("AmlToData (waveform)", payload, measure([&]()
+            {
+                delete rep.AmlToData(aml);
+            }));
+
+#ifndef _DISABLE_PROTOBUF_
+            std::string binary = rep.DataToByte(waveform);
+            payload = kind + ", " + std::to_string(binary.size() / 1024) + " KB";
+            report("DataToByte (waveform)", payload, measure([&]()
+            {
+                rep.DataToByte(waveform);
+            }));
+            report("ByteToData (waveform)", payload, measure([&]()
+            {
+                delete rep.ByteToData(binary);
+            }));
+#endif
+        }
+    }
+}
+
+using namespace AMLBenchmark;
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1)
+    {
+        amlModelFile = argv[1];
+    }
+
+    try
+    {
+        for (size_t sizeOfKeys : {3, 10, 20, 100})
+        {
+            benchAMLData("keys[" + std::to_string(sizeOfKeys) + "]", sizeOfKeys);
+        }
+
+        benchConstruct();
+
+        Representation rep(amlModelFile);
+
+        for (size_t sizeOfAppendix : {3, 100, 1000, 10000})
+        {
+            std::string payload = "appendix[" + std::to_string(sizeOfAppendix) + "]";
+            benchDataToAml(rep, payload, TestAMLObject(sizeOfAppendix));
+        }
+
+        for (size_t sizeOfAppendix : {3, 100})
+        {
+            std::string payload = "appendix[" + std::to_string(sizeOfAppendix) + "]";
+            benchBatch(rep, payload, TestAMLObject(sizeOfAppendix), 64);
+        }
+
+        for (size_t sizeOfAppendix : {3, 100, 1000})
+        {
+            std::string payload = "appendix[" + std::to_string(sizeOfAppendix) + "]";
+            benchAmlToData(rep, payload, TestAMLObject(sizeOfAppendix));
+            benchArena(rep, payload, TestAMLObject(sizeOfAppendix));
+        }
+
+        for (size_t sizeOfAppendix : {3, 1000})
+        {
+            std::string payload = "appendix[" + std::to_string(sizeOfAppendix) + "]";
+            benchDataView(rep, payload, TestAMLObject(sizeOfAppendix));
+            benchProjection(rep, payload, TestAMLObject(sizeOfAppendix));
+        }
+
+        for (size_t sizeOfAppendix : {3, 100})
+        {
+            std::string payload = "appendix[" + std::to_string(sizeOfAppendix) + "]";
+            benchBatchDecode(rep, payload, TestAMLObject(sizeOfAppendix), 64);
+        }
+
+        benchConcurrentUse(rep, "appendix[100]", TestAMLObject(100));
+
+        for (size_t sizeOfAppendix : {1000, 10000, 100000})
+        {
+            std::string payload = "appendix[" + std::to_string(sizeOfAppendix) + "]";
+            benchOrderedList(rep, payload, TestAMLObject(sizeOfAppendix), sizeOfAppendix);
+        }
+
+        for (size_t sizeOfAppendix : {3, 100, 1000})
+        {
+            std::string payload = "appendix[" + std::to_string(sizeOfAppendix) + "]";
+            benchCompactByte(rep, payload, TestAMLObject(sizeOfAppendix));
+        }
+
+        for (size_t sizeOfArray : {1000, 10000, 100000, 1000000})
+        {
+            benchNumericArray(sizeOfArray);
+        }
+
+#ifndef _DISABLE_PROTOBUF_
+        for (size_t sizeOfAppendix : {3, 100, 1000, 10000})
+        {
+            std::string payload = "appendix[" + std::to_string(sizeOfAppendix) + "]";
+            benchDataToByte(rep, payload, TestAMLObject(sizeOfAppendix));
+        }
+
+        benchByteToData(rep, "TEST_DataBinary", TestBinary());
+
+        benchTypedValue();
+
+        for (size_t sizeOfAppendix : {100, 1000, 10000})
+        {
+            std::string payload = "appendix[" + std::to_string(sizeOfAppendix) + "]";
+            benchByteLayout(rep, payload, TestAMLObject(sizeOfAppendix));
+        }
+
+        for (size_t sizeOfAppendix : {100, 1000, 10000})
+        {
+            std::string payload = "appendix[" + std::to_string(sizeOfAppendix) + "]";
+            benchByteToData(rep, payload, rep.DataToByte(TestAMLObject(sizeOfAppendix)));
+        }
+#else
+        cout << "Benchmarks of protobuf API are not run. ('disable_protobuf' build option is enabled)" << endl;
+#endif
+    }
+    catch (const AMLException& e)
+    {
+        cout << "Exception : " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -19,8 +19,14 @@
 #include <string>
 #include <fstream>
 #include <algorithm>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <functional>
 
 #include "AMLInterface.h"
+#include "AMLThreadPool.h"
+#include "AMLProjection.h"
 #include "AMLException.h"
 #include "gtest/gtest.h"
 
@@ -71,6 +77,30 @@ namespace AMLInterfaceTest
                 
                 if (false == isEqual(valAMLData1, valAMLData2)) return false;
             }
+            else if (AMLValueType::Integer == type1)
+            {
+                if (data1.getValueToInt(key) != data2.getValueToInt(key)) return false;
+            }
+            else if (AMLValueType::Double == type1)
+            {
+                if (data1.getValueToDouble(key) != data2.getValueToDouble(key)) return false;
+            }
+            else if (AMLValueType::Boolean == type1)
+            {
+                if (data1.getValueToBool(key) != data2.getValueToBool(key)) return false;
+            }
+            else if (AMLValueType::Binary == type1)
+            {
+                if (data1.getValueToBinary(key) != data2.getValueToBinary(key)) return false;
+            }
+            else if (AMLValueType::IntegerArray == type1)
+            {
+                if (data1.getValueToIntArr(key) != data2.getValueToIntArr(key)) return false;
+            }
+            else if (AMLValueType::DoubleArray == type1)
+            {
+                if (data1.getValueToDoubleArr(key) != data2.getValueToDoubleArr(key)) return false;
+            }
         }
         return true;
     }
@@ -347,6 +377,265 @@ namespace AMLInterfaceTest
         }
     }
 
+    TEST(AMLData_setValueByMove, Valid)
+    {
+        AMLData nested;
+        EXPECT_NO_THROW(nested.setValue("key", string("value")));
+
+        vector<string> values = {"value1", "value2"};
+
+        AMLData amlData;
+        EXPECT_NO_THROW(amlData.setValue("array", std::move(values)));
+        EXPECT_NO_THROW(amlData.setValue("nested", std::move(nested)));
+
+        EXPECT_EQ(amlData.getValueToStrArr("array").size(), 2u);
+        EXPECT_TRUE("value" == amlData.getValueToAMLData("nested").getValueToStr("key"));
+        EXPECT_TRUE(nested.getKeys().empty());
+    }
+
+    TEST(AMLData_setValueByMove, Invalid_DuplicatedKey)
+    {
+        AMLData amlData;
+        EXPECT_NO_THROW(amlData.setValue("key", string("value")));
+
+        try
+        {
+            amlData.setValue("key", AMLData());
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), KEY_ALREADY_EXIST);
+        }
+    }
+
+    TEST(AMLData_emplaceData, Valid)
+    {
+        AMLData amlData;
+
+        AMLData& nested = amlData.emplaceData("nested");
+        EXPECT_NO_THROW(nested.setValue("key", "value"));
+
+        EXPECT_TRUE("value" == amlData.getValueToAMLData("nested").getValueToStr("key"));
+        EXPECT_THROW(amlData.emplaceData("nested"), AMLException);
+    }
+
+    TEST(AMLData_move, Valid)
+    {
+        AMLData origin;
+        EXPECT_NO_THROW(origin.setValue("key", "value"));
+
+        AMLData moved(std::move(origin));
+        EXPECT_TRUE("value" == moved.getValueToStr("key"));
+        EXPECT_TRUE(origin.getKeys().empty());
+
+        // assignment replaces the existing values
+        AMLData assigned;
+        EXPECT_NO_THROW(assigned.setValue("old", "value"));
+        assigned = std::move(moved);
+        EXPECT_EQ(assigned.getKeys().size(), 1u);
+        EXPECT_TRUE("value" == assigned.getValueToStr("key"));
+    }
+
+    TEST(AMLData_move, AcrossArena)
+    {
+        AMLArena arena;
+        AMLData inArena(&arena);
+        EXPECT_NO_THROW(inArena.setValue("key", "value"));
+        EXPECT_NO_THROW(inArena.setValue("key which is longer than inline buffer", "value"));
+
+        // values and keys in the arena are copied to the heap, so they are still valid after the arena is reset
+        AMLData onHeap;
+        onHeap = std::move(inArena);
+        inArena = AMLData();
+        arena.reset();
+
+        EXPECT_TRUE("value" == onHeap.getValueToStr("key"));
+        EXPECT_TRUE("value" == onHeap.getValueToStr("key which is longer than inline buffer"));
+    }
+
+    TEST(AMLSymbolTest, Lookup)
+    {
+        size_t interned = AMLSymbol::internedCount();
+
+        AMLSymbol a1 = AMLSymbol::lookup("lookup_a");
+        AMLSymbol a2 = AMLSymbol::lookup(string("lookup_a"));
+        AMLSymbol b = AMLSymbol::lookup("lookup_b");
+
+        // names which are not in a loaded model are not interned
+        EXPECT_EQ(AMLSymbol::internedCount(), interned);
+        EXPECT_TRUE(&a1.str() != &a2.str());
+
+        EXPECT_TRUE(a1 == a2);
+        EXPECT_TRUE(a1 != b);
+        EXPECT_TRUE(a1 < b);
+        EXPECT_FALSE(b < a1);
+        EXPECT_FALSE(a1 < a2);
+
+        EXPECT_TRUE(AMLSymbol().empty());
+        EXPECT_TRUE(&AMLSymbol().str() == &AMLSymbol::lookup("").str());
+    }
+
+    TEST(AMLSymbolTest, Uninterned)
+    {
+        size_t interned = AMLSymbol::internedCount();
+
+        AMLSymbol a1 = AMLSymbol::uninterned("uninterned_a");
+        AMLSymbol a2 = AMLSymbol::uninterned("uninterned_a");
+        AMLSymbol b = AMLSymbol::uninterned("uninterned_b");
+        EXPECT_EQ(AMLSymbol::internedCount(), interned);
+
+        // uninterned symbols are compared by name
+        EXPECT_TRUE(a1 == a2);
+        EXPECT_TRUE(a1 != b);
+        EXPECT_TRUE(a1 < b);
+        EXPECT_TRUE(a1 == AMLSymbol::lookup("uninterned_a"));
+        EXPECT_TRUE(AMLSymbol::lookup("uninterned_a") == a2);
+
+        AMLSymbol moved(std::move(a1));
+        EXPECT_EQ(moved.str(), "uninterned_a");
+        EXPECT_EQ(a1.str(), "uninterned_a");
+
+        // keys given as string are not interned
+        interned = AMLSymbol::internedCount();
+        AMLData amlData;
+        amlData.setValue("uninterned_key", "value");
+        EXPECT_EQ(amlData.getValueToStr(AMLSymbol::lookup("uninterned_key")), "value");
+        EXPECT_EQ(AMLSymbol::internedCount(), interned);
+    }
+
+    TEST(AMLData_symbol, Valid)
+    {
+        AMLSymbol key1 = AMLSymbol::lookup("key1");
+        AMLSymbol key2 = AMLSymbol::lookup("key2");
+
+        AMLData amlData;
+        EXPECT_NO_THROW(amlData.setValue(key2, "value2"));
+        EXPECT_NO_THROW(amlData.setValue("key1", "value1"));
+        EXPECT_NO_THROW(amlData.emplaceData(AMLSymbol::lookup("key3")).setValue(key1, "nested"));
+
+        // keys given as string and as symbol are the same
+        EXPECT_TRUE("value1" == amlData.getValueToStr(key1));
+        EXPECT_TRUE("value2" == amlData.getValueToStr("key2"));
+        EXPECT_TRUE("nested" == amlData.getValueToAMLData("key3").getValueToStr(key1));
+        EXPECT_TRUE(AMLValueType::AMLData == amlData.getValueType(AMLSymbol::lookup("key3")));
+        EXPECT_EQ(amlData.getKeys(), (vector<string>{"key1", "key2", "key3"}));
+
+        EXPECT_THROW(amlData.setValue(AMLSymbol::lookup("key1"), "value"), AMLException);
+        EXPECT_THROW(amlData.setValue(AMLSymbol(), "value"), AMLException);
+        EXPECT_THROW(amlData.getValueToStr(AMLSymbol::lookup("key4")), AMLException);
+        EXPECT_THROW(amlData.getValueToStrArr(key1), AMLException);
+    }
+
+    TEST(AMLData_typedValue, Valid)
+    {
+        AMLData amlData;
+        vector<uint8_t> binary = {0x00, 0xFF, 0x10};
+
+        EXPECT_NO_THROW(amlData.setIntValue("int", -1234567890123LL));
+        EXPECT_NO_THROW(amlData.setDoubleValue("double", 20.5));
+        EXPECT_NO_THROW(amlData.setBoolValue(AMLSymbol::lookup("bool"), true));
+        EXPECT_NO_THROW(amlData.setBinaryValue("binary", binary));
+
+        EXPECT_TRUE(AMLValueType::Integer == amlData.getValueType("int"));
+        EXPECT_TRUE(AMLValueType::Double == amlData.getValueType("double"));
+        EXPECT_TRUE(AMLValueType::Boolean == amlData.getValueType("bool"));
+        EXPECT_TRUE(AMLValueType::Binary == amlData.getValueType("binary"));
+
+        EXPECT_EQ(amlData.getValueToInt("int"), -1234567890123LL);
+        EXPECT_EQ(amlData.getValueToDouble(AMLSymbol::lookup("double")), 20.5);
+        EXPECT_TRUE(amlData.getValueToBool("bool"));
+        EXPECT_TRUE(binary == amlData.getValueToBinary("binary"));
+
+        // an integer is also read as a floating point number
+        EXPECT_EQ(amlData.getValueToDouble("int"), -1234567890123.0);
+
+        // typed values are kept by copy and move
+        AMLData copied(amlData);
+        AMLData moved(std::move(copied));
+        EXPECT_TRUE(isEqual(moved, amlData));
+    }
+
+    TEST(AMLData_typedValue, ParseString)
+    {
+        AMLData amlData;
+        EXPECT_NO_THROW(amlData.setValue("int", "-9223372036854775808"));
+        EXPECT_NO_THROW(amlData.setValue("double", "1.5e3"));
+        EXPECT_NO_THROW(amlData.setValue("bool", "0"));
+        EXPECT_NO_THROW(amlData.setValue("overflow", "9223372036854775808"));
+        EXPECT_NO_THROW(amlData.setValue("text", "12 "));
+
+        EXPECT_EQ(amlData.getValueToInt("int"), INT64_MIN);
+        EXPECT_EQ(amlData.getValueToDouble("double"), 1500.0);
+        EXPECT_FALSE(amlData.getValueToBool("bool"));
+
+        std::vector<std::function<void()>> invalids;
+        invalids.push_back([&]() { amlData.getValueToInt("overflow"); });
+        invalids.push_back([&]() { amlData.getValueToInt("text"); });
+        invalids.push_back([&]() { amlData.getValueToInt("double"); });
+        invalids.push_back([&]() { amlData.getValueToBool("text"); });
+        invalids.push_back([&]() { amlData.getValueToDouble("text"); });
+        invalids.push_back([&]() { amlData.getValueToBinary("text"); });
+        for (auto& invalid : invalids)
+        {
+            try
+            {
+                invalid();
+                FAIL();
+            }
+            catch (const AMLException& e)
+            {
+                EXPECT_EQ(e.code(), WRONG_GETTER_TYPE);
+            }
+        }
+    }
+
+    TEST(AMLData_typedValue, Invalid)
+    {
+        AMLData amlData;
+        EXPECT_NO_THROW(amlData.setIntValue("key", 1));
+
+        EXPECT_THROW(amlData.setDoubleValue("key", 1.0), AMLException);
+        EXPECT_THROW(amlData.setBoolValue("", true), AMLException);
+        EXPECT_THROW(amlData.setBinaryValue("binary", vector<uint8_t>()), AMLException);
+        EXPECT_THROW(amlData.getValueToStr("key"), AMLException);
+        EXPECT_THROW(amlData.getValueToBool("key"), AMLException);
+    }
+
+    TEST(AMLData_numericArray, Valid)
+    {
+        AMLData amlData;
+        vector<int64_t> ints = {INT64_MIN, -1, 0, 7, INT64_MAX};
+        vector<double> doubles = {-0.5, 1e-300, 3.0};
+
+        EXPECT_NO_THROW(amlData.setIntArrayValue("ints", ints));
+        EXPECT_NO_THROW(amlData.setDoubleArrayValue(AMLSymbol::lookup("doubles"), std::move(doubles)));
+
+        EXPECT_TRUE(AMLValueType::IntegerArray == amlData.getValueType("ints"));
+        EXPECT_TRUE(AMLValueType::DoubleArray == amlData.getValueType("doubles"));
+
+        EXPECT_TRUE(ints == amlData.getValueToIntArr("ints"));
+        EXPECT_EQ(amlData.getValueToDoubleArr(AMLSymbol::lookup("doubles")).size(), 3u);
+        EXPECT_EQ(amlData.getValueToDoubleArr("doubles")[1], 1e-300);
+
+        AMLData copied(amlData);
+        AMLData moved(std::move(copied));
+        EXPECT_TRUE(isEqual(moved, amlData));
+    }
+
+    TEST(AMLData_numericArray, Invalid)
+    {
+        AMLData amlData;
+        EXPECT_NO_THROW(amlData.setIntArrayValue("key", vector<int64_t>{1}));
+
+        EXPECT_THROW(amlData.setDoubleArrayValue("key", vector<double>{1.0}), AMLException);
+        EXPECT_THROW(amlData.setIntArrayValue("empty", vector<int64_t>()), AMLException);
+        EXPECT_THROW(amlData.setDoubleArrayValue("", vector<double>{1.0}), AMLException);
+        EXPECT_THROW(amlData.getValueToDoubleArr("key"), AMLException);
+        EXPECT_THROW(amlData.getValueToStrArr("key"), AMLException);
+        EXPECT_THROW(amlData.getValueToInt("key"), AMLException);
+    }
+
     // AMLObject Test
     TEST(AMLObjectTest, ConstructWithId)
     {
@@ -484,4 +773,261 @@ namespace AMLInterfaceTest
 
         EXPECT_TRUE(value == cloneData.getValueToStr(key));
     }
+
+    TEST(AMLArenaTest, Allocate)
+    {
+        AMLArena arena(64);
+
+        void* p1 = arena.allocate(3, 1);
+        void* p2 = arena.allocate(sizeof(double), alignof(double));
+        void* p3 = arena.allocate(1000, 16); // larger than the block
+
+        EXPECT_TRUE(nullptr != p1 && nullptr != p2 && nullptr != p3);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(p2) % alignof(double), 0u);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(p3) % 16, 0u);
+        EXPECT_EQ(arena.getUsedSize(), 3 + sizeof(double) + 1000);
+
+        arena.reset();
+        EXPECT_EQ(arena.getUsedSize(), 0u);
+    }
+
+    TEST(AMLArenaTest, Create)
+    {
+        struct Counter
+        {
+            explicit Counter(int* destroyed) : destroyed(destroyed) {}
+            ~Counter() { (*destroyed)++; }
+            int* destroyed;
+        };
+
+        int destroyed = 0;
+        {
+            AMLArena arena;
+            EXPECT_TRUE(nullptr != arena.create<Counter>(&destroyed));
+            EXPECT_TRUE(nullptr != arena.create<Counter>(&destroyed));
+            EXPECT_EQ(*arena.create<int>(7), 7);
+
+            arena.reset();
+            EXPECT_EQ(destroyed, 2);
+
+            arena.create<Counter>(&destroyed);
+        }
+        EXPECT_EQ(destroyed, 3);
+    }
+
+    TEST(AMLSymbolTest, UninternedInArena)
+    {
+        AMLArena arena;
+        AMLSymbol copy = AMLSymbol::uninterned("arena symbol", &arena);
+
+        EXPECT_TRUE(copy == AMLSymbol::uninterned("arena symbol"));
+        EXPECT_EQ(copy.str(), "arena symbol");
+
+        // the copy in the arena is copied again to be kept on the heap or in another arena
+        AMLArena other;
+        EXPECT_TRUE(&copy.placeIn(&arena).str() == &copy.str());
+        EXPECT_TRUE(&copy.placeIn(&other).str() != &copy.str());
+        EXPECT_TRUE(&copy.placeIn(nullptr).str() != &copy.str());
+        EXPECT_TRUE(copy.placeIn(nullptr) == copy);
+    }
+
+    TEST(AMLThreadPoolTest, ParallelFor)
+    {
+        AMLThreadPool pool(4);
+        EXPECT_GE(pool.getConcurrency(), 1u);
+
+        std::vector<std::atomic<int>> calls(1000);
+        for (auto& call : calls)
+        {
+            call = 0;
+        }
+
+        EXPECT_NO_THROW(pool.parallelFor(calls.size(), [&](size_t index)
+        {
+            calls[index]++;
+        }));
+
+        for (auto& call : calls)
+        {
+            EXPECT_EQ(call, 1);
+        }
+
+        // nested call from the threads of the pool
+        std::atomic<size_t> sum(0);
+        EXPECT_NO_THROW(pool.parallelFor(8, [&](size_t)
+        {
+            pool.parallelFor(100, [&](size_t index)
+            {
+                sum += index;
+            });
+        }));
+        EXPECT_EQ(sum, 8u * 4950u);
+    }
+
+    TEST(AMLThreadPoolTest, ParallelForOnException)
+    {
+        AMLThreadPool pool(4);
+
+        try
+        {
+            pool.parallelFor(100, [](size_t index)
+            {
+                if (index >= 10 && index % 10 == 0)
+                {
+                    throw AMLException(static_cast<ResultCode>(index));
+                }
+            });
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), static_cast<ResultCode>(10)); // the first failed item
+        }
+
+        AMLThreadPool single(1);
+        EXPECT_EQ(single.getConcurrency(), 1u);
+        EXPECT_THROW(single.parallelFor(2, [](size_t) { throw AMLException(INVALID_PARAM); }), AMLException);
+    }
+
+    TEST(AMLProjectionTest, Select)
+    {
+        AMLProjection projection(vector<string>{"Model", "Sample/info/axis"});
+        EXPECT_NO_THROW(projection.add("Model/a"));   // already selected as a whole
+
+        const AMLProjection* keys = &projection;
+        EXPECT_TRUE(projection.select("Model", &keys));
+        EXPECT_TRUE(nullptr == keys);
+        EXPECT_FALSE(projection.select("Other", &keys));
+
+        const AMLProjection* sample = nullptr;
+        ASSERT_TRUE(projection.select("Sample", &sample));
+        ASSERT_TRUE(nullptr != sample);
+        EXPECT_FALSE(sample->select("appendix", &keys));
+
+        const AMLProjection* info = nullptr;
+        ASSERT_TRUE(sample->select("info", &info));
+        ASSERT_TRUE(nullptr != info);
+        EXPECT_TRUE(info->select("axis", &keys));
+        EXPECT_TRUE(nullptr == keys);
+        EXPECT_FALSE(info->select("id", &keys));
+
+        // a shorter path selects all of the keys under it
+        projection.add("Sample");
+        EXPECT_TRUE(projection.select("Sample", &keys));
+        EXPECT_TRUE(nullptr == keys);
+    }
+
+    TEST(AMLProjectionTest, InvalidPath)
+    {
+        AMLProjection projection;
+        const AMLProjection* keys = nullptr;
+        EXPECT_FALSE(projection.select("Model", &keys));
+
+        for (const char* path : {"", "/Model", "Model/", "Sample//axis"})
+        {
+            try
+            {
+                projection.add(path);
+                FAIL();
+            }
+            catch (const AMLException& e)
+            {
+                EXPECT_EQ(e.code(), INVALID_PARAM);
+            }
+        }
+        EXPECT_FALSE(projection.select("Sample", &keys));
+    }
+
+    TEST(AMLObjectTest, ConstructWithArena)
+    {
+        AMLArena arena;
+        AMLObject* amlObj = new AMLObject("deviceId", "timeStamp", "id", &arena);
+        {
+            AMLData nested(&arena);
+            EXPECT_NO_THROW(nested.setValue("key", "value"));
+
+            AMLData amlData(&arena);
+            EXPECT_NO_THROW(amlData.setValue("nested", nested));
+            EXPECT_NO_THROW(amlData.setValue("array", vector<string>{"a", "b"}));
+            EXPECT_NO_THROW(amlObj->addData("dataName", amlData));
+        }
+        EXPECT_LT(0u, arena.getUsedSize());
+
+        // the copy is placed on the heap, so it is still valid after the arena is reset
+        AMLObject cloneObj(*amlObj);
+        delete amlObj;
+        arena.reset();
+
+        const AMLData& cloneData = cloneObj.getData("dataName");
+        EXPECT_TRUE("value" == cloneData.getValueToAMLData("nested").getValueToStr("key"));
+        EXPECT_EQ(cloneData.getValueToStrArr("array").size(), 2u);
+    }
+
+    TEST(AMLObjectTest, MoveConstructor)
+    {
+        AMLObject originObj("deviceId", "timeStamp");
+
+        AMLData amlData;
+        EXPECT_NO_THROW(amlData.setValue("key", "value"));
+        EXPECT_NO_THROW(originObj.addData("dataName", std::move(amlData)));
+        EXPECT_TRUE(amlData.getKeys().empty());
+
+        AMLObject movedObj(std::move(originObj));
+
+        EXPECT_TRUE("deviceId_timeStamp" == movedObj.getId());
+        EXPECT_TRUE("value" == movedObj.getData("dataName").getValueToStr("key"));
+        EXPECT_TRUE(originObj.getDataNames().empty());
+    }
+
+    TEST(AMLObjectTest, Assignment)
+    {
+        AMLObject originObj("deviceId", "timeStamp");
+        EXPECT_NO_THROW(originObj.emplaceData("dataName").setValue("key", "value"));
+
+        // assignment replaces the existing data, even with the same name
+        AMLObject targetObj("otherId", "otherTimeStamp");
+        EXPECT_NO_THROW(targetObj.emplaceData("dataName").setValue("other", "value"));
+        EXPECT_NO_THROW(targetObj = originObj);
+        EXPECT_TRUE("value" == targetObj.getData("dataName").getValueToStr("key"));
+
+        AMLObject movedObj("otherId", "otherTimeStamp");
+        EXPECT_NO_THROW(movedObj.emplaceData("dataName"));
+        EXPECT_NO_THROW(movedObj = std::move(targetObj));
+        EXPECT_TRUE("deviceId" == movedObj.getDeviceId());
+        EXPECT_TRUE("value" == movedObj.getData("dataName").getValueToStr("key"));
+    }
+
+    TEST(AMLObjectTest, emplaceData)
+    {
+        AMLObject amlObj("deviceId", "timeStamp");
+
+        AMLData& amlData = amlObj.emplaceData("dataName");
+        EXPECT_NO_THROW(amlData.setValue("key", "value"));
+        EXPECT_TRUE("value" == amlObj.getData("dataName").getValueToStr("key"));
+
+        try
+        {
+            amlObj.emplaceData("dataName");
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), KEY_ALREADY_EXIST);
+        }
+    }
+
+    TEST(AMLObjectTest, symbol)
+    {
+        AMLObject amlObj("deviceId", "timeStamp");
+
+        AMLData amlData;
+        EXPECT_NO_THROW(amlData.setValue("key", "value"));
+        EXPECT_NO_THROW(amlObj.addData(AMLSymbol::lookup("dataName"), std::move(amlData)));
+        EXPECT_NO_THROW(amlObj.emplaceData(AMLSymbol::lookup("another")));
+
+        EXPECT_TRUE("value" == amlObj.getData(AMLSymbol::lookup("dataName")).getValueToStr("key"));
+        EXPECT_EQ(amlObj.getDataNames(), (vector<string>{"another", "dataName"}));
+        EXPECT_THROW(amlObj.emplaceData("dataName"), AMLException);
+        EXPECT_THROW(amlObj.getData(AMLSymbol::lookup("unknown")), AMLException);
+    }
 }
@@ -17,11 +17,18 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 #include <fstream>
+#include <cstring>
+#include <thread>
+#include <atomic>
+#include <cstdio>
 
 #include "Representation.h"
+#include "RepresentationRegistry.h"
 #include "AMLInterface.h"
 #include "AMLException.h"
+#include "pugixml.hpp"
 #include "gtest/gtest.h"
 
 using namespace std;
@@ -93,6 +100,59 @@ namespace AMLRepresentationTest
         return str;
     }
 
+    class StringSink : public AMLOutputSink
+    {
+    public:
+        void write(const char* data, size_t size)
+        {
+            str.append(data, size);
+        }
+
+        std::string str;
+    };
+
+    // Sink which keeps the size of each chunk
+    class ChunkSink : public StringSink
+    {
+    public:
+        void write(const char* data, size_t size)
+        {
+            sizes.push_back(size);
+            StringSink::write(data, size);
+        }
+
+        // All chunks are of the same size except the last one.
+        bool isChunked() const
+        {
+            if (sizes.size() < 2)   return false;
+            for (size_t i = 1; i + 1 < sizes.size(); ++i)
+            {
+                if (sizes[i] != sizes[0])   return false;
+            }
+            return sizes.back() <= sizes[0];
+        }
+
+        std::vector<size_t> sizes;
+    };
+
+    // AMLObject whose output is larger than a chunk, with values which are escaped in AML(XML)
+    AMLObject LargeAMLObject()
+    {
+        std::string a;
+        for (int i = 0; i < 2000; ++i)
+        {
+            a.append("<a&b>");
+        }
+
+        AMLData model;
+        model.setValue("a", a);
+        model.setValue("b", std::string(5000, 'b'));
+
+        AMLObject amlObj("SAMPLE001", "123456789");
+        amlObj.addData("Model", model);
+        return amlObj;
+    }
+
     bool isEqual(vector<string>& vecStr1, vector<string>& vecStr2)
     {
         if (vecStr1.size() != vecStr2.size())     return false;
@@ -134,6 +194,30 @@ namespace AMLRepresentationTest
                 
                 if (false == isEqual(valAMLData1, valAMLData2)) return false;
             }
+            else if (AMLValueType::Integer == type1)
+            {
+                if (data1.getValueToInt(key) != data2.getValueToInt(key)) return false;
+            }
+            else if (AMLValueType::Double == type1)
+            {
+                if (data1.getValueToDouble(key) != data2.getValueToDouble(key)) return false;
+            }
+            else if (AMLValueType::Boolean == type1)
+            {
+                if (data1.getValueToBool(key) != data2.getValueToBool(key)) return false;
+            }
+            else if (AMLValueType::Binary == type1)
+            {
+                if (data1.getValueToBinary(key) != data2.getValueToBinary(key)) return false;
+            }
+            else if (AMLValueType::IntegerArray == type1)
+            {
+                if (data1.getValueToIntArr(key) != data2.getValueToIntArr(key)) return false;
+            }
+            else if (AMLValueType::DoubleArray == type1)
+            {
+                if (data1.getValueToDoubleArr(key) != data2.getValueToDoubleArr(key)) return false;
+            }
         }
         return true;
     }
@@ -160,6 +244,28 @@ namespace AMLRepresentationTest
         return true;
     }
 
+    bool isEqual(AMLObjectView& view, AMLObject& obj)
+    {
+        if (view.getDeviceId() != obj.getDeviceId())    return false;
+        if (view.getTimeStamp() != obj.getTimeStamp())  return false;
+        if (view.getId() != obj.getId())                return false;
+
+        vector<string> dataNames1 = view.getDataNames();
+        vector<string> dataNames2 = obj.getDataNames();
+
+        if (false == isEqual(dataNames1, dataNames2))   return false;
+
+        for (string n : dataNames1)
+        {
+            AMLData data1 = view.getData(n);
+            AMLData data2 = obj.getData(n);
+
+            if (false == isEqual(data1, data2))         return false;
+        }
+
+        return true;
+    }
+
     // Test
     TEST(ConstructRepresentationTest, ValidAML)
     {
@@ -205,177 +311,2058 @@ namespace AMLRepresentationTest
         }
     }
 
-    TEST(AmlToDataTest, ConvertValid)
+    TEST(ConstructRepresentationTest, FromBuffer)
     {
-        Representation rep = Representation(amlModelFile);
-        AMLObject* amlObj = NULL;
-        std::string amlStr = TestAML();
-        EXPECT_NO_THROW(amlObj = rep.AmlToData(amlStr));
+        std::ifstream t(amlModelFile);
+        std::string model((std::istreambuf_iterator<char>(t)), std::istreambuf_iterator<char>());
 
-        AMLObject varify = TestAMLObject();
-        EXPECT_TRUE(isEqual(*amlObj, varify));
+        Representation rep = Representation(model.data(), model.size());
+        Representation fromFile = Representation(amlModelFile);
+        EXPECT_EQ(rep.getRepresentationId(), amlModelId);
 
-        if (NULL != amlObj) delete amlObj;
+        AMLObject amlObj = TestAMLObject();
+        EXPECT_EQ(rep.DataToAml(amlObj), fromFile.DataToAml(amlObj));
     }
 
-    TEST(AmlToDataTest, InvalidAml)
+    TEST(ConstructRepresentationTest, FromInvalidBuffer)
     {
-        Representation rep = Representation(amlModelFile);
-        AMLObject* amlObj = NULL;
-        std::string invalidAmlStr("<invalid />");
+        std::vector<std::pair<std::string, ResultCode>> invalids;
+        invalids.push_back(std::make_pair(std::string("<CAEXFile>"), INVALID_XML_STR));
+        invalids.push_back(std::make_pair(std::string("<invalid />"), INVALID_AML_SCHEMA));
+
+        for (const auto& invalid : invalids)
+        {
+            try
+            {
+                Representation rep = Representation(invalid.first.data(), invalid.first.size());
+                FAIL();
+            }
+            catch (const AMLException& e)
+            {
+                EXPECT_EQ(e.code(), invalid.second);
+            }
+        }
+    }
+
+    TEST(ConstructRepresentationTest, ReloadModifiedFile)
+    {
+        std::ifstream t(amlModelFile);
+        std::string model((std::istreambuf_iterator<char>(t)), std::istreambuf_iterator<char>());
+        const std::string copyFile = "./TEST_DataModel_Copy.aml";
+        std::ofstream(copyFile, std::ios::binary) << model;
+
+        Representation* rep = new Representation(copyFile);
+        Representation same = Representation(copyFile);     // shares the model of rep
+        EXPECT_EQ(same.getRepresentationId(), amlModelId);
+
+        std::string modified(model);
+        modified.replace(modified.find("<Version>0.0.1</Version>"), strlen("<Version>0.0.1</Version>"), "<Version>0.0.10</Version>");
+        std::ofstream(copyFile, std::ios::binary | std::ios::trunc) << modified;
+
+        Representation reloaded = Representation(copyFile);
+        EXPECT_EQ(reloaded.getRepresentationId(), "SAMPLE_Robot_0.0.10");
+
+        delete rep;
+        EXPECT_EQ(same.getRepresentationId(), amlModelId);
+        EXPECT_EQ(same.DataToAml(TestAMLObject()), Representation(amlModelFile).DataToAml(TestAMLObject()));
+
+        std::remove(copyFile.c_str());
+    }
+
+    TEST(RepresentationRegistryTest, AcquireShared)
+    {
+        RepresentationRegistry registry;
+        std::shared_ptr<const Representation> rep = registry.acquire(amlModelFile);
+        ASSERT_NE(rep, nullptr);
+        EXPECT_EQ(rep->getRepresentationId(), amlModelId);
+        EXPECT_EQ(registry.acquire(amlModelFile), rep);
+        EXPECT_EQ(registry.find(amlModelId), rep);
+        EXPECT_EQ(registry.getUseCount(amlModelId), 1u);
+        EXPECT_EQ(registry.getRepresentationIds(), std::vector<std::string>(1, amlModelId));
+        EXPECT_EQ(rep->DataToAml(TestAMLObject()), Representation(amlModelFile).DataToAml(TestAMLObject()));
+
+        // kept registered without any consumer
+        rep.reset();
+        EXPECT_EQ(registry.getUseCount(amlModelId), 0u);
+        EXPECT_NE(registry.find(amlModelId), nullptr);
+
+        EXPECT_EQ(registry.find("SAMPLE_Robot_0.0.2"), nullptr);
+        EXPECT_EQ(registry.getUseCount("SAMPLE_Robot_0.0.2"), 0u);
+    }
+
+    TEST(RepresentationRegistryTest, AcquireInvalid)
+    {
+        RepresentationRegistry registry;
+        EXPECT_THROW(registry.acquire("./NOT_EXIST_FILE.aml"), AMLException);
+        EXPECT_THROW(registry.acquire(amlDataFile + "/"), AMLException);
+        EXPECT_THROW(registry.acquire(amlModelFile_invalid_NoCAEX), AMLException);
+        EXPECT_THROW(registry.acquire(amlModelFile_invalid_NoSUCL), AMLException);
+        EXPECT_TRUE(registry.getRepresentationIds().empty());
 
         try
         {
-            amlObj = rep.AmlToData(invalidAmlStr);
-            FAIL();
+            registry.acquire(amlModelFile_invalid_NoCAEX);
         }
         catch (const AMLException& e)
         {
             EXPECT_EQ(e.code(), INVALID_AML_SCHEMA);
         }
+    }
 
-        if (NULL != amlObj)  delete amlObj;
+    TEST(RepresentationRegistryTest, Evict)
+    {
+        RepresentationRegistry registry;
+        std::shared_ptr<const Representation> rep = registry.acquire(amlModelFile);
+
+        EXPECT_EQ(registry.evictUnused(), 0u);
+        EXPECT_TRUE(registry.evict(amlModelId));
+        EXPECT_FALSE(registry.evict(amlModelId));
+        EXPECT_EQ(registry.find(amlModelId), nullptr);
+
+        // still valid for the consumer, and loaded again by the next acquire()
+        EXPECT_EQ(rep->getRepresentationId(), amlModelId);
+        std::shared_ptr<const Representation> loaded = registry.acquire(amlModelFile);
+        EXPECT_NE(loaded, rep);
+        EXPECT_EQ(registry.getUseCount(amlModelId), 1u);
+
+        loaded.reset();
+        EXPECT_EQ(registry.evictUnused(), 1u);
+        EXPECT_TRUE(registry.getRepresentationIds().empty());
     }
 
-    TEST(DataToAmlTest, ConvertValid)
+    TEST(RepresentationRegistryTest, ReloadModifiedFile)
     {
-        Representation rep = Representation(amlModelFile);
-        AMLObject amlObj = TestAMLObject();
-        std::string amlStr;
-        EXPECT_NO_THROW(amlStr = rep.DataToAml(amlObj));
+        std::ifstream t(amlModelFile);
+        std::string model((std::istreambuf_iterator<char>(t)), std::istreambuf_iterator<char>());
+        const std::string copyFile = "./TEST_DataModel_Registry.aml";
+        std::ofstream(copyFile, std::ios::binary) << model;
 
-        std::string varify = TestAML();
-        EXPECT_EQ(varify.compare(amlStr), 0); //@TODO: issue - it does not return 0 though they are same string 
+        RepresentationRegistry registry;
+        std::shared_ptr<const Representation> rep = registry.acquire(copyFile);
+        std::shared_ptr<const Representation> other = registry.acquire(amlModelFile);
+
+        std::string modified(model);
+        modified.replace(modified.find("<Version>0.0.1</Version>"), strlen("<Version>0.0.1</Version>"), "<Version>0.0.10</Version>");
+        std::ofstream(copyFile, std::ios::binary | std::ios::trunc) << modified;
+
+        std::shared_ptr<const Representation> reloaded = registry.acquire(copyFile);
+        EXPECT_EQ(reloaded->getRepresentationId(), "SAMPLE_Robot_0.0.10");
+        EXPECT_EQ(rep->getRepresentationId(), amlModelId);
+        EXPECT_EQ(registry.find(amlModelId), other);
+
+        std::vector<std::string> ids = {amlModelId, "SAMPLE_Robot_0.0.10"};
+        EXPECT_EQ(registry.getRepresentationIds(), ids);
+
+        std::remove(copyFile.c_str());
     }
 
-    TEST(DataToAmlTest, InvalidDataToModel)
+    TEST(RepresentationRegistryTest, RewriteSameContents)
     {
-        Representation rep = Representation(amlModelFile);
+        std::ifstream t(amlModelFile);
+        std::string model((std::istreambuf_iterator<char>(t)), std::istreambuf_iterator<char>());
+        const std::string copyFile = "./TEST_DataModel_Rewritten.aml";
+        std::ofstream(copyFile, std::ios::binary) << model;
 
-        AMLObject notMatchToModel("deviceId", "0");
+        RepresentationRegistry registry;
+        std::shared_ptr<const Representation> rep = registry.acquire(copyFile);
 
-        AMLData data;
-        data.setValue("invalidKey", "invalidValue");
+        // the stamp of the file changes, but the contents do not
+        std::ofstream(copyFile, std::ios::binary | std::ios::trunc) << model;
+        EXPECT_EQ(registry.acquire(copyFile), rep);
+        EXPECT_EQ(registry.acquire(copyFile), rep);
 
-        notMatchToModel.addData("invalidData", data);
+        std::remove(copyFile.c_str());
+    }
 
-        try
-        {
-            rep.DataToAml(notMatchToModel);
-            FAIL();
-        }
-        catch (const AMLException& e)
-        {
-            EXPECT_EQ(e.code(), NOT_MATCH_TO_AML_MODEL);
-        }
+    TEST(RepresentationRegistryTest, Default)
+    {
+        EXPECT_EQ(&RepresentationRegistry::getDefault(), &RepresentationRegistry::getDefault());
     }
 
-    TEST(DataToAmlTest, IgnoreDataNotInModel)
+    TEST(CompiledModelTest, SameAsAml)
     {
         Representation rep = Representation(amlModelFile);
+        std::string image = rep.getCompiledModel();
+        Representation compiled = Representation(image.data(), image.size());
+
+        EXPECT_EQ(compiled.getRepresentationId(), rep.getRepresentationId());
+        EXPECT_EQ(compiled.getCompiledModel(), image);
+
         AMLObject amlObj = TestAMLObject();
+        EXPECT_EQ(compiled.DataToAml(amlObj), rep.DataToAml(amlObj));
+        EXPECT_EQ(compiled.DataToAml(amlObj, false), rep.DataToAml(amlObj, false));
+        EXPECT_EQ(compiled.estimateAmlSize(amlObj, true), rep.estimateAmlSize(amlObj, true));
 
-        AMLData sample = amlObj.getData("Sample");
-        sample.setValue("additionalKey", "additionalValue");
+        AMLObject* amlResult = compiled.AmlToData(rep.DataToAml(amlObj));
+        EXPECT_TRUE(isEqual(*amlResult, amlObj));
+        delete amlResult;
 
-        std::string amlStr;
-        EXPECT_NO_THROW(amlStr = rep.DataToAml(amlObj));
+        AMLObject* config = compiled.getConfigInfo();
+        AMLObject* configVerify = rep.getConfigInfo();
+        EXPECT_TRUE(isEqual(*config, *configVerify));
+        delete config;
+        delete configVerify;
 
-        AMLObject *resultObj = NULL;
-        EXPECT_NO_THROW(resultObj = rep.AmlToData(amlStr));
+#ifndef _DISABLE_PROTOBUF_
+        std::string byte = rep.DataToByte(amlObj);
+        EXPECT_EQ(compiled.DataToByte(amlObj), byte);
+        AMLObject* byteResult = compiled.ByteToData(byte);
+        EXPECT_TRUE(isEqual(*byteResult, amlObj));
+        delete byteResult;
+#endif
 
-        AMLData sampleResult = resultObj->getData("Sample");
+        // an object which does not match to the model fails in the same way
+        AMLObject mismatched("SAMPLE001", "123456789");
+        AMLData data;
+        data.setValue("a", "b");
+        mismatched.addData("NotInModel", data);
+        EXPECT_THROW(rep.DataToAml(mismatched), AMLException);
+        EXPECT_THROW(compiled.DataToAml(mismatched), AMLException);
+    }
 
+    TEST(CompiledModelTest, FromFile)
+    {
+        const std::string compiledFile = "./TEST_DataModel.amlc";
+        std::string image = Representation(amlModelFile).getCompiledModel();
+        std::ofstream(compiledFile, std::ios::binary) << image;
+
+        Representation compiled = Representation(compiledFile);
+        EXPECT_EQ(compiled.getRepresentationId(), amlModelId);
+        EXPECT_EQ(compiled.DataToAml(TestAMLObject()), Representation(amlModelFile).DataToAml(TestAMLObject()));
+
+        // corrupted
+        std::ofstream(compiledFile, std::ios::binary | std::ios::trunc) << image.substr(0, image.size() / 2);
         try
         {
-            sampleResult.getValueToStr("additionalKey");
+            Representation rep = Representation(compiledFile);
             FAIL();
         }
         catch (const AMLException& e)
         {
-            EXPECT_EQ(e.code(), KEY_NOT_EXIST);
+            EXPECT_EQ(e.code(), INVALID_FILE_PATH);
         }
 
-        if (NULL != resultObj) delete resultObj;
+        std::remove(compiledFile.c_str());
     }
 
-    TEST(ByteToDataTest, ConvertValid)
+    TEST(CompiledModelTest, InvalidImage)
+    {
+        std::string image = Representation(amlModelFile).getCompiledModel();
+
+        std::vector<std::string> invalids;
+        invalids.push_back(image.substr(0, 8));                         // header only
+        invalids.push_back(image.substr(0, image.size() - 1));          // truncated
+        invalids.push_back(image + '\0');                               // trailing byte
+        invalids.push_back(std::string(image).replace(8, 1, 1, '\x7f')); // another version
+
+        for (const std::string& invalid : invalids)
+        {
+            try
+            {
+                Representation rep = Representation(invalid.data(), invalid.size());
+                FAIL();
+            }
+            catch (const AMLException& e)
+            {
+                EXPECT_EQ(e.code(), INVALID_BYTE_STR);
+            }
+        }
+    }
+
+    TEST(AmlToDataTest, ConvertValid)
     {
         Representation rep = Representation(amlModelFile);
         AMLObject* amlObj = NULL;
-        std::string binary = TestBinary();
+        std::string amlStr = TestAML();
+        EXPECT_NO_THROW(amlObj = rep.AmlToData(amlStr));
 
-#ifndef _DISABLE_PROTOBUF_
-        EXPECT_NO_THROW(amlObj = rep.ByteToData(binary));
+        AMLObject varify = TestAMLObject();
+        EXPECT_TRUE(isEqual(*amlObj, varify));
+
+        if (NULL != amlObj) delete amlObj;
+    }
+
+    TEST(AmlToDataTest, ConvertBuffer)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject* amlObj = NULL;
+        const std::string amlStr = TestAML();
+        const std::vector<char> buffer(amlStr.begin(), amlStr.end());
+        EXPECT_NO_THROW(amlObj = rep.AmlToData(buffer.data(), buffer.size()));
 
         AMLObject varify = TestAMLObject();
         EXPECT_TRUE(isEqual(*amlObj, varify));
+        EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), amlStr.begin()));
 
-        if (NULL != amlObj)  delete amlObj;
-#else
-        try
-        {
-            amlObj = rep.ByteToData(binary);
-            FAIL();
-            (void)amlObj;
-        }
-        catch (const AMLException& e)
-        {
-            EXPECT_EQ(e.code(), API_NOT_ENABLED);
-        }
-#endif
+        if (NULL != amlObj) delete amlObj;
     }
 
-    TEST(ByteToDataTest, InvalidByte)
+    TEST(AmlToDataTest, SkipNonDataNodes)
     {
         Representation rep = Representation(amlModelFile);
+        std::string amlStr = TestAML();
+
+        // markup which is not data is skipped, and text is decoded as XML parser does
+        size_t root = amlStr.find("<CAEXFile");
+        amlStr.insert(root, "<!DOCTYPE CAEXFile [ <!ENTITY e \"<>\"> ]>\n<?pi data?><!-- comment -->\n");
+        size_t value = amlStr.find("<Value>SR-P7-970</Value>");
+        amlStr.replace(value, strlen("<Value>SR-P7-970</Value>"), "<Value>SR<!-- c -->-P7</Value>");
+        value = amlStr.find("<Value>f437da3b</Value>");
+        amlStr.replace(value, strlen("<Value>f437da3b</Value>"), "<Value><![CDATA[<f437>]]></Value>");
+        value = amlStr.find("<Value>20</Value>");
+        amlStr.replace(value, strlen("<Value>20</Value>"), "<Value>&lt;2&#48;&gt;\r\n</Value>");
+
         AMLObject* amlObj = NULL;
-        std::string amlBinary("invalidBinary");
+        EXPECT_NO_THROW(amlObj = rep.AmlToData(amlStr));
+        ASSERT_TRUE(NULL != amlObj);
 
-        try
-        {
-            amlObj = rep.ByteToData(amlBinary);
-            FAIL();
-        }
-        catch (const AMLException& e)
+        EXPECT_EQ(amlObj->getData("Model").getValueToStr("b"), "SR");
+        const AMLData& info = amlObj->getData("Sample").getValueToAMLData("info");
+        EXPECT_EQ(info.getValueToStr("id"), "<f437>");
+        EXPECT_EQ(info.getValueToAMLData("axis").getValueToStr("x"), "<20>\n");
+
+        delete amlObj;
+    }
+
+    TEST(AmlToDataTest, OrderedList)
+    {
+        Representation rep = Representation(amlModelFile);
+        std::string amlStr = TestAML();
+        size_t appendix = amlStr.find("Name=\"appendix\"");
+        ASSERT_NE(appendix, std::string::npos);
+
+        // renames the elements "1", "2" and "3" of appendix
+        auto rename = [&](const char* first, const char* second, const char* third)
         {
-#ifndef _DISABLE_PROTOBUF_
-            EXPECT_EQ(e.code(), INVALID_BYTE_STR);
-#else
-            EXPECT_EQ(e.code(), API_NOT_ENABLED);
-#endif
-        }
+            std::string renamed(amlStr);
+            const char* names[] = { first, second, third };
+            size_t pos = appendix;
+            for (int i = 0; i < 3; ++i)
+            {
+                std::string from = "Name=\"" + std::to_string(i + 1) + "\"";
+                pos = renamed.find(from, pos);
+                renamed.replace(pos, from.size(), std::string("Name=\"") + names[i] + "\"");
+            }
+            AMLObject* amlObj = rep.AmlToData(renamed);
+            std::vector<std::string> values = amlObj->getData("Sample").getValueToStrArr("appendix");
+            delete amlObj;
+            return values;
+        };
 
-        if (NULL != amlObj)  delete amlObj;
+        std::vector<std::string> expected = { "52303", "935", "1442" };
+        EXPECT_EQ(rename("1", "2", "3"), expected);
+
+        expected = { "1442", "935", "52303" };          // in order of the names, not of the elements
+        EXPECT_EQ(rename("3", "2", "1"), expected);
+
+        expected = { "52303", "", "1442" };             // a missing index is an empty string
+        EXPECT_EQ(rename("1", "4", "3"), expected);
+        EXPECT_EQ(rename("1", "02", "3"), expected);
+
+        expected = { "52303", "935", "" };              // the first of duplicated names is taken
+        EXPECT_EQ(rename("1", "2", "2"), expected);
     }
 
-    TEST(DataToByteTest, ConvertValid)
+    TEST(AmlToDataTest, NotWellFormed)
     {
         Representation rep = Representation(amlModelFile);
-        AMLObject amlObj = TestAMLObject();
-        std::string amlBinary;
-#ifndef _DISABLE_PROTOBUF_
-        EXPECT_NO_THROW(amlBinary = rep.DataToByte(amlObj));
+        std::string amlStr = TestAML();
 
-        std::string varify = TestBinary();
-        EXPECT_EQ(varify.compare(amlBinary), 0);
-#else
-        try
+        std::vector<std::string> invalids;
+        invalids.push_back(amlStr.substr(0, amlStr.size() / 2));                                  // not closed
+        invalids.push_back(amlStr + "</CAEXFile>");                                               // no start tag
+        invalids.push_back(std::string(amlStr).replace(amlStr.find("</Value>"), 8, "</Valeu>"));  // mismatched end tag
+        invalids.push_back(std::string(amlStr).replace(amlStr.find("<CAEXFile"), 9, "<CAEXFile<")); // in the model section
+        invalids.push_back("");
+
+        for (const std::string& invalid : invalids)
         {
-            amlBinary = rep.DataToByte(amlObj);
-            FAIL();
+            try
+            {
+                delete rep.AmlToData(invalid);
+                FAIL();
+            }
+            catch (const AMLException& e)
+            {
+                EXPECT_EQ(e.code(), INVALID_XML_STR);
+            }
         }
-        catch (const AMLException& e)
+    }
+
+    // Reads the event of the document which pugixml loads, with the rules of AmlToData.
+    // It is the reference of the streaming reader, which should decode XML as pugixml does.
+    void PugixmlToData(pugi::xml_node xml_parent, AMLData* amlData)
+    {
+        for (pugi::xml_node xml_attr = xml_parent.child("Attribute"); xml_attr; xml_attr = xml_attr.next_sibling("Attribute"))
         {
-            EXPECT_EQ(e.code(), API_NOT_ENABLED);
+            std::string key(xml_attr.attribute("Name").value());
+
+            if (NULL != xml_attr.child("Value"))
+            {
+                amlData->setValue(key, std::string(xml_attr.child_value("Value")));
+            }
+            else if (NULL != xml_attr.child("RefSemantic") &&
+                     0 != strncmp(xml_attr.attribute("CorrespondingAttributePath").value(), "OrderedListType", strlen("OrderedListType")))
+            {
+                vector<string> values;
+                for (pugi::xml_node xml_item = xml_attr.child("Attribute"); xml_item; xml_item = xml_item.next_sibling("Attribute"))
+                {
+                    std::string index = std::to_string(values.size() + 1);
+                    values.push_back(xml_attr.find_child_by_attribute("Name", index.c_str()).child_value("Value"));
+                }
+                amlData->setValue(key, values);
+            }
+            else if (NULL == xml_attr.child("RefSemantic") && NULL != xml_attr.child("Attribute"))
+            {
+                AMLData value;
+                PugixmlToData(xml_attr, &value);
+                amlData->setValue(key, value);
+            }
+            else
+            {
+                throw AMLException(INVALID_AML_SCHEMA);
+            }
         }
-#endif
     }
 
-    TEST(GetRepresentationIdTest, GetValid)
+    AMLObject* PugixmlToData(const std::string& xmlStr)
     {
-        Representation rep = Representation(amlModelFile);
+        pugi::xml_document xml_doc;
+        if (false == xml_doc.load_string(xmlStr.c_str()))
+        {
+            throw AMLException(INVALID_XML_STR);
+        }
 
-        EXPECT_TRUE(amlModelId == rep.getRepresentationId());
+        pugi::xml_node xml_event = xml_doc.child("CAEXFile").child("InstanceHierarchy").find_child_by_attribute("InternalElement", "Name", "Event");
+        if (NULL == xml_event)
+        {
+            throw AMLException(INVALID_AML_SCHEMA);
+        }
+
+        std::string deviceId, timeStamp, id;
+        for (pugi::xml_node xml_attr = xml_event.child("Attribute"); xml_attr; xml_attr = xml_attr.next_sibling("Attribute"))
+        {
+            std::string name(xml_attr.attribute("Name").value());
+            if      ("device" == name)      deviceId = xml_attr.child_value("Value");
+            else if ("timestamp" == name)   timeStamp = xml_attr.child_value("Value");
+            else if ("id" == name)          id = xml_attr.child_value("Value");
+        }
+
+        AMLObject* amlObj = new AMLObject(deviceId, timeStamp, id);
+        try
+        {
+            for (pugi::xml_node xml_ie = xml_event.child("InternalElement"); xml_ie; xml_ie = xml_ie.next_sibling("InternalElement"))
+            {
+                AMLData amlData;
+                PugixmlToData(xml_ie, &amlData);
+                amlObj->addData(xml_ie.attribute("Name").value(), amlData);
+            }
+        }
+        catch (...)
+        {
+            delete amlObj;
+            throw;
+        }
+        return amlObj;
+    }
+
+    // Expects AmlToData to give the same result as pugixml, or to fail with the same error.
+    void ExpectSameAsPugixml(const Representation& rep, const std::string& xmlStr)
+    {
+        AMLObject* expected = NULL;
+        ResultCode expectedCode = NO_ERROR;
+        try
+        {
+            expected = PugixmlToData(xmlStr);
+        }
+        catch (const AMLException& e)
+        {
+            expectedCode = e.code();
+        }
+
+        AMLObject* actual = NULL;
+        ResultCode actualCode = NO_ERROR;
+        try
+        {
+            actual = rep.AmlToData(xmlStr);
+        }
+        catch (const AMLException& e)
+        {
+            actualCode = e.code();
+        }
+
+        EXPECT_EQ(actualCode, expectedCode) << xmlStr;
+        if (NULL != expected && NULL != actual)
+        {
+            EXPECT_TRUE(isEqual(*actual, *expected)) << xmlStr;
+        }
+        delete expected;
+        delete actual;
+    }
+
+    TEST(AmlToDataTest, SameAsPugixml)
+    {
+        Representation rep = Representation(amlModelFile);
+        std::string amlStr = TestAML();
+
+        auto replaced = [&amlStr](const std::string& from, const std::string& to)
+        {
+            size_t pos = amlStr.find(from);
+            EXPECT_NE(pos, std::string::npos) << from;
+            return std::string(amlStr).replace(pos, from.size(), to);
+        };
+
+        std::vector<std::string> inputs;
+        inputs.push_back(amlStr);
+
+        // entities and character references
+        inputs.push_back(replaced("<Value>SR-P7-970</Value>", "<Value>&lt;&gt;&amp;&quot;&apos;&#65;&#x42;&#x20AC;</Value>"));
+        inputs.push_back(replaced("<Value>SR-P7-970</Value>", "<Value>a &unknown; b & c &#; d</Value>"));
+        inputs.push_back(replaced("<Value>SAMPLE001</Value>", "<Value>SAMPLE&#48;01</Value>"));
+        inputs.push_back(replaced("<Value>SR-P7-970</Value>", "<Value>SR&#0;-P7-970</Value>"));
+
+        // CDATA, which is the first text unless text precedes it
+        inputs.push_back(replaced("<Value>f437da3b</Value>", "<Value><![CDATA[<f437>&amp;]]></Value>"));
+        inputs.push_back(replaced("<Value>f437da3b</Value>", "<Value> \n <![CDATA[f437]]></Value>"));
+        inputs.push_back(replaced("<Value>f437da3b</Value>", "<Value>f4<![CDATA[37]]>da3b</Value>"));
+        inputs.push_back(replaced("<Value>f437da3b</Value>", "<Value><![CDATA[]]>f437</Value>"));
+
+        // comments and PIs, which split text
+        inputs.push_back(replaced("<Value>20</Value>", "<Value><!-- c -->20</Value>"));
+        inputs.push_back(replaced("<Value>20</Value>", "<Value>2<!-- c -->0</Value>"));
+        inputs.push_back(replaced("<Value>20</Value>", "<Value><?pi data?>20</Value>"));
+        inputs.push_back(replaced("<Attribute Name=\"a\"", "<!-- <Attribute Name=\"c\"> --><?pi?>\n<Attribute Name=\"a\""));
+        inputs.push_back(replaced("<CAEXFile", "<?xml version=\"1.0\"?>\n<!DOCTYPE CAEXFile [ <!ENTITY e \"<>\"> ]>\n<CAEXFile"));
+
+        // whitespace and end of line
+        inputs.push_back(replaced("<Value>110</Value>", "<Value>\t1\r\n1\r0 </Value>"));
+        inputs.push_back(replaced("<Value>110</Value>", "<Value/>"));
+        inputs.push_back(replaced("<Value>110</Value>", "<Value>   </Value>"));
+        inputs.push_back(replaced("<Attribute Name=\"b\"", "<Attribute Name=\" b\tc\r\nd\re\n&#9;f&lt;\""));
+        inputs.push_back(replaced("<Attribute Name=\"b\"", "<Attribute Name = 'b'"));
+        inputs.push_back(replaced("<InternalElement Name=\"Model\"", "<InternalElement\n\tName=\"Model\r\n\""));
+
+        // not well-formed
+        inputs.push_back(amlStr.substr(0, amlStr.size() / 4));
+        inputs.push_back(amlStr.substr(0, amlStr.find("</Value>") + 4));
+        inputs.push_back(amlStr.substr(0, amlStr.size() - 2));
+        inputs.push_back(replaced("</Value>", "</Valeu>"));
+        inputs.push_back(replaced("<Value>20</Value>", "<Value>2 < 0</Value>"));
+        inputs.push_back(replaced("<Value>20</Value>", "<Value><!-- 20</Value>"));
+        inputs.push_back(replaced("<Value>20</Value>", "<Value><![CDATA[20</Value>"));
+        inputs.push_back(replaced("<Value>20</Value>", "<Value><?pi 20</Value>"));
+        inputs.push_back(replaced("<Attribute Name=\"b\"", "<Attribute Name=b"));
+        inputs.push_back(replaced("<Attribute Name=\"b\"", "<Attribute Name\"b\""));
+        inputs.push_back(replaced("<Attribute Name=\"b\"", "<1Attribute Name=\"b\""));
+        inputs.push_back(replaced("<RoleClassLib", "<RoleClassLib<"));
+
+        for (const std::string& input : inputs)
+        {
+            ExpectSameAsPugixml(rep, input);
+        }
+    }
+
+    TEST(AmlToDataTest, InvalidAml)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject* amlObj = NULL;
+        std::string invalidAmlStr("<invalid />");
+
+        try
+        {
+            amlObj = rep.AmlToData(invalidAmlStr);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), INVALID_AML_SCHEMA);
+        }
+
+        if (NULL != amlObj)  delete amlObj;
+    }
+
+    TEST(AmlToDataTest, Batch)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject varify = TestAMLObject();
+
+        std::vector<std::string> amls(50, TestAML());
+        amls[7] = "<invalid />";
+        amls[20] = "invalid";
+
+        AMLThreadPool pool(4);
+        std::vector<AMLObject*> amlObjs;
+        std::vector<ResultCode> results;
+        EXPECT_NO_THROW(rep.AmlToData(amls, amlObjs, results, pool));
+        ASSERT_EQ(amlObjs.size(), amls.size());
+        ASSERT_EQ(results.size(), amls.size());
+
+        for (size_t i = 0; i < amls.size(); ++i)
+        {
+            if (7 == i)
+            {
+                EXPECT_EQ(results[i], INVALID_AML_SCHEMA);
+                EXPECT_TRUE(NULL == amlObjs[i]);
+            }
+            else if (20 == i)
+            {
+                EXPECT_EQ(results[i], INVALID_XML_STR);
+                EXPECT_TRUE(NULL == amlObjs[i]);
+            }
+            else
+            {
+                EXPECT_EQ(results[i], NO_ERROR);
+                ASSERT_TRUE(NULL != amlObjs[i]);
+                EXPECT_TRUE(isEqual(*amlObjs[i], varify));
+            }
+            delete amlObjs[i];
+        }
+
+        EXPECT_NO_THROW(rep.AmlToData(std::vector<std::string>(), amlObjs, results));
+        EXPECT_TRUE(amlObjs.empty());
+        EXPECT_TRUE(results.empty());
+    }
+
+    TEST(AmlToDataTest, Projection)
+    {
+        Representation rep = Representation(amlModelFile);
+        std::string amlStr = TestAML();
+
+        // the value which is not selected is not checked either
+        amlStr.replace(amlStr.find("<Value>f437da3b</Value>"), strlen("<Value>f437da3b</Value>"), "");
+
+        AMLProjection projection(std::vector<std::string>{"Sample/info/axis", "Other"});
+        AMLObject* amlObj = NULL;
+        EXPECT_NO_THROW(amlObj = rep.AmlToData(amlStr, projection));
+        ASSERT_TRUE(NULL != amlObj);
+
+        AMLObject varify("SAMPLE001", "123456789");
+        AMLData info;
+        info.setValue("axis", TestAMLObject().getData("Sample").getValueToAMLData("info").getValueToAMLData("axis"));
+        AMLData sample;
+        sample.setValue("info", info);
+        varify.addData("Sample", sample);
+        EXPECT_TRUE(isEqual(*amlObj, varify));
+        delete amlObj;
+
+        // nothing is selected
+        EXPECT_NO_THROW(amlObj = rep.AmlToData(TestAML(), AMLProjection()));
+        ASSERT_TRUE(NULL != amlObj);
+        EXPECT_TRUE(amlObj->getDataNames().empty());
+        delete amlObj;
+
+        // the selected value is checked as AmlToData() does
+        try
+        {
+            delete rep.AmlToData(amlStr, AMLProjection(std::vector<std::string>{"Model", "Sample/info"}));
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), INVALID_AML_SCHEMA);
+        }
+    }
+
+    TEST(AmlToDataViewTest, ConvertValid)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObjectView* view = NULL;
+        EXPECT_NO_THROW(view = rep.AmlToDataView(TestAML()));
+        ASSERT_TRUE(NULL != view);
+
+        // nothing is decoded until the data is read
+        EXPECT_EQ(view->getDecodedCount(), 0u);
+        EXPECT_EQ(view->getDeviceId(), "SAMPLE001");
+        EXPECT_EQ(view->getDataNames().size(), 2u);
+        EXPECT_EQ(view->getDecodedCount(), 0u);
+
+        const AMLData& model = view->getData("Model");
+        EXPECT_EQ(model.getValueToStr("b"), "SR-P7-970");
+        EXPECT_EQ(view->getDecodedCount(), 1u);
+
+        // decoded data is kept
+        EXPECT_EQ(&model, &view->getData("Model"));
+        EXPECT_EQ(view->getDecodedCount(), 1u);
+
+        AMLObject varify = TestAMLObject();
+        EXPECT_TRUE(isEqual(*view, varify));
+        EXPECT_EQ(view->getDecodedCount(), 2u);
+
+        delete view;
+    }
+
+    TEST(AmlToDataViewTest, InvalidValueOnAccess)
+    {
+        Representation rep = Representation(amlModelFile);
+        std::string amlStr = TestAML();
+        amlStr.replace(amlStr.find("<Value>f437da3b</Value>"), strlen("<Value>f437da3b</Value>"), "");
+
+        AMLObjectView* view = NULL;
+        EXPECT_NO_THROW(view = rep.AmlToDataView(amlStr));
+        ASSERT_TRUE(NULL != view);
+
+        // the other data can be read, while the invalid one throws as AmlToData() does
+        EXPECT_EQ(view->getData("Model").getValueToStr("a"), "Model_107.113.97.248");
+        for (int i = 0; i < 2; ++i)
+        {
+            try
+            {
+                view->getData("Sample");
+                FAIL();
+            }
+            catch (const AMLException& e)
+            {
+                EXPECT_EQ(e.code(), INVALID_AML_SCHEMA);
+            }
+        }
+
+        try
+        {
+            view->getData("NotExist");
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), KEY_NOT_EXIST);
+        }
+
+        delete view;
+    }
+
+    TEST(AmlToDataViewTest, InvalidAml)
+    {
+        Representation rep = Representation(amlModelFile);
+        std::string amlStr = TestAML();
+
+        std::vector<std::pair<std::string, ResultCode>> invalids;
+        invalids.push_back(std::make_pair(amlStr.substr(0, amlStr.size() / 2), INVALID_XML_STR));
+        invalids.push_back(std::make_pair(std::string("<invalid />"), INVALID_AML_SCHEMA));
+
+        std::string duplicated(amlStr);
+        duplicated.replace(duplicated.find("Name=\"Sample\""), strlen("Name=\"Sample\""), "Name=\"Model\"");
+        invalids.push_back(std::make_pair(duplicated, KEY_ALREADY_EXIST));
+
+        for (const auto& invalid : invalids)
+        {
+            try
+            {
+                delete rep.AmlToDataView(invalid.first);
+                FAIL();
+            }
+            catch (const AMLException& e)
+            {
+                EXPECT_EQ(e.code(), invalid.second);
+            }
+        }
+    }
+
+    TEST(AmlToDataViewTest, ConcurrentAccess)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObjectView* view = rep.AmlToDataView(TestAML());
+
+        const size_t numThreads = 4;
+        std::vector<const AMLData*> found(numThreads, nullptr);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < numThreads; ++t)
+        {
+            threads.push_back(std::thread([&, t]()
+            {
+                found[t] = &view->getData("Sample");
+            }));
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (size_t t = 0; t < numThreads; ++t)
+        {
+            EXPECT_EQ(found[t], found[0]);
+        }
+        EXPECT_EQ(view->getDecodedCount(), 1u);
+
+        delete view;
+    }
+
+    TEST(DataToAmlTest, ConvertValid)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject amlObj = TestAMLObject();
+        std::string amlStr;
+        EXPECT_NO_THROW(amlStr = rep.DataToAml(amlObj));
+
+        std::string varify = TestAML();
+        EXPECT_EQ(varify.compare(amlStr), 0); //@TODO: issue - it does not return 0 though they are same string 
+    }
+
+    TEST(DataToAmlTest, InvalidDataToModel)
+    {
+        Representation rep = Representation(amlModelFile);
+
+        AMLObject notMatchToModel("deviceId", "0");
+
+        AMLData data;
+        data.setValue("invalidKey", "invalidValue");
+
+        notMatchToModel.addData("invalidData", data);
+
+        try
+        {
+            rep.DataToAml(notMatchToModel);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), NOT_MATCH_TO_AML_MODEL);
+        }
+    }
+
+    TEST(DataToAmlTest, DataOnly)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject amlObj = TestAMLObject();
+
+        std::string amlStr;
+        EXPECT_NO_THROW(amlStr = rep.DataToAml(amlObj, false));
+        EXPECT_EQ(amlStr.find("<RoleClassLib"), std::string::npos);
+        EXPECT_EQ(amlStr.find("<SystemUnitClassLib"), std::string::npos);
+
+        std::string fullStr = rep.DataToAml(amlObj, true);
+        EXPECT_EQ(fullStr.compare(rep.DataToAml(amlObj)), 0);
+        EXPECT_LT(amlStr.size(), fullStr.size());
+
+        AMLObject *resultObj = NULL;
+        EXPECT_NO_THROW(resultObj = rep.AmlToData(amlStr));
+        EXPECT_TRUE(isEqual(*resultObj, amlObj));
+
+        if (NULL != resultObj) delete resultObj;
+    }
+
+    TEST(DataToAmlTest, AppendToBuffer)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject amlObj = TestAMLObject();
+        std::string varify = rep.DataToAml(amlObj);
+
+        std::string out("prefix");
+        size_t size = 0;
+        EXPECT_NO_THROW(size = rep.DataToAml(amlObj, true, out));
+        EXPECT_EQ(size, varify.size());
+        EXPECT_EQ(out, "prefix" + varify);
+
+        std::vector<char> vec;
+        EXPECT_EQ(rep.DataToAml(amlObj, true, vec), varify.size());
+        EXPECT_EQ(std::string(vec.begin(), vec.end()), varify);
+
+        StringSink sink;
+        EXPECT_EQ(rep.DataToAml(amlObj, true, sink), varify.size());
+        EXPECT_EQ(sink.str, varify);
+
+        EXPECT_EQ(rep.estimateAmlSize(amlObj, true), varify.size());
+        EXPECT_EQ(rep.estimateAmlSize(amlObj, false), rep.DataToAml(amlObj, false).size());
+    }
+
+    TEST(DataToAmlTest, SinkInChunks)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject amlObj = LargeAMLObject();
+        std::string varify = rep.DataToAml(amlObj);
+
+        ChunkSink sink;
+        EXPECT_EQ(rep.DataToAml(amlObj, true, sink), varify.size());
+        EXPECT_EQ(sink.str, varify);
+        EXPECT_TRUE(sink.isChunked());
+
+        std::vector<char> vec(1, 'p');
+        EXPECT_EQ(rep.DataToAml(amlObj, true, vec), varify.size());
+        EXPECT_EQ(std::string(vec.begin(), vec.end()), "p" + varify);
+    }
+
+    TEST(DataToAmlTest, SinkOnException)
+    {
+        Representation rep = Representation(amlModelFile);
+
+        AMLObject notMatchToModel("deviceId", "0");
+        notMatchToModel.addData("Model", LargeAMLObject().getData("Model"));
+        AMLData data;
+        data.setValue("invalidKey", "invalidValue");
+        notMatchToModel.addData("invalidData", data);
+
+        StringSink sink;
+        try
+        {
+            rep.DataToAml(notMatchToModel, true, sink);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), NOT_MATCH_TO_AML_MODEL);
+        }
+        EXPECT_TRUE(sink.str.empty());
+
+        std::vector<char> vec(1, 'p');
+        EXPECT_THROW(rep.DataToAml(notMatchToModel, true, vec), AMLException);
+        EXPECT_EQ(vec.size(), 1u);
+    }
+
+    TEST(DataToAmlTest, ReentrantSink)
+    {
+        // sink which converts another AMLObject while the output of the first one is written to it
+        class ReentrantSink : public AMLOutputSink
+        {
+        public:
+            ReentrantSink(const Representation& rep, const AMLObject& amlObj) : rep(rep), amlObj(amlObj) {}
+
+            void write(const char* data, size_t size)
+            {
+                if (inner.str.empty())
+                {
+                    rep.DataToAml(amlObj, false, inner);
+                }
+                str.append(data, size);
+            }
+
+            const Representation& rep;
+            const AMLObject& amlObj;
+            StringSink inner;
+            std::string str;
+        };
+
+        Representation rep = Representation(amlModelFile);
+        AMLObject amlObj = TestAMLObject();
+
+        ReentrantSink sink(rep, amlObj);
+        size_t size = rep.DataToAml(amlObj, true, sink);
+        EXPECT_EQ(size, sink.str.size());
+        EXPECT_EQ(sink.str, rep.DataToAml(amlObj));
+        EXPECT_EQ(sink.inner.str, rep.DataToAml(amlObj, false));
+    }
+
+    TEST(DataToAmlTest, AppendToBufferOnException)
+    {
+        Representation rep = Representation(amlModelFile);
+
+        AMLObject notMatchToModel("deviceId", "0");
+        AMLData data;
+        data.setValue("invalidKey", "invalidValue");
+        notMatchToModel.addData("invalidData", data);
+
+        std::string out("prefix");
+        try
+        {
+            rep.DataToAml(notMatchToModel, true, out);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), NOT_MATCH_TO_AML_MODEL);
+        }
+        EXPECT_EQ(out, "prefix");
+    }
+
+    TEST(DataToAmlTest, IgnoreDataNotInModel)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject amlObj = TestAMLObject();
+
+        AMLData sample = amlObj.getData("Sample");
+        sample.setValue("additionalKey", "additionalValue");
+
+        std::string amlStr;
+        EXPECT_NO_THROW(amlStr = rep.DataToAml(amlObj));
+
+        AMLObject *resultObj = NULL;
+        EXPECT_NO_THROW(resultObj = rep.AmlToData(amlStr));
+
+        AMLData sampleResult = resultObj->getData("Sample");
+
+        try
+        {
+            sampleResult.getValueToStr("additionalKey");
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), KEY_NOT_EXIST);
+        }
+
+        if (NULL != resultObj) delete resultObj;
+    }
+
+    TEST(DataToAmlTest, Batch)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject amlObj = TestAMLObject();
+
+        std::vector<const AMLObject*> amlObjs(1, &amlObj);
+        std::string out;
+        EXPECT_NO_THROW(rep.DataToAml(amlObjs, true, out, 1));
+        EXPECT_EQ(out, rep.DataToAml(amlObj));
+
+        amlObjs.assign(10, &amlObj);
+        std::string serial;
+        EXPECT_NO_THROW(rep.DataToAml(amlObjs, false, serial, 1));
+
+        size_t count = 0;
+        for (size_t pos = serial.find("<InstanceHierarchy"); std::string::npos != pos; pos = serial.find("<InstanceHierarchy", pos + 1))
+        {
+            count++;
+        }
+        EXPECT_EQ(count, amlObjs.size());
+
+        std::string parallel("prefix");
+        EXPECT_EQ(rep.DataToAml(amlObjs, false, parallel, 4), serial.size());
+        EXPECT_EQ(parallel, "prefix" + serial);
+
+        AMLObject *resultObj = NULL;
+        EXPECT_NO_THROW(resultObj = rep.AmlToData(serial));
+        EXPECT_TRUE(isEqual(*resultObj, amlObj));
+
+        if (NULL != resultObj) delete resultObj;
+    }
+
+    TEST(DataToAmlTest, BatchPerObject)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject amlObj = TestAMLObject();
+        std::string varify = rep.DataToAml(amlObj, false);
+
+        std::vector<const AMLObject*> amlObjs(10, &amlObj);
+        std::vector<std::string> amls;
+        EXPECT_NO_THROW(rep.DataToAml(amlObjs, false, amls, 0));
+        EXPECT_EQ(amls.size(), amlObjs.size());
+        for (const std::string& aml : amls)
+        {
+            EXPECT_EQ(aml, varify);
+        }
+    }
+
+    TEST(DataToAmlTest, BatchOnException)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject amlObj = TestAMLObject();
+
+        AMLObject notMatchToModel("deviceId", "0");
+        AMLData data;
+        data.setValue("invalidKey", "invalidValue");
+        notMatchToModel.addData("invalidData", data);
+
+        std::vector<const AMLObject*> amlObjs(10, &amlObj);
+        amlObjs[5] = &notMatchToModel;
+
+        std::string out("prefix");
+        try
+        {
+            rep.DataToAml(amlObjs, true, out, 4);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), NOT_MATCH_TO_AML_MODEL);
+        }
+        EXPECT_EQ(out, "prefix");
+
+        std::vector<std::string> amls(1, "prefix");
+        try
+        {
+            rep.DataToAml(amlObjs, true, amls, 4);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), NOT_MATCH_TO_AML_MODEL);
+        }
+        EXPECT_EQ(amls, std::vector<std::string>(1, "prefix"));
+
+        amlObjs[5] = NULL;
+        try
+        {
+            rep.DataToAml(amlObjs, true, amls, 4);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), INVALID_PARAM);
+        }
+    }
+
+    TEST(ByteToDataTest, ConvertValid)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject* amlObj = NULL;
+        std::string binary = TestBinary();
+
+#ifndef _DISABLE_PROTOBUF_
+        EXPECT_NO_THROW(amlObj = rep.ByteToData(binary));
+
+        AMLObject varify = TestAMLObject();
+        EXPECT_TRUE(isEqual(*amlObj, varify));
+
+        if (NULL != amlObj)  delete amlObj;
+#else
+        try
+        {
+            amlObj = rep.ByteToData(binary);
+            FAIL();
+            (void)amlObj;
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), API_NOT_ENABLED);
+        }
+#endif
+    }
+
+    TEST(ByteToDataTest, ConvertFromBuffer)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject* amlObj = NULL;
+        std::string binary = TestBinary();
+        std::vector<char> buffer(binary.begin(), binary.end());
+
+#ifndef _DISABLE_PROTOBUF_
+        EXPECT_NO_THROW(amlObj = rep.ByteToData(buffer.data(), buffer.size()));
+
+        AMLObject varify = TestAMLObject();
+        EXPECT_TRUE(isEqual(*amlObj, varify));
+
+        if (NULL != amlObj)  delete amlObj;
+#else
+        try
+        {
+            amlObj = rep.ByteToData(buffer.data(), buffer.size());
+            FAIL();
+            (void)amlObj;
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), API_NOT_ENABLED);
+        }
+#endif
+    }
+
+    TEST(ByteToDataTest, ConvertWithArena)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLArena arena;
+        AMLObject* amlObj = NULL;
+
+#ifndef _DISABLE_PROTOBUF_
+        EXPECT_NO_THROW(amlObj = rep.ByteToData(TestBinary(), &arena));
+        EXPECT_LT(0u, arena.getUsedSize());
+
+        AMLObject varify = TestAMLObject();
+        EXPECT_TRUE(isEqual(*amlObj, varify));
+
+        if (NULL != amlObj)  delete amlObj;
+#endif
+
+        EXPECT_NO_THROW(amlObj = rep.AmlToData(TestAML(), &arena));
+
+        AMLObject varifyAml = TestAMLObject();
+        EXPECT_TRUE(isEqual(*amlObj, varifyAml));
+
+        if (NULL != amlObj)  delete amlObj;
+    }
+
+    TEST(ByteToDataTest, InvalidByte)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject* amlObj = NULL;
+        std::string amlBinary("invalidBinary");
+
+        try
+        {
+            amlObj = rep.ByteToData(amlBinary);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+#ifndef _DISABLE_PROTOBUF_
+            EXPECT_EQ(e.code(), INVALID_BYTE_STR);
+#else
+            EXPECT_EQ(e.code(), API_NOT_ENABLED);
+#endif
+        }
+
+        if (NULL != amlObj)  delete amlObj;
+    }
+
+    TEST(ByteToDataTest, TruncatedByte)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject* amlObj = NULL;
+        std::string binary = TestBinary();
+        binary.resize(binary.size() / 2);
+
+        try
+        {
+            amlObj = rep.ByteToData(binary);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+#ifndef _DISABLE_PROTOBUF_
+            EXPECT_EQ(e.code(), INVALID_BYTE_STR);
+#else
+            EXPECT_EQ(e.code(), API_NOT_ENABLED);
+#endif
+        }
+
+        if (NULL != amlObj)  delete amlObj;
+    }
+
+    TEST(ByteToDataTest, Batch)
+    {
+        Representation rep = Representation(amlModelFile);
+        std::vector<std::string> bytes(50, TestBinary());
+        bytes[7] = "invalid";
+
+        std::vector<AMLObject*> amlObjs;
+        std::vector<ResultCode> results;
+#ifndef _DISABLE_PROTOBUF_
+        AMLObject varify = TestAMLObject();
+
+        EXPECT_NO_THROW(rep.ByteToData(bytes, amlObjs, results));
+        ASSERT_EQ(amlObjs.size(), bytes.size());
+        ASSERT_EQ(results.size(), bytes.size());
+
+        for (size_t i = 0; i < bytes.size(); ++i)
+        {
+            if (7 == i)
+            {
+                EXPECT_EQ(results[i], INVALID_BYTE_STR);
+                EXPECT_TRUE(NULL == amlObjs[i]);
+            }
+            else
+            {
+                EXPECT_EQ(results[i], NO_ERROR);
+                ASSERT_TRUE(NULL != amlObjs[i]);
+                EXPECT_TRUE(isEqual(*amlObjs[i], varify));
+            }
+            delete amlObjs[i];
+        }
+#else
+        try
+        {
+            rep.ByteToData(bytes, amlObjs, results);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), API_NOT_ENABLED);
+        }
+#endif
+    }
+
+    TEST(ByteToDataTest, Projection)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLProjection projection(std::vector<std::string>{"Model", "Sample/appendix"});
+        AMLObject* amlObj = NULL;
+
+#ifndef _DISABLE_PROTOBUF_
+        EXPECT_NO_THROW(amlObj = rep.ByteToData(TestBinary(), projection));
+        ASSERT_TRUE(NULL != amlObj);
+
+        AMLObject full = TestAMLObject();
+        AMLObject varify("SAMPLE001", "123456789");
+        AMLData sample;
+        sample.setValue("appendix", full.getData("Sample").getValueToStrArr("appendix"));
+        varify.addData("Model", full.getData("Model"));
+        varify.addData("Sample", sample);
+        EXPECT_TRUE(isEqual(*amlObj, varify));
+
+        delete amlObj;
+#else
+        try
+        {
+            amlObj = rep.ByteToData(TestBinary(), projection);
+            FAIL();
+            (void)amlObj;
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), API_NOT_ENABLED);
+        }
+#endif
+    }
+
+    TEST(ByteToDataViewTest, ConvertValid)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObjectView* view = NULL;
+        std::string binary = TestBinary();
+
+#ifndef _DISABLE_PROTOBUF_
+        EXPECT_NO_THROW(view = rep.ByteToDataView(std::move(binary)));
+        ASSERT_TRUE(NULL != view);
+        EXPECT_EQ(view->getDecodedCount(), 0u);
+
+        EXPECT_EQ(view->getData("Sample").getValueToStrArr("appendix").size(), 3u);
+        EXPECT_EQ(view->getDecodedCount(), 1u);
+
+        AMLObject varify = TestAMLObject();
+        EXPECT_TRUE(isEqual(*view, varify));
+
+        delete view;
+#else
+        try
+        {
+            view = rep.ByteToDataView(binary);
+            FAIL();
+            (void)view;
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), API_NOT_ENABLED);
+        }
+#endif
+    }
+
+    TEST(ByteToDataViewTest, InvalidByte)
+    {
+        Representation rep = Representation(amlModelFile);
+        std::string binary = TestBinary();
+        binary.resize(binary.size() / 2);
+
+        try
+        {
+            delete rep.ByteToDataView(binary);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+#ifndef _DISABLE_PROTOBUF_
+            EXPECT_EQ(e.code(), INVALID_BYTE_STR);
+#else
+            EXPECT_EQ(e.code(), API_NOT_ENABLED);
+#endif
+        }
+    }
+
+    TEST(DataToByteTest, ConvertValid)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject amlObj = TestAMLObject();
+        std::string amlBinary;
+#ifndef _DISABLE_PROTOBUF_
+        EXPECT_NO_THROW(amlBinary = rep.DataToByte(amlObj));
+
+        std::string varify = TestBinary();
+        EXPECT_EQ(varify.compare(amlBinary), 0);
+#else
+        try
+        {
+            amlBinary = rep.DataToByte(amlObj);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), API_NOT_ENABLED);
+        }
+#endif
+    }
+
+    TEST(DataToByteTest, InvalidDataToModel)
+    {
+        Representation rep = Representation(amlModelFile);
+
+        AMLObject notMatchToModel("deviceId", "0");
+
+        AMLData data;
+        data.setValue("invalidKey", "invalidValue");
+
+        notMatchToModel.addData("invalidData", data);
+
+        try
+        {
+            rep.DataToByte(notMatchToModel);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+#ifndef _DISABLE_PROTOBUF_
+            EXPECT_EQ(e.code(), NOT_MATCH_TO_AML_MODEL);
+#else
+            EXPECT_EQ(e.code(), API_NOT_ENABLED);
+#endif
+        }
+    }
+
+    TEST(DataToByteTest, RoundTrip)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject amlObj = TestAMLObject();
+#ifndef _DISABLE_PROTOBUF_
+        AMLObject* result = NULL;
+        EXPECT_NO_THROW(result = rep.ByteToData(rep.DataToByte(amlObj)));
+        EXPECT_TRUE(isEqual(*result, amlObj));
+
+        if (NULL != result)  delete result;
+#else
+        (void)amlObj;
+#endif
+    }
+
+    TEST(DataToByteTest, CompactLayout)
+    {
+        Representation rep = Representation(amlModelFile);
+
+        AMLObject amlObj = TestAMLObject();
+#ifndef _DISABLE_PROTOBUF_
+        std::string standard = rep.DataToByte(amlObj, ByteLayout::Standard);
+        std::string compact = rep.DataToByte(amlObj, ByteLayout::Compact);
+        EXPECT_EQ(rep.DataToByte(amlObj), standard);
+        EXPECT_LT(compact.size(), standard.size());
+        EXPECT_EQ(rep.estimateByteSize(amlObj, ByteLayout::Compact), compact.size());
+
+        std::string out("prefix");
+        EXPECT_EQ(rep.DataToByte(amlObj, out, ByteLayout::Compact), compact.size());
+        EXPECT_EQ(out, "prefix" + compact);
+
+        std::vector<std::string> bytes;
+        EXPECT_NO_THROW(rep.DataToByte(std::vector<const AMLObject*>(2, &amlObj), bytes, 2, ByteLayout::Compact));
+        EXPECT_EQ(bytes, std::vector<std::string>(2, compact));
+
+        // both layouts are read
+        for (const std::string& byte : { standard, compact })
+        {
+            AMLObject* result = NULL;
+            EXPECT_NO_THROW(result = rep.ByteToData(byte));
+            ASSERT_TRUE(NULL != result);
+            EXPECT_TRUE(isEqual(*result, amlObj));
+            delete result;
+        }
+
+        // an empty string is an element as well
+        AMLObject emptyElements("SAMPLE001", "123456789");
+        emptyElements.addData("Model", amlObj.getData("Model"));
+        AMLData& sample = emptyElements.emplaceData("Sample");
+        sample.setValue("info", amlObj.getData("Sample").getValueToAMLData("info"));
+        sample.setValue("appendix", std::vector<std::string>({ "", "935", "" }));
+        AMLObject* result = NULL;
+        EXPECT_NO_THROW(result = rep.ByteToData(rep.DataToByte(emptyElements, ByteLayout::Compact)));
+        ASSERT_TRUE(NULL != result);
+        EXPECT_EQ(result->getData("Sample").getValueToStrArr("appendix"), std::vector<std::string>({ "", "935", "" }));
+        delete result;
+#else
+        (void)amlObj;
+#endif
+    }
+
+    TEST(DataToByteTest, AppendToBuffer)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject amlObj = TestAMLObject();
+#ifndef _DISABLE_PROTOBUF_
+        std::string varify = rep.DataToByte(amlObj);
+
+        std::string out("prefix");
+        size_t size = 0;
+        EXPECT_NO_THROW(size = rep.DataToByte(amlObj, out));
+        EXPECT_EQ(size, varify.size());
+        EXPECT_EQ(out, "prefix" + varify);
+
+        std::vector<char> vec;
+        EXPECT_EQ(rep.DataToByte(amlObj, vec), varify.size());
+        EXPECT_EQ(std::string(vec.begin(), vec.end()), varify);
+
+        StringSink sink;
+        EXPECT_EQ(rep.DataToByte(amlObj, sink), varify.size());
+        EXPECT_EQ(sink.str, varify);
+
+        EXPECT_EQ(rep.estimateByteSize(amlObj), varify.size());
+#else
+        std::string out;
+        try
+        {
+            rep.DataToByte(amlObj, out);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), API_NOT_ENABLED);
+        }
+#endif
+    }
+
+    TEST(DataToByteTest, SinkInChunks)
+    {
+#ifndef _DISABLE_PROTOBUF_
+        Representation rep = Representation(amlModelFile);
+        AMLObject amlObj = LargeAMLObject();
+
+        for (ByteLayout layout : {ByteLayout::Standard, ByteLayout::Compact})
+        {
+            std::string varify = rep.DataToByte(amlObj, layout);
+
+            ChunkSink sink;
+            EXPECT_EQ(rep.DataToByte(amlObj, sink, layout), varify.size());
+            EXPECT_EQ(sink.str, varify);
+            EXPECT_TRUE(sink.isChunked());
+        }
+
+        AMLObject notMatchToModel("deviceId", "0");
+        notMatchToModel.addData("Model", amlObj.getData("Model"));
+        AMLData data;
+        data.setValue("invalidKey", "invalidValue");
+        notMatchToModel.addData("invalidData", data);
+
+        StringSink sink;
+        EXPECT_THROW(rep.DataToByte(notMatchToModel, sink), AMLException);
+        EXPECT_TRUE(sink.str.empty());
+#endif
+    }
+
+    TEST(DataToByteTest, Batch)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject amlObj = TestAMLObject();
+
+        std::vector<const AMLObject*> amlObjs(10, &amlObj);
+        std::vector<std::string> bytes;
+#ifndef _DISABLE_PROTOBUF_
+        std::string varify = rep.DataToByte(amlObj);
+
+        EXPECT_NO_THROW(rep.DataToByte(amlObjs, bytes, 4));
+        EXPECT_EQ(bytes.size(), amlObjs.size());
+        for (const std::string& byte : bytes)
+        {
+            EXPECT_EQ(byte, varify);
+        }
+#else
+        try
+        {
+            rep.DataToByte(amlObjs, bytes, 4);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), API_NOT_ENABLED);
+        }
+#endif
+    }
+
+    // The model of "TEST_DataModel.aml" whose attributes of "Sample" and "Model" have typed AttributeDataType (and "appendix" is a list of xs:double)
+    std::string TypedModel()
+    {
+        std::ifstream t(amlModelFile);
+        std::string model((std::istreambuf_iterator<char>(t)), std::istreambuf_iterator<char>());
+
+        const char* types[][2] = { { "\"x\"", "xs:double" }, { "\"y\"", "xs:long" }, { "\"z\"", "xs:boolean" }, { "\"b\"", "xs:base64Binary" },
+                                   { "\"appendix\"", "xs:double" } };
+        for (const auto& type : types)
+        {
+            std::string from = std::string("Name=") + type[0] + " AttributeDataType=\"xs:string\"";
+            std::string to = std::string("Name=") + type[0] + " AttributeDataType=\"" + type[1] + "\"";
+            model.replace(model.find(from), from.size(), to);
+        }
+        return model;
+    }
+
+    void setTypedAxis(AMLData& axis)
+    {
+        axis.setDoubleValue("x", 20.5);
+        axis.setIntValue("y", -110);
+        axis.setBoolValue("z", true);
+    }
+
+    void setStringAppendix(AMLData& sample)
+    {
+        sample.setValue("appendix", vector<string>{"52303", "935", "1442"});
+    }
+
+    AMLObject TypedAMLObject(void (*setAxis)(AMLData&) = setTypedAxis, void (*setAppendix)(AMLData&) = setStringAppendix)
+    {
+        AMLObject amlObj("SAMPLE001", "123456789");
+
+        AMLData& model = amlObj.emplaceData("Model");
+        model.setValue("a", "Model_107.113.97.248");
+        model.setBinaryValue("b", vector<uint8_t>{0x00, 0xFF, 0x10});
+
+        AMLData& sample = amlObj.emplaceData("Sample");
+        AMLData& info = sample.emplaceData("info");
+        info.setValue("id", "f437da3b");
+        setAxis(info.emplaceData("axis"));
+        setAppendix(sample);
+
+        return amlObj;
+    }
+
+    TEST(TypedValueTest, DataToAml)
+    {
+        std::string model = TypedModel();
+        Representation rep = Representation(model.data(), model.size());
+        AMLObject amlObj = TypedAMLObject();
+
+        std::string amlStr;
+        EXPECT_NO_THROW(amlStr = rep.DataToAml(amlObj));
+        EXPECT_EQ(rep.estimateAmlSize(amlObj, true), amlStr.size());
+        EXPECT_NE(amlStr.find("<Value>20.5</Value>"), std::string::npos);
+        EXPECT_NE(amlStr.find("<Value>-110</Value>"), std::string::npos);
+        EXPECT_NE(amlStr.find("<Value>true</Value>"), std::string::npos);
+        EXPECT_NE(amlStr.find("<Value>AP8Q</Value>"), std::string::npos);
+
+        // values are strings after AML(XML), which are parsed by the typed getters
+        AMLObject* result = nullptr;
+        EXPECT_NO_THROW(result = rep.AmlToData(amlStr));
+        const AMLData& axis = result->getData("Sample").getValueToAMLData("info").getValueToAMLData("axis");
+        EXPECT_EQ(axis.getValueToDouble("x"), 20.5);
+        EXPECT_EQ(axis.getValueToInt("y"), -110);
+        EXPECT_TRUE(axis.getValueToBool("z"));
+        delete result;
+    }
+
+    TEST(TypedValueTest, NotMatchToModel)
+    {
+        std::string model = TypedModel();
+        Representation rep = Representation(model.data(), model.size());
+
+        AMLObject intToBinary("SAMPLE001", "123456789");
+        AMLData& intModel = intToBinary.emplaceData("Model");
+        intModel.setValue("a", "Model_107.113.97.248");
+        intModel.setIntValue("b", 1);
+
+        // an integer can be set to a floating point attribute, but not the reverse
+
+        AMLObject doubleToLong = TypedAMLObject([](AMLData& axis)
+        {
+            axis.setIntValue("x", 20);
+            axis.setDoubleValue("y", -110.5);
+            axis.setBoolValue("z", true);
+        });
+
+        // string values are not checked
+        AMLObject stringToLong = TypedAMLObject([](AMLData& axis)
+        {
+            axis.setIntValue("x", 20);
+            axis.setValue("y", "-110");
+            axis.setValue("z", "true");
+        });
+        EXPECT_NO_THROW(rep.DataToAml(stringToLong));
+
+        for (const AMLObject* amlObj : { &intToBinary, &doubleToLong })
+        {
+            try
+            {
+                rep.DataToAml(*amlObj);
+                FAIL();
+            }
+            catch (const AMLException& e)
+            {
+                EXPECT_EQ(e.code(), NOT_MATCH_TO_AML_MODEL);
+            }
+#ifndef _DISABLE_PROTOBUF_
+            try
+            {
+                rep.DataToByte(*amlObj);
+                FAIL();
+            }
+            catch (const AMLException& e)
+            {
+                EXPECT_EQ(e.code(), NOT_MATCH_TO_AML_MODEL);
+            }
+#endif
+        }
+    }
+
+    TEST(TypedValueTest, ByteRoundTrip)
+    {
+        std::string model = TypedModel();
+        Representation rep = Representation(model.data(), model.size());
+        AMLObject amlObj = TypedAMLObject();
+#ifndef _DISABLE_PROTOBUF_
+        AMLObject* result = nullptr;
+        std::string byte;
+        EXPECT_NO_THROW(byte = rep.DataToByte(amlObj));
+        EXPECT_NO_THROW(result = rep.ByteToData(byte));
+        EXPECT_TRUE(isEqual(*result, amlObj));
+        delete result;
+
+        // typed values are shorter than their text
+        result = rep.AmlToData(rep.DataToAml(amlObj));
+        EXPECT_LT(byte.size(), rep.DataToByte(*result).size());
+        delete result;
+#else
+        (void)amlObj;
+#endif
+    }
+
+    void setDoubleAppendix(AMLData& sample)
+    {
+        sample.setDoubleArrayValue("appendix", vector<double>{52303.5, -1e-7, 1442});
+    }
+
+    void setIntAppendix(AMLData& sample)
+    {
+        sample.setIntArrayValue("appendix", vector<int64_t>{52303, -935, INT64_MAX});
+    }
+
+    TEST(NumericArrayTest, DataToAml)
+    {
+        std::string model = TypedModel();
+        Representation rep = Representation(model.data(), model.size());
+        AMLObject amlObj = TypedAMLObject(setTypedAxis, setDoubleAppendix);
+
+        // the elements are a single <Value>
+        std::string amlStr;
+        EXPECT_NO_THROW(amlStr = rep.DataToAml(amlObj));
+        EXPECT_EQ(rep.estimateAmlSize(amlObj, true), amlStr.size());
+        EXPECT_NE(amlStr.find("<Value>52303.5 -1e-07 1442</Value>"), std::string::npos);
+        EXPECT_EQ(amlStr.find("<Attribute Name=\"1\""), std::string::npos);
+
+        // and are read back as the type of the model
+        AMLObject* result = nullptr;
+        EXPECT_NO_THROW(result = rep.AmlToData(amlStr));
+        EXPECT_TRUE(amlObj.getData("Sample").getValueToDoubleArr("appendix") == result->getData("Sample").getValueToDoubleArr("appendix"));
+        delete result;
+
+        // an integer array of a floating point attribute is read as a floating point array
+        AMLObject intObj = TypedAMLObject(setTypedAxis, setIntAppendix);
+        EXPECT_NO_THROW(result = rep.AmlToData(rep.DataToAml(intObj)));
+        EXPECT_TRUE(AMLValueType::DoubleArray == result->getData("Sample").getValueType("appendix"));
+        EXPECT_EQ(result->getData("Sample").getValueToDoubleArr("appendix")[1], -935.0);
+        delete result;
+
+        // string arrays are written as before
+        AMLObject strObj = TypedAMLObject();
+        EXPECT_NO_THROW(result = rep.AmlToData(rep.DataToAml(strObj)));
+        EXPECT_TRUE(strObj.getData("Sample").getValueToStrArr("appendix") == result->getData("Sample").getValueToStrArr("appendix"));
+        delete result;
+    }
+
+    TEST(NumericArrayTest, NotMatchToModel)
+    {
+        std::string model = TypedModel();
+        Representation typedRep = Representation(model.data(), model.size());
+        Representation rep = Representation(amlModelFile);
+
+        // the list of xs:string does not take a numeric array
+        AMLObject intObj = TypedAMLObject([](AMLData& axis)
+        {
+            axis.setValue("x", "20");
+            axis.setValue("y", "-110");
+            axis.setValue("z", "true");
+        }, setIntAppendix);
+        EXPECT_THROW(rep.DataToAml(intObj), AMLException);
+        EXPECT_NO_THROW(typedRep.DataToAml(intObj));
+
+        // the elements which are not numbers
+        std::string amlStr = typedRep.DataToAml(intObj);
+        std::string text = "52303 -935 9223372036854775807";
+        amlStr.replace(amlStr.find(text), text.size(), "52303 x");
+        try
+        {
+            delete typedRep.AmlToData(amlStr);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), NOT_MATCH_TO_AML_MODEL);
+        }
+#ifndef _DISABLE_PROTOBUF_
+        try
+        {
+            rep.DataToByte(intObj);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), NOT_MATCH_TO_AML_MODEL);
+        }
+#endif
+    }
+
+    TEST(NumericArrayTest, ByteRoundTrip)
+    {
+        std::string model = TypedModel();
+        Representation rep = Representation(model.data(), model.size());
+#ifndef _DISABLE_PROTOBUF_
+        for (void (*setAppendix)(AMLData&) : { setDoubleAppendix, setIntAppendix })
+        {
+            AMLObject amlObj = TypedAMLObject(setTypedAxis, setAppendix);
+            AMLObject* result = nullptr;
+            EXPECT_NO_THROW(result = rep.ByteToData(rep.DataToByte(amlObj)));
+            EXPECT_TRUE(isEqual(*result, amlObj));
+            delete result;
+        }
+#else
+        (void)rep;
+#endif
+    }
+
+    // Many threads use one Representation at once, without locking.
+    TEST(CompactByteTest, RoundTrip)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject amlObj = TestAMLObject();
+
+        std::string compact;
+        EXPECT_NO_THROW(compact = rep.DataToCompactByte(amlObj));
+        AMLObject* result = NULL;
+        EXPECT_NO_THROW(result = rep.CompactByteToData(compact));
+        ASSERT_TRUE(NULL != result);
+        EXPECT_TRUE(isEqual(*result, amlObj));
+        delete result;
+
+        // the id which is not made of deviceId and timeStamp
+        AMLObject withId("SAMPLE001", "123456789", "sample-id");
+        withId.addData("Model", amlObj.getData("Model"));
+        result = rep.CompactByteToData(rep.DataToCompactByte(withId));
+        EXPECT_EQ(result->getId(), "sample-id");
+        EXPECT_TRUE(isEqual(*result, withId));
+        delete result;
+
+        result = rep.CompactByteToData(compact.data(), compact.size());
+        EXPECT_TRUE(isEqual(*result, amlObj));
+        delete result;
+
+        AMLArena arena;
+        result = rep.CompactByteToData(compact.data(), compact.size(), &arena);
+        EXPECT_TRUE(isEqual(*result, amlObj));
+        delete result;
+#ifndef _DISABLE_PROTOBUF_
+        // names and the structure of CAEX are not written, but the values and the ids are
+        EXPECT_LT(compact.size() * 5, rep.DataToByte(amlObj).size());
+#endif
+    }
+
+    TEST(CompactByteTest, TypedRoundTrip)
+    {
+        std::string model = TypedModel();
+        Representation rep = Representation(model.data(), model.size());
+        for (void (*setAppendix)(AMLData&) : { setStringAppendix, setDoubleAppendix, setIntAppendix })
+        {
+            AMLObject amlObj = TypedAMLObject(setTypedAxis, setAppendix);
+            AMLObject* result = NULL;
+            EXPECT_NO_THROW(result = rep.CompactByteToData(rep.DataToCompactByte(amlObj)));
+            ASSERT_TRUE(NULL != result);
+            EXPECT_TRUE(isEqual(*result, amlObj));
+            delete result;
+        }
+    }
+
+    TEST(CompactByteTest, InvalidDataToModel)
+    {
+        Representation rep = Representation(amlModelFile);
+
+        AMLObject notMatchToModel("deviceId", "0");
+        AMLData data;
+        data.setValue("invalidKey", "invalidValue");
+        notMatchToModel.addData("invalidData", data);
+
+        std::string out = "prefix";
+        try
+        {
+            rep.DataToCompactByte(notMatchToModel, out);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), NOT_MATCH_TO_AML_MODEL);
+        }
+        EXPECT_EQ(out, "prefix");
+    }
+
+    TEST(CompactByteTest, OtherModel)
+    {
+        Representation rep = Representation(amlModelFile);
+        std::string model = TypedModel();
+        Representation typedRep = Representation(model.data(), model.size());
+
+        try
+        {
+            delete typedRep.CompactByteToData(rep.DataToCompactByte(TestAMLObject()));
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), NOT_MATCH_TO_AML_MODEL);
+        }
+    }
+
+    TEST(CompactByteTest, InvalidByte)
+    {
+        Representation rep = Representation(amlModelFile);
+        std::string compact = rep.DataToCompactByte(TestAMLObject());
+
+        std::vector<std::string> invalids;
+        for (size_t size = 0; size < compact.size(); ++size)
+        {
+            invalids.push_back(compact.substr(0, size));                // truncated
+        }
+        invalids.push_back(compact + '\0');                             // trailing bytes
+        invalids.push_back(std::string(1, '\x02') + compact.substr(1)); // another version
+
+        for (const std::string& invalid : invalids)
+        {
+            try
+            {
+                delete rep.CompactByteToData(invalid);
+                FAIL();
+            }
+            catch (const AMLException& e)
+            {
+                EXPECT_EQ(e.code(), INVALID_BYTE_STR);
+            }
+        }
+
+        try
+        {
+            delete rep.CompactByteToData(nullptr, compact.size());
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), INVALID_PARAM);
+        }
+
+        AMLArena arena;
+        try
+        {
+            delete rep.CompactByteToData(nullptr, 0, &arena);
+            FAIL();
+        }
+        catch (const AMLException& e)
+        {
+            EXPECT_EQ(e.code(), INVALID_PARAM);
+        }
+    }
+
+    TEST(SymbolTest, LookupModelNames)
+    {
+        Representation rep = Representation(amlModelFile);
+
+        // names in the loaded model are interned, so that keys given as string are resolved to the same symbol
+        size_t interned = AMLSymbol::internedCount();
+        AMLSymbol name = AMLSymbol::lookup("Model");
+        EXPECT_TRUE(&name.str() == &AMLSymbol::lookup(std::string("Model")).str());
+        EXPECT_TRUE(&name.str() != &AMLSymbol::uninterned("Model").str());
+        EXPECT_TRUE(name == AMLSymbol::uninterned("Model"));
+
+        AMLObject amlObj("deviceId", "timeStamp");
+        amlObj.emplaceData("Model").setValue("a", "value");
+        EXPECT_EQ(amlObj.getData(name).getValueToStr(AMLSymbol::lookup("a")), "value");
+        EXPECT_EQ(AMLSymbol::internedCount(), interned);
+    }
+
+    TEST(SymbolTest, UnknownNamesNotInterned)
+    {
+        Representation rep = Representation(amlModelFile);
+        std::string amlStr = TestAML();
+        std::string binary = TestBinary();
+        size_t key = amlStr.find("<Attribute Name=\"b\"");
+        size_t name = binary.find(std::string("\x0a\x05Model"));
+        ASSERT_NE(key, std::string::npos);
+        ASSERT_NE(name, std::string::npos);
+
+        size_t interned = AMLSymbol::internedCount();
+
+        // names which are not in the model are held by the data, not by the symbol table
+        for (int i = 0; i < 1000; ++i)
+        {
+            char unknown[8];
+            snprintf(unknown, sizeof(unknown), "U%04d", i);
+
+            std::string renamed(amlStr);
+            renamed.replace(key, strlen("<Attribute Name=\"b\""), std::string("<Attribute Name=\"") + unknown + "\"");
+            AMLObject* amlObj = rep.AmlToData(renamed);
+            EXPECT_EQ(amlObj->getData("Model").getValueToStr(unknown), "SR-P7-970");
+            delete amlObj;
+
+#ifndef _DISABLE_PROTOBUF_
+            std::string bytes(binary);
+            bytes.replace(name + 2, 5, unknown);
+            amlObj = rep.ByteToData(bytes);
+            EXPECT_EQ(amlObj->getData(unknown).getValueToStr("b"), "SR-P7-970");
+            delete amlObj;
+#endif
+        }
+
+        EXPECT_EQ(AMLSymbol::internedCount(), interned);
+    }
+
+    TEST(ConcurrentUseTest, Stress)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject amlObj = TestAMLObject();
+        std::string aml = rep.DataToAml(amlObj);
+        std::string dataOnlyAml = rep.DataToAml(amlObj, false);
+        std::string repId = rep.getRepresentationId();
+#ifndef _DISABLE_PROTOBUF_
+        std::string binary = rep.DataToByte(amlObj);
+#endif
+
+        const size_t sizeOfThreads = 8;
+        const size_t sizeOfIterations = 200;
+        std::atomic<size_t> failures(0);
+
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < sizeOfThreads; ++t)
+        {
+            threads.push_back(std::thread([&, t]()
+            {
+                try
+                {
+                    AMLArena arena; // one per thread
+                    for (size_t i = 0; i < sizeOfIterations; ++i)
+                    {
+                        if (rep.DataToAml(amlObj) != aml)                       failures++;
+                        if (rep.DataToAml(amlObj, false) != dataOnlyAml)        failures++;
+                        if (rep.getRepresentationId() != repId)                 failures++;
+
+                        AMLObject* result = rep.AmlToData((t + i) % 2 ? aml : dataOnlyAml, &arena);
+                        if (false == isEqual(*result, amlObj))                  failures++;
+                        delete result;
+                        arena.reset();
+
+                        delete rep.getConfigInfo();
+#ifndef _DISABLE_PROTOBUF_
+                        if (rep.DataToByte(amlObj) != binary)                   failures++;
+
+                        result = rep.ByteToData(binary);
+                        if (false == isEqual(*result, amlObj))                  failures++;
+                        delete result;
+#endif
+                    }
+                }
+                catch (const AMLException&)
+                {
+                    failures++;
+                }
+            }));
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(failures, 0u);
+    }
+
+    TEST(GetRepresentationIdTest, GetValid)
+    {
+        Representation rep = Representation(amlModelFile);
+
+        EXPECT_TRUE(amlModelId == rep.getRepresentationId());
+    }
+
+    TEST(GetConfigInfoTest, GetValid)
+    {
+        Representation rep = Representation(amlModelFile);
+        AMLObject* config = NULL;
+        EXPECT_NO_THROW(config = rep.getConfigInfo());
+
+        EXPECT_EQ(config->getDeviceId(), "SAMPLE_Robot_Cycle"); // RoleClassLib name
+        EXPECT_EQ(config->getData("Model").getValueToStr("cycle"), "once");
+        EXPECT_EQ(config->getData("Sample").getValueToStr("cycle"), "25");
+
+        vector<string> dataNames = config->getDataNames();
+        EXPECT_EQ(dataNames.size(), 2u); // "Event" is not included
+
+        if (NULL != config) delete config;
     }
-}
\ No newline at end of file
+}